@@ -331,6 +331,16 @@ namespace QuantLib {
         return cumulatedLoss() + lossModel_->expectedTrancheLoss(d);
     }
 
+    Disposable<std::vector<Real> >
+        Basket::expectedTrancheLosses(const std::vector<Date>& dates) const {
+        calculate();
+        std::vector<Real> losses = lossModel_->expectedTrancheLosses(dates);
+        const Real realized = cumulatedLoss();
+        for(Size i=0; i<losses.size(); i++)
+            losses[i] = realized + losses[i];
+        return losses;
+    }
+
     Disposable<std::vector<Real> > 
         Basket::splitVaRLevel(const Date& date, Real loss) const {
         calculate();
@@ -233,6 +233,9 @@ namespace QuantLib {
         */
         //@{
         Real expectedTrancheLoss(const Date& d) const;
+        //! expected tranche losses at several dates at once
+        Disposable<std::vector<Real> > expectedTrancheLosses(
+            const std::vector<Date>& dates) const;
         /*!
             @param lossFraction is the fraction of losses expressed in 
               inception (no losses) tranche units (e.g. 'attach level'=0%, 
@@ -71,6 +71,16 @@ namespace QuantLib {
         virtual Real expectedTrancheLoss(const Date& d) const {
             QL_FAIL("expectedTrancheLoss Not implemented for this model.");
         }
+        /*! Expected tranche losses at several dates. The default
+          implementation calls expectedTrancheLoss for each date; models
+          override it when the dates can share work. */
+        virtual Disposable<std::vector<Real> > expectedTrancheLosses(
+            const std::vector<Date>& dates) const {
+            std::vector<Real> losses(dates.size());
+            for(Size i=0; i<dates.size(); i++)
+                losses[i] = expectedTrancheLoss(dates[i]);
+            return losses;
+        }
         /*! Probability of the tranche losing the same or more than the 
           fractional amount given.
 
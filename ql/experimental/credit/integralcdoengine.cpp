@@ -39,14 +39,38 @@ namespace QuantLib {
         const Real inceptionTrancheNotional = 
             arguments_.basket->trancheNotional();
 
-        // compute expected loss at the beginning of first relevant period
-        Real e1 = 0;
+        // the integration dates are collected first, so that the basket
+        // can compute the expected losses on all of them at once
+        std::vector<Date> lossDates;
         // todo add includeSettlement date flows variable to engine.
         if (!arguments_.normalizedLeg[0]->hasOccurred(today)) 
              // cast to fixed rate coupon?
-            e1 = arguments_.basket->expectedTrancheLoss(
+            lossDates.push_back(
                 boost::dynamic_pointer_cast<Coupon>(
-                    arguments_.normalizedLeg[0])->accrualStartDate()); 
+                    arguments_.normalizedLeg[0])->accrualStartDate());
+        for (Size i = 0; i < arguments_.normalizedLeg.size(); i++) {
+            if(arguments_.normalizedLeg[i]->hasOccurred(today))
+                continue;
+            const Date d2 = arguments_.normalizedLeg[i]->date();
+            Date d, d0 = boost::dynamic_pointer_cast<Coupon>(
+                arguments_.normalizedLeg[i])->accrualStartDate();
+            do {
+                d = NullCalendar().advance(d0 > today ? d0 : today,
+                                           stepSize_);
+                if (d > d2) d = d2;
+                lossDates.push_back(d);
+                d0 = d;
+            }
+            while (d < d2);
+        }
+        const std::vector<Real> losses =
+            arguments_.basket->expectedTrancheLosses(lossDates);
+        Size k = 0;
+
+        // compute expected loss at the beginning of first relevant period
+        Real e1 = 0;
+        if (!arguments_.normalizedLeg[0]->hasOccurred(today)) 
+            e1 = losses[k++];
         results_.expectedTrancheLoss.push_back(e1);// zero or realized losses?
 
         for (Size i = 0; i < arguments_.normalizedLeg.size(); i++) {
@@ -66,11 +90,8 @@ namespace QuantLib {
             Date d, d0 = d1;
             Real e2;
             do {
-                d = NullCalendar().advance(d0 > today ? d0 : today,
-                                           stepSize_);
-                if (d > d2) d = d2;
-
-                e2 = arguments_.basket->expectedTrancheLoss(d);
+                d = lossDates[k];
+                e2 = losses[k++];
 
                 results_.premiumValue
                     // ..check for e2 including past/realized losses
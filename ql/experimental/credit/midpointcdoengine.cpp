@@ -39,17 +39,31 @@ namespace QuantLib {
         const Real inceptionTrancheNotional = 
             arguments_.basket->trancheNotional();
 
-        // compute expected loss at the beginning of first relevant period
-        Real e1 = 0;
+        // the loss dates are collected first, so that the basket can
+        // compute the expected losses on all of them at once
+        std::vector<Date> lossDates;
         // todo add includeSettlement date flows variable to engine.
         if (!arguments_.normalizedLeg[0]->hasOccurred(today))
             // Notice that since there might be a gap between the end of 
             // acrrual and payment dates and today be in between
             // the tranche loss on that date might not be contingent but 
             // realized:
-            e1 = arguments_.basket->expectedTrancheLoss(
+            lossDates.push_back(
                 boost::dynamic_pointer_cast<Coupon>(
                     arguments_.normalizedLeg[0])->accrualStartDate());
+        for (Size i = 0; i < arguments_.normalizedLeg.size(); i++) {
+            if(!arguments_.normalizedLeg[i]->hasOccurred(today))
+                lossDates.push_back(boost::dynamic_pointer_cast<Coupon>(
+                    arguments_.normalizedLeg[i])->accrualEndDate());
+        }
+        const std::vector<Real> losses =
+            arguments_.basket->expectedTrancheLosses(lossDates);
+        Size k = 0;
+
+        // compute expected loss at the beginning of first relevant period
+        Real e1 = 0;
+        if (!arguments_.normalizedLeg[0]->hasOccurred(today))
+            e1 = losses[k++];
         results_.expectedTrancheLoss.push_back(e1);
         //'e1'  should contain the existing loses.....? use remaining amounts?
         for (Size i = 0; i < arguments_.normalizedLeg.size(); i++) {
@@ -66,7 +80,7 @@ namespace QuantLib {
             // we assume the loss within the period took place on this date:
             Date defaultDate = startDate + (endDate-startDate)/2;
 
-            Real e2 = arguments_.basket->expectedTrancheLoss(endDate);
+            Real e2 = losses[k++];
             results_.expectedTrancheLoss.push_back(e2);
             results_.premiumValue += 
                 ((inceptionTrancheNotional - e2) / inceptionTrancheNotional)
@@ -23,6 +23,7 @@
 #include <ql/math/beta.hpp>
 #include <ql/math/statistics/histogram.hpp>
 #include <ql/math/statistics/riskstatistics.hpp>
+#include <ql/math/statistics/incrementalstatistics.hpp>
 #include <ql/math/solvers1d/brent.hpp>
 #include <ql/math/randomnumbers/sobolrsg.hpp>
 #include <ql/experimental/credit/basket.hpp>
@@ -36,6 +37,10 @@
 
 #include <ql/math/randomnumbers/mt19937uniformrng.hpp>
 
+#ifdef _OPENMP
+#include <omp.h>
+#endif
+
 /* Intended to replace
     ql\experimental\credit\randomdefaultmodel.Xpp
 */
@@ -73,10 +78,15 @@ namespace QuantLib {
     Generates the factors and variable samples and determines event threshold
     but it is not responsible for actual event specification; thats the derived
     classes responsibility according to what they model.
-    Derived classes need mainly to implement nextSample (Worker::nextSample in
-    the multithreaded version) to compute the simulation event generated, if
-    any, from the latent variables sample. They also have the accompanying
-    event trait to specify.
+    Derived classes need mainly to implement nextSample to compute the
+    simulation events generated, if any, from the latent variables sample.
+    They also have the accompanying event trait to specify.
+    When OpenMP is enabled the simulations are split in contiguous blocks, one
+    per thread, each drawn from its own generator moved to the start of the
+    block; the results do not depend on the number of threads. The events of
+    all the simulations are stored contiguously.
+    Default times are located on tables of daily default probabilities, so
+    that the term structures are not accessed during the simulation.
     */
     /* CRTP used for performance to avoid virtual table resolution in the Monte
     Carlo. Not only in sample generation but access; quite an amount of time can
@@ -100,7 +110,22 @@ namespace QuantLib {
         // random generation is performed in this class only.
         typedef typename LatentModel<copulaPolicy>::template FactorSampler<USNG>
             copulaRNG_type;
+        typedef simEvent<derivedRandomLM<copulaPolicy, USNG> > simEvent_type;
     protected:
+        /* The events of a simulation; statistics access them through size()
+        and operator[] only. */
+        class SimEvents {
+          public:
+            SimEvents(const simEvent_type* begin, const simEvent_type* end)
+            : begin_(begin), end_(end) {}
+            Size size() const { return end_ - begin_; }
+            const simEvent_type& operator[](Size i) const {
+                return begin_[i];
+            }
+          private:
+            const simEvent_type *begin_, *end_;
+        };
+
         RandomLM(Size numFactors,
             Size numLMVars,
             const copulaPolicy& copula,
@@ -111,37 +136,46 @@ namespace QuantLib {
 
         void update() {
             simsBuffer_.clear();
+            simsIndex_.clear();
             // tell basket to notify instruments, etc, we are invalid
             if(!basket_.empty()) basket_->notifyObservers();
             LazyObject::update();
         }
 
         void performCalculations() const {
-            static_cast<const derivedRandomLM<copulaPolicy, USNG>* >(
-                this)->initDates();//in update?
-            copulasRng_ = boost::make_shared<copulaRNG_type>(copula_, seed_);
+            initDates();
             performSimulations();
         }
 
-        void performSimulations() const {
-            // Next sequence should determine the event and push it into buffer
-            for(Size i=nSims_; i; i--) {
-                const std::vector<Real>& sample =
-                    copulasRng_->nextSequence().value;
-                static_cast<const derivedRandomLM<copulaPolicy, USNG>* >(
-                    this)->nextSample(sample);
-            // alternatively make call an explicit local method...
-            }
+        void initDates() const;
+        void performSimulations() const;
+        /* Splits the simulations in the given number of blocks, each drawing
+        its own share of the samples; results do not depend on the split. */
+        void performSimulations(Size nBlocks) const;
+
+        /* Method to access simulation results. PerformCalculations should
+        have been called. Detaches the statistics access from the way the
+        simulations are stored.
+        */
+        SimEvents getSim(const Size iSim) const {
+            const simEvent_type* events =
+                simsBuffer_.empty() ? 0 : &simsBuffer_[0];
+            return SimEvents(events + simsIndex_[iSim],
+                             events + simsIndex_[iSim+1]);
         }
 
-        /* Method to access simulation results and avoiding a copy of
-        each thread results buffer. PerformCalculations should have been called.
-        Here in the monothread version this method is redundant/trivial but
-        serves to detach the statistics access to the way the simulations are
-        stored.
+        /*! Number of whole days after the evaluation date before the default
+        of the name, given the simulated probability of its default. The
+        latter must not exceed the probability at the maximum horizon.
         */
-        const std::vector<simEvent<derivedRandomLM<copulaPolicy, USNG> > >&
-            getSim(const Size iSim) const { return simsBuffer_[iSim]; }
+        Size defaultDay(Size iName, Probability p) const {
+            // first day on which the probability is reached; the default
+            //   took place during the previous one.
+            const std::vector<Probability>& ps = dailyDefaultPs_[iName];
+            Size day = static_cast<Size>(
+                std::lower_bound(ps.begin(), ps.end(), p) - ps.begin());
+            return day == 0 ? 0 : day - 1;
+        }
 
         /* Allows statistics to be written generically for fixed and random
         recovery rates. */
@@ -212,18 +246,106 @@ namespace QuantLib {
 
         const Size nSims_;
 
-        mutable std::vector<std::vector<simEvent<derivedRandomLM<copulaPolicy,
-            USNG > > > > simsBuffer_;
+        // Events of all simulations; those of the i-th one lie in
+        //   [simsIndex_[i], simsIndex_[i+1]).
+        mutable std::vector<simEvent_type> simsBuffer_;
+        mutable std::vector<Size> simsIndex_;
 
         mutable copulaPolicy copula_;
-        mutable boost::shared_ptr<copulaRNG_type> copulasRng_;
 
         // Maximum time inversion horizon
         static const Size maxHorizon_ = 4050; // over 11 years
-        // Inversion probability limits are computed by children in initdates()
+        // Default probabilities of each name on each day after the
+        //   evaluation date, up to the maximum horizon; the last one is the
+        //   probability limit for a default to be simulated.
+        mutable std::vector<std::vector<Probability> > dailyDefaultPs_;
     };
 
 
+    template<template <class, class> class D, class C, class URNG>
+    void RandomLM<D, C, URNG>::initDates() const {
+        const Date today = Settings::instance().evaluationDate();
+        const boost::shared_ptr<Pool>& pool = basket_->pool();
+        const std::vector<DefaultProbKey> defaultKeys = basket_->defaultKeys();
+
+        dailyDefaultPs_.resize(basket_->size());
+        for(Size iName=0; iName < basket_->size(); ++iName) {//use'live'
+            const Handle<DefaultProbabilityTermStructure>& dfts =
+                pool->get(pool->names()[iName]).
+                    defaultProbability(defaultKeys[iName]);
+            const Date curveRef = dfts->referenceDate();
+            std::vector<Probability>& ps = dailyDefaultPs_[iName];
+            ps.resize(maxHorizon_+1);
+            for(Size day=0; day <= maxHorizon_; ++day) {
+                Date d = today + Period(static_cast<Integer>(day), Days);
+                // no defaults before the curve reference date
+                ps[day] = d < curveRef ? 0. :
+                    dfts->defaultProbability(d, true);
+            }
+        }
+    }
+
+
+    template<template <class, class> class D, class C, class URNG>
+    void RandomLM<D, C, URNG>::performSimulations() const {
+        Size nBlocks = 1;
+        #ifdef _OPENMP
+        nBlocks = omp_get_max_threads();
+        #endif
+        performSimulations(nBlocks);
+    }
+
+
+    template<template <class, class> class D, class C, class URNG>
+    void RandomLM<D, C, URNG>::performSimulations(Size nBlocks) const {
+        nBlocks = std::max<Size>(std::min(nBlocks, nSims_), 1);
+
+        simsIndex_.assign(nSims_+1, 0);
+        std::vector<std::vector<simEvent_type> > blockEvents(nBlocks);
+        std::vector<std::string> errors(nBlocks);
+
+        #pragma omp parallel for
+        for(Size iBlock=0; iBlock < nBlocks; iBlock++) {
+            try {
+                const Size first = iBlock * nSims_ / nBlocks,
+                    last = (iBlock + 1) * nSims_ / nBlocks;
+                // the copula sampler is not thread safe, each block uses its
+                //   own, positioned at the first simulation of the block.
+                copulaRNG_type copulasRng(copula_, seed_);
+                copulasRng.skip(first);
+                std::vector<simEvent_type>& events = blockEvents[iBlock];
+                for(Size iSim=first; iSim < last; iSim++) {
+                    static_cast<const D<C, URNG>* >(this)->nextSample(
+                        copulasRng.nextSequence().value, events);
+                    // block-relative for now
+                    simsIndex_[iSim+1] = events.size();
+                }
+            } catch (std::exception& e) {
+                errors[iBlock] = e.what();
+            }
+        }
+        for(Size iBlock=0; iBlock < nBlocks; iBlock++)
+            QL_REQUIRE(errors[iBlock].empty(), errors[iBlock]);
+
+        Size nEvents = 0;
+        for(Size iBlock=0; iBlock < nBlocks; iBlock++)
+            nEvents += blockEvents[iBlock].size();
+        simsBuffer_.clear();
+        simsBuffer_.reserve(nEvents);
+        for(Size iBlock=0; iBlock < nBlocks; iBlock++) {
+            const Size first = iBlock * nSims_ / nBlocks,
+                last = (iBlock + 1) * nSims_ / nBlocks;
+            const Size offset = simsBuffer_.size();
+            for(Size iSim=first; iSim < last; iSim++)
+                simsIndex_[iSim+1] += offset;
+            simsBuffer_.insert(simsBuffer_.end(), blockEvents[iBlock].begin(),
+                blockEvents[iBlock].end());
+            // release memory as we go
+            std::vector<simEvent_type>().swap(blockEvents[iBlock]);
+        }
+    }
+
+
     /* ---- Statistics ---------------------------------------------------  */
 
     template<template <class, class> class D, class C, class URNG>
@@ -242,8 +364,7 @@ namespace QuantLib {
         Real counts = 0.;
         for(Size iSim=0; iSim < nSims_; iSim++) {
             Size simCount = 0;
-            const std::vector<simEvent<D<C, URNG> > >& events =
-                getSim(iSim);
+            const SimEvents events = getSim(iSim);
             for(Size iEvt=0; iEvt < events.size(); iEvt++)
                 // duck type on the members:
                 if(val > events[iEvt].dayFromRef) simCount++;
@@ -270,7 +391,7 @@ namespace QuantLib {
 
         std::vector<Probability> hitsByDate(basketSize, 0.);
         for(Size iSim=0; iSim < nSims_; iSim++) {
-            const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
+            const SimEvents events = getSim(iSim);
             std::map<unsigned short, unsigned short> namesDefaulting;
             for(Size iEvt=0; iEvt < events.size(); iEvt++) {
                 // if event is within time horizon...
@@ -314,7 +435,7 @@ namespace QuantLib {
         Real expectedDefi = 0.;
         Real expectedDefj = 0.;
         for(Size iSim=0; iSim < nSims_; iSim++) {
-            const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
+            const SimEvents events = getSim(iSim);
             Real imatch = 0., jmatch = 0.;
             for(Size iEvt=0; iEvt < events.size(); iEvt++) {
                 if((val > events[iEvt].dayFromRef) &&
@@ -356,9 +477,10 @@ namespace QuantLib {
         Real detachAmount = basket_->detachmentAmount();
 
         // Real trancheLoss= 0.;
-        GeneralStatistics lossStats;
+        // only the mean and its error are needed, no sample is stored
+        IncrementalStatistics lossStats;
         for(Size iSim=0; iSim < nSims_; iSim++) {
-            const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
+            const SimEvents events = getSim(iSim);
 
             Real portfSimLoss=0.;
             for(Size iEvt=0; iEvt < events.size(); iEvt++) {
@@ -403,8 +525,7 @@ namespace QuantLib {
     template<template <class, class> class D, class C, class URNG>
     Histogram RandomLM<D, C, URNG>::computeHistogram(const Date& d) const {
         std::vector<Real> data;
-        std::set<Real> keys;// attainable loss values
-        keys.insert(0.);
+        data.reserve(nSims_);
         Date today = Settings::instance().evaluationDate();
         BigInteger val = d.serialNumber() - today.serialNumber();
         // redundant test? should have been tested by the basket caller?
@@ -416,7 +537,7 @@ namespace QuantLib {
         Real detachAmount = basket_->detachmentAmount();
 
         for(Size iSim=0; iSim < nSims_; iSim++) {
-            const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
+            const SimEvents events = getSim(iSim);
 
             Real portfSimLoss=0.;
             for(Size iEvt=0; iEvt < events.size(); iEvt++) {
@@ -433,7 +554,6 @@ namespace QuantLib {
             }
             data.push_back(std::min(std::max(portfSimLoss - attachAmount, 0.),
                 detachAmount - attachAmount));
-            keys.insert(data.back());
         }
         // avoid using as many points as in the simulation.
         Size nPts = std::min<Size>(data.size(), 150);// fix
@@ -458,8 +578,9 @@ namespace QuantLib {
 
         //GenericRiskStatistics<GeneralStatistics> statsX;
         std::vector<Real> losses;
+        losses.reserve(nSims_);
         for(Size iSim=0; iSim < nSims_; iSim++) {
-            const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
+            const SimEvents events = getSim(iSim);
             Real portfSimLoss=0.;
             for(Size iEvt=0; iEvt < events.size(); iEvt++) {
                 if(val > static_cast<BigInteger>(events[iEvt].dayFromRef)) {
@@ -547,10 +668,11 @@ namespace QuantLib {
         Real detachAmount = basket_->detachmentAmount();
 
         std::vector<Real> rankLosses;
+        rankLosses.reserve(nSims_);
         Date today = Settings::instance().evaluationDate();
         BigInteger val = d.serialNumber() - today.serialNumber();
         for(Size iSim=0; iSim < nSims_; iSim++) {
-            const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
+            const SimEvents events = getSim(iSim);
             Real portfSimLoss=0.;
             for(Size iEvt=0; iEvt < events.size(); iEvt++) {
                 if(val > static_cast<BigInteger>(events[iEvt].dayFromRef)) {
@@ -647,13 +769,14 @@ namespace QuantLib {
         Size numLiveNames = basket_->remainingSize();
 
         std::vector<Real> split(numLiveNames, 0.);
-        std::vector<GeneralStatistics> splitStats(numLiveNames,
-            GeneralStatistics());
+        // one accumulator per name, they must not store the samples
+        std::vector<IncrementalStatistics> splitStats(numLiveNames,
+            IncrementalStatistics());
         Date today = Settings::instance().evaluationDate();
         BigInteger val = date.serialNumber() - today.serialNumber();
 
         for(Size iSim=0; iSim < nSims_; iSim++) {
-            const std::vector<simEvent<D<C, URNG> > >& events = getSim(iSim);
+            const SimEvents events = getSim(iSim);
             Real portfSimLoss=0.;
             //std::vector<Real> splitBuffer(numLiveNames_, 0.);
             std::vector<simEvent<D<C, URNG> > > splitEventsBuffer;
@@ -812,40 +935,43 @@ namespace QuantLib {
         // \todo Consider this to be only a ConstantLossLM instead
         const boost::shared_ptr<DefaultLatentModel<copulaPolicy> > copula_;
         const std::vector<Real> recoveries_;
-        // for time inversion:
-        Real accuracy_;
     public:
         // \todo: Allow a constructor building its own default latent model.
+        /*! \deprecated the accuracy argument is no longer used, since
+                        default times are tabulated instead of inverted;
+                        it will be removed in a future release.
+        */
         RandomDefaultLM(
             const boost::shared_ptr<DefaultLatentModel<copulaPolicy> >& copula,
             const std::vector<Real>& recoveries = std::vector<Real>(),
             Size nSims = 0,// stats will crash on div by zero, FIX ME.
-            Real accuracy = 1.e-6,
+            Real /* accuracy */ = 1.e-6,
             BigNatural seed = 2863311530)
         : RandomLM< ::QuantLib::RandomDefaultLM, copulaPolicy, USNG>
             (copula->numFactors(), copula->size(), copula->copula(),
                 nSims, seed ),
           copula_(copula), //<- renmae to latentModel_ or defautlLM_;
           recoveries_(recoveries.size()==0 ? std::vector<Real>(copula->size(),
-            0.) : recoveries),
-          accuracy_(accuracy)
+            0.) : recoveries)
         {
             // redundant through basket?
             this->registerWith(Settings::instance().evaluationDate());
             this->registerWith(copula_);
         }
+        /*! \deprecated the accuracy argument is no longer used; it will
+                        be removed in a future release.
+        */
         RandomDefaultLM(
             const boost::shared_ptr<ConstantLossLatentmodel<copulaPolicy> >&
                 copula,
             Size nSims = 0,// stats will crash on div by zero, FIX ME.
-            Real accuracy = 1.e-6,
+            Real /* accuracy */ = 1.e-6,
             BigNatural seed = 2863311530)
         : RandomLM< ::QuantLib::RandomDefaultLM, copulaPolicy, USNG>
             (copula->numFactors(), copula->size(), copula->copula(),
                 nSims, seed ),
           copula_(copula),
-          recoveries_(copula->recoveries()),
-          accuracy_(accuracy)
+          recoveries_(copula->recoveries())
         {
             // redundant through basket?
             this->registerWith(Settings::instance().evaluationDate());
@@ -865,21 +991,10 @@ namespace QuantLib {
         */
         friend class RandomLM< ::QuantLib::RandomDefaultLM, copulaPolicy, USNG>;
     protected:
-        void nextSample(const std::vector<Real>& values) const;
-        void initDates() const {
-            /* Precalculate horizon time default probabilities (used to
-              determine if the default took place and subsequently compute its
-              event time)
-            */
-            Date today = Settings::instance().evaluationDate();
-            Date maxHorizonDate = today  + Period(this->maxHorizon_, Days);
-
-            const boost::shared_ptr<Pool>& pool = this->basket_->pool();
-            for(Size iName=0; iName < this->basket_->size(); ++iName)//use'live'
-                horizonDefaultPs_.push_back(pool->get(pool->names()[iName]).
-                    defaultProbability(this->basket_->defaultKeys()[iName])
-                        ->defaultProbability(maxHorizonDate, true));
-        }
+        /* Appends the events of the simulation to the buffer. Called
+        concurrently, it must not modify the model. */
+        void nextSample(const std::vector<Real>& values,
+                        std::vector<defaultSimEvent>& events) const;
         Real getEventRecovery(const defaultSimEvent& evt) const {
             return recoveries_[evt.nameIdx];
         }
@@ -911,11 +1026,6 @@ namespace QuantLib {
             // invalidate current calculations if any and notify observers
             LazyObject::update();
         }
-        // This one and the buffer might be moved to the parent, only some
-        //   dates might be specific to a particular model.
-        // Default probabilities for each name at the time of the maximun
-        //   horizon date. Cached for perf.
-        mutable std::vector<Probability> horizonDefaultPs_;
     };
 
 
@@ -924,40 +1034,19 @@ namespace QuantLib {
 
     template<class C, class URNG>
     void RandomDefaultLM<C, URNG>::nextSample(
-        const std::vector<Real>& values) const
+        const std::vector<Real>& values,
+        std::vector<defaultSimEvent>& events) const
     {
-        const boost::shared_ptr<Pool>& pool = this->basket_->pool();
-        // starts with no events
-        this->simsBuffer_.push_back(std::vector<defaultSimEvent> ());
-
         for(Size iName=0; iName<copula_->size(); iName++) {
             Real latentVarSample =
                 copula_->latentVarValue(values, iName);
             Probability simDefaultProb =
                copula_->cumulativeY(latentVarSample, iName);
             // If the default simulated lies before the max date:
-            if (horizonDefaultPs_[iName] >= simDefaultProb) {
-                const Handle<DefaultProbabilityTermStructure>& dfts =
-                    pool->get(pool->names()[iName]).// use 'live' names
-                    defaultProbability(this->basket_->defaultKeys()[iName]);
-                // compute and store default time with respect to the
-                //  curve ref date:
-                Size dateSTride =
-                    static_cast<Size>(Brent().solve(// casted from Real:
-                        detail::Root(dfts, simDefaultProb),
-                            accuracy_,0.,1.));
-                   /*
-                   // value if one approximates to a flat HR;
-                   //   faster (>x2) but it introduces an error:..
-                   // \todo: see how to include this 'polymorphically'.
-                   // While not the case in pricing in risk metrics/real
-                   //   probabilities the curves are often flat
-                    static_cast<Size>(ceil(maxHorizon_ *
-                                        std::log(1.-simDefaultProb)
-                    /std::log(1.-data_.horizonDefaultPs_[iName])));
-                   */
-                this->simsBuffer_.back().push_back(defaultSimEvent(iName,
-                    dateSTride));
+            if (this->dailyDefaultPs_[iName].back() >= simDefaultProb) {
+                // store default time with respect to today's date:
+                Size dateSTride = this->defaultDay(iName, simDefaultProb);
+                events.push_back(defaultSimEvent(iName, dateSTride));
                //emplace_back
             }
         /* Used to remove sims with no events. Uses less memory, faster
@@ -73,19 +73,21 @@ namespace QuantLib {
         typedef simEvent<RandomLossLM> defaultSimEvent;
 
         const boost::shared_ptr<SpotRecoveryLatentModel<copulaPolicy> > copula_;
-        // for time inversion:
-        Real accuracy_;
     public:
+        /*! \deprecated the accuracy argument is no longer used, since
+                        default times are tabulated instead of inverted;
+                        it will be removed in a future release.
+        */
         RandomLossLM(
             const boost::shared_ptr<SpotRecoveryLatentModel<copulaPolicy> >& 
                 copula,
             Size nSims = 0,
-            Real accuracy = 1.e-6, 
+            Real /* accuracy */ = 1.e-6,
             BigNatural seed = 2863311530)
         : RandomLM< ::QuantLib::RandomLossLM, copulaPolicy, USNG>
             (copula->numFactors(), copula->size(), copula->copula(), 
                 nSims, seed),
-          copula_(copula), accuracy_(accuracy)
+          copula_(copula)
     {
         // redundant through basket?
         this->registerWith(Settings::instance().evaluationDate());
@@ -100,23 +102,10 @@ namespace QuantLib {
         */
         friend class RandomLM< ::QuantLib::RandomLossLM, copulaPolicy, USNG>;
     protected:
-        void nextSample(const std::vector<Real>& values) const;
-
         // see note on randomdefaultlatentmodel
-        void initDates() const {
-            /* Precalculate horizon time default probabilities (used to 
-              determine if the default took place and subsequently compute its 
-              event time)
-            */
-            Date today = Settings::instance().evaluationDate();
-            Date maxHorizonDate = today  + Period(this->maxHorizon_, Days);
+        void nextSample(const std::vector<Real>& values,
+                        std::vector<defaultSimEvent>& events) const;
 
-            const boost::shared_ptr<Pool>& pool = this->basket_->pool();
-            for(Size iName=0; iName < this->basket_->size(); ++iName)//use'live'
-                horizonDefaultPs_.push_back(pool->get(pool->names()[iName]).
-                    defaultProbability(this->basket_->defaultKeys()[iName])
-                        ->defaultProbability(maxHorizonDate, true));
-        }
        Real getEventRecovery(const defaultSimEvent& evt) const {
             return evt.recovery();
         }
@@ -142,9 +131,6 @@ namespace QuantLib {
             // invalidate current calculations if any and notify observers
             LazyObject::update();
         }
-        // Default probabilities for each name at the time of the maximun 
-        //   horizon date. Cached for perf.
-        mutable std::vector<Probability> horizonDefaultPs_;
     };
 
 
@@ -153,11 +139,9 @@ namespace QuantLib {
 
     template<class C, class URNG>
     void RandomLossLM<C, URNG>::nextSample(
-        const std::vector<Real>& values) const 
+        const std::vector<Real>& values,
+        std::vector<defaultSimEvent>& events) const 
     {
-        const boost::shared_ptr<Pool>& pool = this->basket_->pool();
-        this->simsBuffer_.push_back(std::vector<defaultSimEvent> ());
-
         // half the model is defaults, the other half are RRs...
         for(Size iName=0; iName<copula_->size()/2; iName++) {
             // ...but samples must be full
@@ -173,44 +157,19 @@ namespace QuantLib {
             Probability simDefaultProb = 
                 copula_->cumulativeY(latentVarSample, iName);
             // If the default simulated lies before the max date:
-            if (horizonDefaultPs_[iName] >= simDefaultProb) {
-                const Handle<DefaultProbabilityTermStructure>& dfts = 
-                    pool->get(pool->names()[iName]).  // use 'live' names
-                    defaultProbability(this->basket_->defaultKeys()[iName]);
-                // compute and store default time with respect to the 
-                //  curve ref date:
-                Size dateSTride =
-                    static_cast<Size>(Brent().solve(// casted from Real:
-                    detail::Root(dfts, simDefaultProb), accuracy_, 0., 1.));
-                /*
-                // value if one approximates to a flat HR; 
-                //   faster (>x2) but it introduces an error:..
-                // \todo: see how to include this 'polymorphically'. While
-                //   not the case in pricing in risk metrics/real  
-                //   probabilities the curves are often flat
-                static_cast<Size>(ceil(maxHorizon_ * 
-                                    std::log(1.-simDefaultProb)
-                /std::log(1.-data_.horizonDefaultPs_[iName])));
-                */
+            if (this->dailyDefaultPs_[iName].back() >= simDefaultProb) {
+                // store default time with respect to today's date:
+                Size dateSTride = this->defaultDay(iName, simDefaultProb);
                 // Determine the realized recovery rate:
-                /* For this; 'conditionalRecovery' needs to compute the pdef on 
-                the realized def event date from the simulation. Yet, this might
-                have fallen between todays date and the default TS reference 
-                date(usually a two day gap) To avoid requesting a negative time
-                probability the date is moved to the TS date 
-                Unless the gap is ridiculous this has no practical effect for 
-                the RR value*/
-                Date today = Settings::instance().evaluationDate();
-                Date eventDate = today+Period(static_cast<Integer>(dateSTride), 
-                    Days);
-                if(eventDate<dfts->referenceDate()) 
-                    eventDate = dfts->referenceDate();
+                /* For this; 'conditionalRecovery' needs the pdef on the
+                realized def event date from the simulation; the one at the
+                end of the default day is used, it is never null.*/
                 Real latentRRVarSample = 
                     copula_->latentRRVarValue(values, iName);
                 Real recovery = 
-                    copula_->conditionalRecovery(latentRRVarSample,
-                        iName, eventDate);
-                this->simsBuffer_.back().push_back(
+                    copula_->conditionalRecoveryP(latentRRVarSample,
+                        iName, this->dailyDefaultPs_[iName][dateSTride+1]);
+                events.push_back(
                   defaultSimEvent(iName, dateSTride, recovery));
                 //emplace_back
             }
@@ -45,12 +45,13 @@ namespace QuantLib {
         Notice that using copulas other than Gaussian it is only an
         approximation (see remark on p.68).
 
+        The conditional distributions are stored densely in loss units, so
+        that each name is added to them in place and in linear time.
+
         \todo Make the loss unit equal to some small fraction depending on the
         portfolio loss weights (notionals and recoveries). As it is now this
         is ok for pricing but not for risk metrics. See the discussion in O'Kane
         18.3.2
-        \todo Intengrands should all use the inverted probabilities for 
-        performance instead of calling the copula inversion with the same vals.
     */
     template<class copulaPolicy> 
     class RecursiveLossModel : public DefaultLossModel {
@@ -61,29 +62,29 @@ namespace QuantLib {
             Size nbuckets  = 1)
         : copula_(m), nBuckets_(nbuckets), wk_() { }
       private:
-          /*!
-          @param pDefDate Vector of unconditional default probabilities for each
-          live name (at the current evaluation date). This is passed instead of 
-          the date for performance reasons (if in the future other magnitudes 
-          -e.g. lgd- are contingent on the date they shouldd be passed too).
+          /*! Conditional loss distribution in loss units; the buffer is
+          resized and overwritten.
+          @param invpDefDate Vector of the inverted unconditional default
+          probabilities for each live name (at the current evaluation date).
+          This is passed instead of the date for performance reasons (if in
+          the future other magnitudes -e.g. lgd- are contingent on the date
+          they shouldd be passed too).
           */
-        Disposable<std::map<Real, Probability> > conditionalLossDistrib(
-            const std::vector<Probability>& pDefDate, 
-            const std::vector<Real>& mktFactor) const;
-        Real expectedConditionalLoss(const std::vector<Probability>& pDefDate, //<< never used!!
-            const std::vector<Real>& mktFactor) const;
+        void conditionalLossDistrib(const std::vector<Real>& invpDefDate,
+                                    const std::vector<Real>& mktFactor,
+                                    std::vector<Probability>& distrib) const;
+        Real expectedConditionalLoss(const std::vector<Real>& invpDefDate,
+                                     const std::vector<Real>& mktFactor) const;
         Disposable<std::vector<Real> > conditionalLossProb(
-            const std::vector<Probability>& pDefDate, 
-            //const Date& date,
+            const std::vector<Real>& invpDefDate,
             const std::vector<Real>& mktFactor) const;
-        //versions using the P-inverse, deprecate the former
-        Disposable<std::map<Real, Probability> > conditionalLossDistribInvP(
-            const std::vector<Real>& pDefDate, 
-            //const Date& date,
-            const std::vector<Real>& mktFactor) const;
-        Real expectedConditionalLossInvP(const std::vector<Real>& pDefDate, 
-            //const Date& date,
+        Disposable<std::vector<Real> > expectedConditionalLosses(
+            const std::vector<std::vector<Real> >& invpDefDates,
             const std::vector<Real>& mktFactor) const;
+        //! expected tranche loss of a conditional loss distribution
+        Real expectedLoss(const std::vector<Probability>& distrib) const;
+        Disposable<std::vector<Real> > invertedProbabilities(
+            const Date& date) const;
     protected:
         void resetModel();
     public:
@@ -103,6 +104,12 @@ namespace QuantLib {
             makes it easier this way.
         */
        Real expectedTrancheLoss(const Date& date) const;
+       /*! The dates are integrated together, so that the conditional
+           distributions at each market factor value are computed in
+           parallel across dates when OpenMP is enabled.
+       */
+       Disposable<std::vector<Real> > expectedTrancheLosses(
+           const std::vector<Date>& dates) const;
        Disposable<std::vector<Real> > lossProbability(const Date& date) const;
        // REMEBER THIS HAS TO BE MOVED TO A DISTRIBUTION OBJECT.............
        Disposable<std::map<Real, Probability> > lossDistribution(
@@ -119,6 +126,8 @@ namespace QuantLib {
         const Size nBuckets_;
         mutable std::vector<Real> wk_;
         mutable Real lossUnit_;
+        // number of attainable losses in loss units, zero included
+        mutable Size lossBuckets_;
         //! name to name factor. In the single factor copula:
         //    correl = beta * beta
         // When constructing through a single correlation number the factor is
@@ -139,79 +148,74 @@ namespace QuantLib {
 
     template<class CP>
     inline Real RecursiveLossModel<CP>::expectedTrancheLoss(
-        const Date& date) const 
+        const Date& date) const
     {
-/*
-        std::map<Real, Probability> dist = lossDistribution(date);
-
-        Real expLoss = 0.;
-        std::map<Real, Probability>::iterator distIt = dist.begin();
-
-        while(distIt != dist.end()) {
-            Real loss = distIt->first * lossUnit_;
-            loss = std::max(std::min(loss, detachAmount_)-attachAmount_, 0.);
-            // MIN MAX BUGS ....??
-            expLoss += loss * distIt->second;
-            distIt++;
-        }
-        return expLoss ;
-
-
-
-
-    ///////////////////////////////////////////////////////////////////////
-
-        // calculate inverted unconditional Ps first so we save the inversion:
-        // TO DO : turn to STL algorithm code
-        std::vector<Probability> uncDefProb = 
-            basket_->remainingProbabilities(date);
-
+        std::vector<Real> invProb = invertedProbabilities(date);
         return copula_->integratedExpectedValue(
             boost::function<Real (const std::vector<Real>& v1)>(
                 boost::bind(
                     &RecursiveLossModel::expectedConditionalLoss,
                     this,
-                    boost::cref(uncDefProb),
+                    boost::cref(invProb),
                     _1)
                 )
             );
-            */
-/**/
-        std::vector<Probability> uncDefProb = 
-            basket_->remainingProbabilities(date);
-        std::vector<Real> invProb;
-        for(Size i=0; i<uncDefProb.size(); i++)
-           invProb.push_back(copula_->inverseCumulativeY(uncDefProb[i], i));
-           ///  invProb.push_back(CP::inverseCumulativeY(uncDefProb[i], i));//<-static call
+    }
+
+    template<class CP>
+    Disposable<std::vector<Real> >
+        RecursiveLossModel<CP>::expectedTrancheLosses(
+            const std::vector<Date>& dates) const
+    {
+        // integrations without vector integrands, one date at a time
+        if(dates.size() < 2 || !copula_->providesVectorIntegration())
+            return DefaultLossModel::expectedTrancheLosses(dates);
+
+        // the basket is not thread safe; the probabilities are computed
+        //   before the integration
+        std::vector<std::vector<Real> > invProbs(dates.size());
+        for(Size j=0; j<dates.size(); j++)
+            invProbs[j] = invertedProbabilities(dates[j]);
+
         return copula_->integratedExpectedValue(
-            boost::function<Real (const std::vector<Real>& v1)>(
+            boost::function<Disposable<std::vector<Real> > (
+                const std::vector<Real>& v1)>(
                 boost::bind(
-                    &RecursiveLossModel::expectedConditionalLossInvP,
+                    &RecursiveLossModel::expectedConditionalLosses,
                     this,
-                    boost::cref(invProb),
+                    boost::cref(invProbs),
                     _1)
                 )
             );
-            
     }
 
     template<class CP>
-    inline Disposable<std::vector<Real> > 
+    inline Disposable<std::vector<Real> >
         RecursiveLossModel<CP>::lossProbability(const Date& date) const {
 
-        std::vector<Probability> uncDefProb = 
-            basket_->remainingProbabilities(date);
+        std::vector<Real> invProb = invertedProbabilities(date);
         return copula_->integratedExpectedValue(
             boost::function<Disposable<std::vector<Real> > (const std::vector<Real>& v1)>(
                 boost::bind(
                     &RecursiveLossModel::conditionalLossProb,
                     this,
-                    boost::cref(uncDefProb),
+                    boost::cref(invProb),
                     _1)
                 )
             );
     }
 
+    template<class CP>
+    Disposable<std::vector<Real> >
+        RecursiveLossModel<CP>::invertedProbabilities(const Date& date) const {
+        std::vector<Probability> uncDefProb =
+            basket_->remainingProbabilities(date);
+        std::vector<Real> invProb(uncDefProb.size());
+        for(Size i=0; i<uncDefProb.size(); i++)
+            invProb[i] = copula_->inverseCumulativeY(uncDefProb[i], i);
+        return invProb;
+    }
+
     // -------------------------------------------------------------------
 
     template<class CP>
@@ -234,8 +238,12 @@ namespace QuantLib {
         lgds.erase(std::remove(lgds.begin(), lgds.end(), 0.), lgds.end());
         lossUnit_ = *(std::min_element(lgds.begin(), lgds.end()))
             / nBuckets_;
-        for(Size i=0; i<remainingBsktSize_; i++)
+        wk_.clear();
+        lossBuckets_ = 1;
+        for(Size i=0; i<remainingBsktSize_; i++) {
             wk_.push_back(std::floor(lgdsTmp[i]/lossUnit_ + .5));
+            lossBuckets_ += static_cast<Size>(wk_.back());
+        }
     }
 
     // make it return a distribution object?
@@ -326,206 +334,97 @@ namespace QuantLib {
     }
 
     template<class CP>
-    Disposable<std::map<Real, Probability> >
-        RecursiveLossModel<CP>::conditionalLossDistrib(
-            const std::vector<Probability>& pDefDate, 
-            //const Date& date,
-            const std::vector<Real>& mktFactor) const 
-    {
-        //eq. 10 p.68
-        //attainable losses distribution, recursive algorithm
-        const std::vector<Probability>& uncDefProb = pDefDate;// alias, remove
-
-        std::map<Real, Probability> pIndepDistrib;
-        ////////  K=0
-        pIndepDistrib.insert(std::make_pair(0., 1.));
-        for(Size iName=0; iName<remainingBsktSize_; iName++) {
-            Probability pDef =
-                copula_->conditionalDefaultProbability(uncDefProb[iName], iName,
-                                                mktFactor);
-            ////// iterate on all possible losses in the distribution:
-            std::map<Real, Probability> pDistTemp;
-            std::map<Real, Probability>::iterator distIt =
-                pIndepDistrib.begin();
-            while(distIt != pIndepDistrib.end()) {
-              ///   update prob if this name does not default
-                std::map<Real, Probability>::iterator matchIt
-                    = pDistTemp.find(distIt->first);
-                if(matchIt != pDistTemp.end()) {
-                    matchIt->second += distIt->second * (1.-pDef);
-                }else{
-                    pDistTemp.insert(std::make_pair(distIt->first,
-                        distIt->second * (1.-pDef)));
-                }
-              ////   and if it does
-                matchIt = pDistTemp.find(distIt->first + wk_[iName]);
-                if(matchIt != pDistTemp.end()) {
-                    matchIt->second += distIt->second * pDef;
-                }else{
-                    pDistTemp.insert(std::make_pair(
-                        distIt->first+wk_[iName], distIt->second * pDef));
-                }
-                distIt++;
-            }
-           /////  copy back
-            pIndepDistrib = pDistTemp;
-        }
-        /* Apply tranche limits now .... mind you this could be done outside*/
-        ////  to be done....
-        return pIndepDistrib;
-    }
-
-    template<class CP>
-    Disposable<std::map<Real, Probability> >
-        // twice?! rewrite one in terms of the other, this is a duplicate!
-        RecursiveLossModel<CP>::conditionalLossDistribInvP(
-            const std::vector<Real>& invpDefDate, 
-            //const Date& date,
-            const std::vector<Real>& mktFactor) const 
+    void RecursiveLossModel<CP>::conditionalLossDistrib(
+                                    const std::vector<Real>& invpDefDate,
+                                    const std::vector<Real>& mktFactor,
+                                    std::vector<Probability>& distrib) const
     {
         // eq. 10 p.68
         // attainable losses distribution, recursive algorithm
-
-        std::map<Real, Probability> pIndepDistrib;
+        distrib.assign(lossBuckets_, 0.);
         // K=0
-        pIndepDistrib.insert(std::make_pair(0., 1.));
+        distrib[0] = 1.;
+        Size maxLoss = 0;
         for(Size iName=0; iName<remainingBsktSize_; iName++) {
             Probability pDef =
-                copula_->conditionalDefaultProbabilityInvP(invpDefDate[iName], 
+                copula_->conditionalDefaultProbabilityInvP(invpDefDate[iName],
                     iName, mktFactor);
-
-            // iterate on all possible losses in the distribution:
-            std::map<Real, Probability> pDistTemp;
-            std::map<Real, Probability>::iterator distIt =
-                pIndepDistrib.begin();
-            while(distIt != pIndepDistrib.end()) {
-                // update prob if this name does not default
-                std::map<Real, Probability>::iterator matchIt
-                    = pDistTemp.find(distIt->first);
-                if(matchIt != pDistTemp.end()) {
-                    matchIt->second += distIt->second * (1.-pDef);
-                }else{
-                    pDistTemp.insert(std::make_pair(distIt->first,
-                        distIt->second * (1.-pDef)));
-                }
-                // and if it does
-                matchIt = pDistTemp.find(distIt->first + wk_[iName]);
-                if(matchIt != pDistTemp.end()) {
-                    matchIt->second += distIt->second * pDef;
-                }else{
-                    pDistTemp.insert(std::make_pair(
-                        distIt->first+wk_[iName], distIt->second * pDef));
-                }
-                distIt++;
+            const Size wk = static_cast<Size>(wk_[iName]);
+            if(wk == 0) continue;
+            // in place and downwards, each loss is moved up by this name's
+            //   loss before being updated itself
+            for(Size k=maxLoss+1; k-- > 0; ) {
+                distrib[k+wk] += distrib[k] * pDef;
+                distrib[k] *= 1.-pDef;
             }
-            // copy back
-            pIndepDistrib = pDistTemp;
+            maxLoss += wk;
         }
-        /* Apply tranche limits now .... mind you this could be done outside*/
-        return pIndepDistrib;
     }
 
-
-
-
-    /*
-    Bugs here???. The max min on the tranche looks 
-    wrong. It is better to have a tranche function since that way we can avoid 
-    adding up losses over all the posible losses rather than just over the 
-    tranche limits.
-    */
-    //! Portfolio loss conditional to the market factor value
     template<class CP>
-    Real RecursiveLossModel<CP>::expectedConditionalLoss(
-        const std::vector<Probability>& pDefDate, 
-        //const Date& date,
-        const std::vector<Real>& mktFactor) const 
-    {
-        std::map<Real, Probability> pIndepDistrib =
-            conditionalLossDistrib(pDefDate, mktFactor);
-
-        // get the expected value subject to the value of the market
-        //   factor.
+    Real RecursiveLossModel<CP>::expectedLoss(
+                              const std::vector<Probability>& distrib) const {
         Real expLoss = 0.;
-        //---------------------------------------------------------------
-        /* This is the original (easy to read) loop which I have partially
-             unroll below to take profit of the fact that once we go over
-             the tranche top the loss amount is fixed:
-        */
-        std::map<Real, Probability>::iterator distIt =
-            pIndepDistrib.begin();
-
-        while(distIt != pIndepDistrib.end()) {
-            Real loss = distIt->first * lossUnit_;
-     //       loss = std::max(std::min(loss, detachAmount_)-attachAmount_, 0.);
+        for(Size k=0; k<distrib.size(); k++) {
+            Real loss = k * lossUnit_;
             loss = std::min(std::max(loss - attachAmount_, 0.), 
                 detachAmount_ - attachAmount_);
-            // MIN MAX BUGS ....??
-            expLoss += loss * distIt->second;
-            distIt++;
+            expLoss += loss * distrib[k];
         }
-        return expLoss ;
+        return expLoss;
     }
 
+    //! Portfolio loss conditional to the market factor value
     template<class CP>
-    // again, I am duplicating code.
-    Real RecursiveLossModel<CP>::expectedConditionalLossInvP(
+    Real RecursiveLossModel<CP>::expectedConditionalLoss(
                                  const std::vector<Real>& invPDefDate, 
-                                 //const Date& date,
                                  const std::vector<Real>& mktFactor) const 
     {
-        std::map<Real, Probability> pIndepDistrib =
-            conditionalLossDistribInvP(invPDefDate, mktFactor);
-
-        // get the expected value subject to the value of the market
-        //   factor.
-        Real expLoss = 0.;
-        //---------------------------------------------------------------
-        /* This is the original (easy to read) loop which I have partially
-             unroll below to take profit of the fact that once we go over
-             the tranche top the loss amount is fixed:
-        */
-        std::map<Real, Probability>::iterator distIt =
-            pIndepDistrib.begin();
+        std::vector<Probability> distrib;
+        conditionalLossDistrib(invPDefDate, mktFactor, distrib);
+        return expectedLoss(distrib);
+    }
 
-        while(distIt != pIndepDistrib.end()) {
-            Real loss = distIt->first * lossUnit_;
-   //         loss = std::max(std::min(loss, detachAmount_)-attachAmount_, 0.);
-            loss = std::min(std::max(loss - attachAmount_, 0.), 
-                detachAmount_ - attachAmount_);
-            // MIN MAX BUGS ....???
-            expLoss += loss * distIt->second;
-            distIt++;
+    template<class CP>
+    Disposable<std::vector<Real> >
+        RecursiveLossModel<CP>::expectedConditionalLosses(
+            const std::vector<std::vector<Real> >& invPDefDates,
+            const std::vector<Real>& mktFactor) const
+    {
+        std::vector<Real> losses(invPDefDates.size());
+        std::vector<std::string> messages(invPDefDates.size());
+
+        #pragma omp parallel
+        {
+            // one distribution buffer per thread
+            std::vector<Probability> distrib(lossBuckets_);
+            #pragma omp for
+            for(Size j=0; j<invPDefDates.size(); j++) {
+                try {
+                    conditionalLossDistrib(invPDefDates[j], mktFactor,
+                                           distrib);
+                    losses[j] = expectedLoss(distrib);
+                } catch (std::exception& e) {
+                    messages[j] = e.what();
+                }
+            }
         }
-        return expLoss ;
+
+        for(Size j=0; j<messages.size(); j++)
+            QL_REQUIRE(messages[j].empty(), messages[j]);
+        return losses;
     }
 
     template<class CP>
     Disposable<std::vector<Real> > RecursiveLossModel<CP>::conditionalLossProb(
-        const std::vector<Probability>& pDefDate, 
-        //const Date& date,
+        const std::vector<Real>& invPDefDate, 
         const std::vector<Real>& mktFactor) const 
     {
-        std::map<Real, Probability> pIndepDistrib =
-            conditionalLossDistrib(pDefDate, mktFactor);
-
-        std::vector<Real> results;
-        std::map<Real, Probability>::iterator distIt = pIndepDistrib.begin();
-        while(distIt != pIndepDistrib.end()) {
-            //Real loss = distIt->first * loss_unit_
-            //                    ;
-            //loss = std::max(std::min(loss,
-            //    results_.xMax)-results_.xMin, 0.);
-            //expLoss += loss * distIt->second;
-
-            results.push_back(distIt->second);
-             distIt++;
-       }
-        return results;
+        std::vector<Probability> distrib;
+        conditionalLossDistrib(invPDefDate, mktFactor, distrib);
+        return distrib;
     }
 
-
-
 }
 
 #endif
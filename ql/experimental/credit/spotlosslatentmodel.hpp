@@ -103,6 +103,11 @@ namespace QuantLib {
         */
         Real conditionalRecovery(Real latentVarSample, Size iName, 
             const Date& d) const;
+        /*! Same as above, given the unconditional default probability of
+            the name on the date; does not access the term structures.
+        */
+        Real conditionalRecoveryP(Real latentVarSample, Size iName, 
+            Probability pdef) const;
         /*! Due to the way the latent model is splitted in two parts, we call 
         the base class for the default sample and the LM owned here for the RR 
         model sample. This sample only makes sense if it led to a default.
@@ -263,7 +268,14 @@ namespace QuantLib {
         const Handle<DefaultProbabilityTermStructure>& dfts = 
             pool->get(basket_->names()[iName]).defaultProbability(
                 basket_->defaultKeys()[iName]);
-        const Probability pdef = dfts->defaultProbability(d, true);
+        return conditionalRecoveryP(latentVarSample, iName,
+            dfts->defaultProbability(d, true));
+    }
+
+    template<class CP>
+    Real SpotRecoveryLatentModel<CP>::conditionalRecoveryP(
+        Real latentVarSample, Size iName, Probability pdef) const 
+    {
         // before asking for -\infty
         if (pdef < 1.e-10) return 0.;
 
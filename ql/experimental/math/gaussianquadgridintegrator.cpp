@@ -0,0 +1,173 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/experimental/math/gaussianquadgridintegrator.hpp>
+#include <ql/math/integrals/gaussianquadratures.hpp>
+#include <map>
+
+namespace QuantLib {
+
+    namespace {
+
+        struct Rule {
+            Array x, w;
+        };
+
+        // Gauss-Hermite rule for the weight exp(-x^2/2), with the
+        // weight divided out as in GaussianQuadrature
+        Rule gaussHermiteRule(Size order) {
+            GaussHermiteIntegration integration(order);
+            Rule rule;
+            rule.x = integration.x()*M_SQRT2;
+            rule.w = integration.weights()*M_SQRT2;
+            // the central node is zero; making it exactly so lets the
+            // rules of different orders share it in the sparse grid
+            if (order % 2 == 1)
+                rule.x[order/2] = 0.0;
+            return rule;
+        }
+
+        typedef std::map<std::vector<Real>, Real> NodeMap;
+
+        // adds c times the tensor product of the given rules
+        void addTensorProduct(const std::vector<const Rule*>& rules,
+                              Real c, NodeMap& nodes) {
+            const Size d = rules.size();
+            std::vector<Size> j(d, 0);
+            std::vector<Real> x(d);
+            for (;;) {
+                Real w = c;
+                for (Size k=0; k<d; ++k) {
+                    x[k] = rules[k]->x[j[k]];
+                    w *= rules[k]->w[j[k]];
+                }
+                nodes[x] += w;
+
+                Size k = 0;
+                while (k < d && ++j[k] == rules[k]->x.size())
+                    j[k++] = 0;
+                if (k == d)
+                    break;
+            }
+        }
+
+        Real binomialCoefficient(Size n, Size k) {
+            Real c = 1.0;
+            for (Size i=1; i<=k; ++i)
+                c = c*(n-k+i)/i;
+            return c;
+        }
+
+    }
+
+    GaussianQuadGridIntegrator::GaussianQuadGridIntegrator(Size dimension,
+                                                           Size order,
+                                                           Grid grid)
+    : dimension_(dimension) {
+        QL_REQUIRE(dimension > 0, "null dimension");
+        QL_REQUIRE(order > 0, "null quadrature order");
+
+        NodeMap nodes;
+        switch (grid) {
+          case TensorProduct: {
+              const Rule rule = gaussHermiteRule(order);
+              addTensorProduct(std::vector<const Rule*>(dimension, &rule),
+                               1.0, nodes);
+              break;
+          }
+          case Sparse: {
+              // Smolyak: the tensor products of the rules of levels
+              // l_1,...,l_d, with L <= |l| <= L+d-1, are combined with
+              // coefficients (-1)^(L+d-1-|l|) C(d-1, L+d-1-|l|); the
+              // rule of level l has order 2l-1.
+              const Size levels = order/2 + 1;
+              std::vector<Rule> rules(levels);
+              for (Size l=0; l<levels; ++l)
+                  rules[l] = gaussHermiteRule(2*l+1);
+
+              const Size d = dimension;
+              const Size maxSum = levels + d - 1;
+              std::vector<Size> l(d, 1);
+              std::vector<const Rule*> product(d);
+              Size sum = d;
+              for (;;) {
+                  if (sum >= levels) {
+                      const Size k = maxSum - sum;
+                      const Real c = (k % 2 == 0 ? 1.0 : -1.0)
+                                   * binomialCoefficient(d-1, k);
+                      for (Size i=0; i<d; ++i)
+                          product[i] = &rules[l[i]-1];
+                      addTensorProduct(product, c, nodes);
+                  }
+
+                  // next multi-index with |l| <= L+d-1
+                  Size i = 0;
+                  while (i < d) {
+                      if (sum < maxSum && l[i] < levels) {
+                          ++l[i];
+                          ++sum;
+                          break;
+                      }
+                      sum -= l[i] - 1;
+                      l[i++] = 1;
+                  }
+                  if (i == d)
+                      break;
+              }
+              break;
+          }
+          default:
+            QL_FAIL("unknown grid type");
+        }
+
+        abscissas_.reserve(nodes.size());
+        std::vector<Real> w;
+        w.reserve(nodes.size());
+        for (NodeMap::const_iterator i=nodes.begin(); i!=nodes.end(); ++i) {
+            if (i->second != 0.0) {
+                abscissas_.push_back(i->first);
+                w.push_back(i->second);
+            }
+        }
+        weights_ = Array(w.begin(), w.end());
+    }
+
+    Real GaussianQuadGridIntegrator::integrate(
+             const boost::function<Real (const std::vector<Real>&)>& f) const {
+        Real sum = 0.0;
+        for (Size i=0; i<weights_.size(); ++i)
+            sum += weights_[i]*f(abscissas_[i]);
+        return sum;
+    }
+
+    Disposable<std::vector<Real> > GaussianQuadGridIntegrator::integrateV(
+                    const boost::function<Disposable<std::vector<Real> > (
+                                        const std::vector<Real>&)>& f) const {
+        std::vector<Real> sum;
+        for (Size i=0; i<weights_.size(); ++i) {
+            const std::vector<Real> term = f(abscissas_[i]);
+            if (i == 0)
+                sum.resize(term.size(), 0.0);
+            QL_REQUIRE(term.size() == sum.size(),
+                       "inconsistent integrand size");
+            for (Size j=0; j<sum.size(); ++j)
+                sum[j] += weights_[i]*term[j];
+        }
+        return sum;
+    }
+
+}
@@ -0,0 +1,95 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file gaussianquadgridintegrator.hpp
+    \brief Gauss-Hermite quadrature on tensor-product and sparse grids
+*/
+
+#ifndef quantlib_math_gaussianquadgridintegrator_hpp
+#define quantlib_math_gaussianquadgridintegrator_hpp
+
+#include <ql/math/array.hpp>
+#include <ql/utilities/disposable.hpp>
+#include <boost/function.hpp>
+#include <vector>
+
+namespace QuantLib {
+
+    //! Gauss-Hermite quadrature on tensor-product and sparse grids
+    /*! Integrates a scalar or vector function over \f$ R^{d} \f$,
+        with the same convention as GaussianQuadMultidimIntegrator
+        (i.e., the Gauss-Hermite weight is divided out of the
+        weights, so that the integrand must include the density.)
+        Unlike the latter, the one-dimensional rules are the
+        Gauss-Hermite rules for the weight \f$ e^{-x^2/2} \f$; they
+        are exact for polynomials times the standard normal density,
+        so that Gaussian factor models need much lower orders.
+
+        The nodes and weights of the grid are computed once at
+        construction; integration is a single loop over them, with
+        no recursion along the dimensions and no mutable state, so
+        that the same integrator can be used by several threads.
+        The nodes are also available as a block for integrands that
+        are better evaluated on all of them at once.
+
+        The tensor-product grid uses the rule of the given order
+        along every dimension and has \f$ n^d \f$ nodes. The sparse
+        grid is the Smolyak combination of the rules of orders
+        \f$ 1, 3, \dots, n \f$ (\f$ n \f$ is rounded up to an odd
+        number); it coincides with the tensor-product rule in one
+        dimension and, for a given order, its number of nodes grows
+        only polynomially with the dimension, which makes models
+        with three to six factors practical. It is most effective
+        when the integrand is close to separable; for functions of
+        a single combination of the factors, such as conditional
+        default probabilities, a low-order tensor-product grid can
+        be competitive.
+
+        \test the grids are checked against the known integrals of
+              Gaussian-weighted functions and against each other.
+    */
+    class GaussianQuadGridIntegrator {
+      public:
+        enum Grid { TensorProduct, Sparse };
+        GaussianQuadGridIntegrator(Size dimension,
+                                   Size order,
+                                   Grid grid = Sparse);
+        //! \name Inspectors
+        //@{
+        Size dimension() const { return dimension_; }
+        Size nodes() const { return weights_.size(); }
+        const std::vector<std::vector<Real> >& abscissas() const {
+            return abscissas_;
+        }
+        const Array& weights() const { return weights_; }
+        //@}
+        //! integral of a scalar function
+        Real integrate(const boost::function<Real (
+            const std::vector<Real>& arg)>& f) const;
+        //! integral of a vector function
+        Disposable<std::vector<Real> > integrateV(
+            const boost::function<Disposable<std::vector<Real> > (
+                const std::vector<Real>& arg)>& f) const;
+      private:
+        Size dimension_;
+        std::vector<std::vector<Real> > abscissas_;
+        Array weights_;
+    };
+
+}
+
+#endif
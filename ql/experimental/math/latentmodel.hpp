@@ -22,8 +22,10 @@
 
 #include <ql/experimental/math/multidimquadrature.hpp>
 #include <ql/experimental/math/multidimintegrator.hpp>
+#include <ql/experimental/math/gaussianquadgridintegrator.hpp>
 #include <ql/math/integrals/trapezoidintegral.hpp>
 #include <ql/math/randomnumbers/randomsequencegenerator.hpp>
+#include <ql/math/randomnumbers/sobolrsg.hpp>
 // for template spezs
 #include <ql/experimental/math/gaussiancopulapolicy.hpp>
 #include <ql/experimental/math/tcopulapolicy.hpp>
@@ -56,6 +58,21 @@ namespace QuantLib {
                 return v;
             }
         };
+
+        /* Advances a newly built sequence generator by n samples without
+        mapping them; the Sobol generator jumps directly to the n-th point
+        of its sequence, which is where the next draw starts from as long
+        as nothing was drawn yet. */
+        template <class USNG>
+        void skipSequences(USNG& generator, Size n) {
+            for(Size i=0; i<n; i++)
+                generator.nextSequence();
+        }
+
+        inline void skipSequences(SobolRsg& generator, Size n) {
+            if(n > 0)
+                generator.skipTo(n);
+        }
     }
 
     //! \name Latent model direct integration facility.
@@ -88,6 +105,8 @@ namespace QuantLib {
             const std::vector<Real>& arg)>& f) const {
             QL_FAIL("No vector integration provided");
         }
+        // whether integrateV is implemented
+        virtual bool providesVectorIntegration() const { return false; }
         virtual ~LMIntegration() {}
     };
 
@@ -107,7 +126,8 @@ namespace QuantLib {
         typedef 
         enum LatentModelIntegrationType {
             GaussianQuadrature,
-            Trapezoid
+            Trapezoid,
+            SparseGrid
             // etc....
         } LatentModelIntegrationType;
     }
@@ -130,6 +150,26 @@ namespace QuantLib {
                 return GaussianQuadMultidimIntegrator::
                     integrate<Disposable<std::vector<Real> > >(f);
         }
+        bool providesVectorIntegration() const { return true; }
+        virtual ~IntegrationBase() {}
+    };
+
+    template<> class IntegrationBase<GaussianQuadGridIntegrator> : 
+        public GaussianQuadGridIntegrator, public LMIntegration {
+    public:
+        IntegrationBase(Size dimension, Size order,
+                        GaussianQuadGridIntegrator::Grid grid)
+        : GaussianQuadGridIntegrator(dimension, order, grid) {}
+        Real integrate(const boost::function<Real (
+            const std::vector<Real>& arg)>& f) const {
+                return GaussianQuadGridIntegrator::integrate(f);
+        }
+        Disposable<std::vector<Real> > integrateV(
+            const boost::function<Disposable<std::vector<Real> >  (
+                const std::vector<Real>& arg)>& f) const {
+                return GaussianQuadGridIntegrator::integrateV(f);
+        }
+        bool providesVectorIntegration() const { return true; }
         virtual ~IntegrationBase() {}
     };
 
@@ -397,7 +437,8 @@ namespace QuantLib {
             Dimensionality coherence (between the generator and the copula) 
             should have been checked by the client code.
             In multithread usage the sequence generator is expect to be already
-            in position.
+            in position; skip() moves a newly built sampler to the start of
+            its share of the samples.
             To sample the latent variable itself users should call 
             LatentModel::latentVarValue with these samples.
         */
@@ -434,6 +475,10 @@ namespace QuantLib {
                 x_.value = copula_.allFactorCumulInverter(sample.value);
                 return x_;
             }
+            //! discards the first n samples without mapping them
+            void skip(Size n) {
+                detail::skipSequences(sequenceGen_, n);
+            }
         private:
             USNG sequenceGen_;// copy, we might be mutithreaded
             mutable sample_type x_;
@@ -485,6 +530,21 @@ namespace QuantLib {
                                (integrals, -35., 35.);
                         break;
                         }
+                    case LatentModelIntegrationType::SparseGrid:
+                        /* Smolyak grid of Gauss-Hermite rules up to order
+                        15. Its size is polynomial in the number of factors,
+                        while the one of the full quadrature above is
+                        exponential; it is meant for multifactor models,
+                        with a single factor the quadrature above resolves
+                        steep integrands (e.g. senior tranche losses)
+                        better.
+                        */
+                        return 
+                            boost::make_shared<
+                            IntegrationBase<GaussianQuadGridIntegrator> >(
+                                dimension, 15, 
+                                GaussianQuadGridIntegrator::Sparse);
+                        break;
                     default:
                         QL_FAIL("Unknown latent model integration type.");
                 }
@@ -599,6 +659,12 @@ namespace QuantLib {
                         boost::bind(&copulaPolicyImpl::density, copula_, _1),
                         boost::bind(boost::cref(f), _1)));
         }
+        /*! Whether vector functions can be integrated, i.e. whether the
+         vector version of integratedExpectedValue is available.
+        */
+        bool providesVectorIntegration() const {
+            return integration()->providesVectorIntegration();
+        }
     protected:
         // Integrable models must provide their integrator.
         // Arguable, not having the integration in the LM class saves that 
@@ -754,6 +820,10 @@ namespace QuantLib {
         const sample_type& nextSequence() const {
                 return boxMullRng_.nextSequence();
         }
+        void skip(Size n) {
+            for(Size i=0; i<n; i++)
+                boxMullRng_.nextSequence();
+        }
     private:
         RandomSequenceGenerator<BoxMullerGaussianRng<URNG> > boxMullRng_;
     };
@@ -788,6 +858,10 @@ namespace QuantLib {
                 sequence_.value[i] = trng_.back().next().value;
             return sequence_;
         }
+        void skip(Size n) {
+            for(Size i=0; i<n; i++)
+                nextSequence();
+        }
     private:
         mutable sample_type sequence_;
         URNG urng_;
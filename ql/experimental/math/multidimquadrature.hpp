@@ -56,7 +56,7 @@ namespace QuantLib {
                 //first one, we do not know the size of the vector returned by f
                 Integer i = order()-1;
                 std::vector<Real> term = f(x_[i]);// potential copy! @#$%^!!!
-                std::for_each(term.begin(), term.end(), 
+                std::transform(term.begin(), term.end(), term.begin(),
                     std::bind1st(std::multiplies<Real>(), w_[i]));
                 std::vector<Real> sum = term;
            
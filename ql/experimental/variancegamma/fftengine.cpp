@@ -20,7 +20,7 @@ FOR A PARTICULAR PURPOSE.  See the license for more details.
 #include <ql/experimental/variancegamma/fftengine.hpp>
 #include <ql/exercise.hpp>
 #include <ql/math/interpolations/linearinterpolation.hpp>
-#include <ql/math/fastfouriertransform.hpp>
+#include <ql/math/fftplan.hpp>
 #include <complex>
 
 namespace QuantLib {
@@ -152,8 +152,7 @@ namespace QuantLib {
 
             // Perform fft
             std::vector<std::complex<Real> > results(n);
-            FastFourierTransform fft(log2_n);
-            fft.transform(fti.begin(), fti.end(), results.begin());
+            FFTPlan(n).execute(&fti[0], &results[0], false);
 
             // Call prices
             std::vector<Real> prices, strikes;
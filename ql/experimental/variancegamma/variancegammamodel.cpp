@@ -46,5 +46,17 @@ namespace QuantLib {
             sigma(), nu(), theta()));
     }
 
+    std::complex<Real> VarianceGammaModel::characteristicFunction(
+                                  const std::complex<Real>& u, Time t) const {
+        const Real sigma2 = sigma()*sigma();
+        const Real omega =
+            std::log(1.0 - theta()*nu() - 0.5*sigma2*nu())/nu();
+        const std::complex<Real> iu(-u.imag(), u.real());
+
+        return std::exp(iu*omega*t)
+            * std::pow(1.0 - iu*theta()*nu() - 0.5*sigma2*nu()*iu*iu,
+                       -t/nu());
+    }
+
 }
 
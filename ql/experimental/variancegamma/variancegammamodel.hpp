@@ -25,6 +25,7 @@ FOR A PARTICULAR PURPOSE.  See the license for more details.
 #define quantlib_variance_gamma_model_hpp
 
 #include <ql/models/model.hpp>
+#include <ql/models/equity/characteristicfunctionmodel.hpp>
 #include <ql/experimental/variancegamma/variancegammaprocess.hpp>
 
 namespace QuantLib {
@@ -38,7 +39,8 @@ namespace QuantLib {
 
         \warning calibration is not implemented for VG
     */
-    class VarianceGammaModel : public CalibratedModel {
+    class VarianceGammaModel : public CalibratedModel,
+                               public CharacteristicFunctionModel {
       public:
         VarianceGammaModel(const boost::shared_ptr<VarianceGammaProcess>& process);
 
@@ -52,6 +54,19 @@ namespace QuantLib {
         // underlying process
         boost::shared_ptr<VarianceGammaProcess> process() const { return process_; }
 
+        //! \name CharacteristicFunctionModel interface
+        //@{
+        std::complex<Real> characteristicFunction(
+                                  const std::complex<Real>& u, Time t) const;
+        Real s0() const { return process_->s0()->value(); }
+        const Handle<YieldTermStructure>& riskFreeRate() const {
+            return process_->riskFreeRate();
+        }
+        const Handle<YieldTermStructure>& dividendYield() const {
+            return process_->dividendYield();
+        }
+        //@}
+
     protected:
         void generateArguments();
         boost::shared_ptr<VarianceGammaProcess> process_;
@@ -21,6 +21,7 @@
 
 #include <ql/math/solvers1d/brent.hpp>
 #include <ql/math/modifiedbessel.hpp>
+#include <ql/math/integrals/gaussianquadratures.hpp>
 
 #include <boost/make_shared.hpp>
 #include <boost/math/special_functions/gamma.hpp>
@@ -44,10 +45,10 @@ class NoArbSabrModel::integrand {
 
 NoArbSabrModel::NoArbSabrModel(const Real expiryTime, const Real forward,
                                const Real alpha, const Real beta, const Real nu,
-                               const Real rho)
+                               const Real rho, const bool priceTable)
     : expiryTime_(expiryTime), externalForward_(forward), alpha_(alpha),
       beta_(beta), nu_(nu), rho_(rho), forward_(forward),
-      numericalForward_(forward) {
+      numericalForward_(forward), tableLogStep_(0.0) {
 
     QL_REQUIRE(expiryTime > 0.0 && expiryTime <= detail::NoArbSabrModel::expiryTime_max,
                "expiryTime (" << expiryTime << ") out of bounds");
@@ -107,11 +108,81 @@ NoArbSabrModel::NoArbSabrModel(const Real expiryTime, const Real forward,
 
     Real d = forwardError(std::sqrt(forward_ - detail::NoArbSabrModel::strike_min));
     numericalForward_ = d + externalForward_;
+
+    if (priceTable)
+        buildPriceTable();
+}
+
+void NoArbSabrModel::buildPriceTable() {
+
+    GaussLegendreIntegration gl(detail::NoArbSabrModel::price_table_order);
+    glNodes_ = gl.x();
+    glWeights_ = gl.weights();
+
+    const Size n = detail::NoArbSabrModel::price_table_segments;
+    tableLogStep_ = std::log(fmax_ / fmin_) / static_cast<Real>(n);
+
+    tableStrikes_.resize(n + 1);
+    tableM0_.resize(n + 1);
+    tableM1_.resize(n + 1);
+    for (Size i = 0; i < n; ++i)
+        tableStrikes_[i] =
+            fmin_ * std::exp(tableLogStep_ * static_cast<Real>(i));
+    tableStrikes_[n] = fmax_;
+
+    tableM0_[n] = tableM1_[n] = 0.0;
+    for (Size i = n; i > 0; --i) {
+        Real m0, m1;
+        segmentIntegrals(tableStrikes_[i - 1], tableStrikes_[i], m0, m1);
+        tableM0_[i - 1] = tableM0_[i] + m0;
+        tableM1_[i - 1] = tableM1_[i] + m1;
+    }
+}
+
+void NoArbSabrModel::segmentIntegrals(const Real a, const Real b, Real &m0,
+                                      Real &m1) const {
+    const Real c = 0.5 * (b - a), d = 0.5 * (b + a);
+    m0 = m1 = 0.0;
+    for (Size j = 0; j < glNodes_.size(); ++j) {
+        Real f = c * glNodes_[j] + d;
+        Real w = glWeights_[j] * p(f);
+        m0 += w;
+        m1 += w * f;
+    }
+    m0 *= c;
+    m1 *= c;
+}
+
+void NoArbSabrModel::tabulatedIntegrals(const Real strike, Real &m0,
+                                        Real &m1) const {
+    // the grid is equidistant in log strike, so we can locate
+    // the segment containing the strike without a search
+    if (strike <= fmin_) {
+        m0 = tableM0_.front();
+        m1 = tableM1_.front();
+        return;
+    }
+    Size i = std::min(static_cast<Size>(std::log(strike / fmin_) /
+                                        tableLogStep_),
+                      tableStrikes_.size() - 2);
+    // guard against rounding at the segment boundaries
+    if (strike < tableStrikes_[i])
+        --i;
+    else if (strike >= tableStrikes_[i + 1] && i + 2 < tableStrikes_.size())
+        ++i;
+    segmentIntegrals(strike, tableStrikes_[i + 1], m0, m1);
+    m0 += tableM0_[i + 1];
+    m1 += tableM1_[i + 1];
 }
 
 Real NoArbSabrModel::optionPrice(const Real strike) const {
     if (p(std::max(forward_, strike)) < detail::NoArbSabrModel::density_threshold)
         return 0.0;
+    if (!tableStrikes_.empty() && strike < fmax_) {
+        Real m0, m1;
+        tabulatedIntegrals(strike, m0, m1);
+        return (1.0 - absProb_) * (m1 - strike * m0) / numericalIntegralOverP_;
+    }
     return (1.0 - absProb_) *
         ((*integrator_)(integrand(this, strike),
                         strike, std::max(fmax_, 2.0 * strike)) /
@@ -123,6 +194,11 @@ Real NoArbSabrModel::digitalOptionPrice(const Real strike) const {
         return 1.0;
     if (p(std::max(forward_, strike)) < detail::NoArbSabrModel::density_threshold)
         return 0.0;
+    if (!tableStrikes_.empty() && strike < fmax_) {
+        Real m0, m1;
+        tabulatedIntegrals(strike, m0, m1);
+        return (1.0 - absProb_) * m0 / numericalIntegralOverP_;
+    }
     return (1.0 - absProb_)
         * ((*integrator_)(std::bind1st(std::mem_fun(&NoArbSabrModel::p), this),
                           strike, std::max(fmax_, 2.0 * strike)) /
@@ -45,6 +45,17 @@
     model implied forward different from the desired one.
     This situation can be identified by comparing forward()
     and numericalForward().
+
+    Optionally the integrals of the density and of the first
+    moment are tabulated once on a log-spaced strike grid
+    covering the integration domain. Option and digital
+    prices are then obtained from the cumulated table plus a
+    fixed order Gauss-Legendre integration over the partial
+    grid segment containing the strike, which avoids the
+    adaptive integration on each call. This is useful if
+    many strikes are priced with the same model, e.g. in a
+    smile section, but not if only a few prices are needed,
+    e.g. during a calibration.
 */
 
 #ifndef quantlib_noarb_sabr
@@ -52,6 +63,7 @@
 
 #include <ql/qldefines.hpp>
 #include <ql/types.hpp>
+#include <ql/math/array.hpp>
 #include <ql/math/integrals/gausslobattointegral.hpp>
 
 #include <vector>
@@ -96,6 +108,10 @@ const Real forward_search_step = 0.0010;
 const Real density_lower_bound = 1E-50;
 // threshold to identify a zero density
 const Real density_threshold = 1E-100;
+// number of segments and gauss legendre order per segment
+// for the optional price table
+const Size price_table_segments = 200;
+const Size price_table_order = 8;
 }
 }
 
@@ -103,7 +119,8 @@ class NoArbSabrModel {
 
   public:
     NoArbSabrModel(const Real expiryTime, const Real forward, const Real alpha,
-              const Real beta, const Real nu, const Real rho);
+              const Real beta, const Real nu, const Real rho,
+              const bool priceTable = false);
 
     Real optionPrice(const Real strike) const;
     Real digitalOptionPrice(const Real strike) const;
@@ -120,6 +137,7 @@ class NoArbSabrModel {
     Real rho() const { return rho_; }
 
     Real absorptionProbability() const { return absProb_; }
+    bool priceTable() const { return !tableStrikes_.empty(); }
 
     QL_DEPRECATED
     static void checkAbsorptionMatrix();
@@ -127,12 +145,20 @@ class NoArbSabrModel {
     private:
     Real p(const Real f) const;
     Real forwardError(const Real forward) const;
+    void buildPriceTable();
+    void tabulatedIntegrals(const Real strike, Real &m0, Real &m1) const;
+    void segmentIntegrals(const Real a, const Real b, Real &m0,
+                          Real &m1) const;
     const Real expiryTime_, externalForward_;
     const Real alpha_, beta_, nu_, rho_;
     Real absProb_, fmin_, fmax_;
     mutable Real forward_, numericalIntegralOverP_;
     mutable Real numericalForward_;
     boost::shared_ptr<GaussLobattoIntegral> integrator_;
+    // price table, m0 = int_f^fmax p, m1 = int_f^fmax f p
+    Real tableLogStep_;
+    std::vector<Real> tableStrikes_, tableM0_, tableM1_;
+    Array glNodes_, glWeights_;
     class integrand;
     friend class integrand;
 };
@@ -27,16 +27,17 @@ namespace QuantLib {
 
 NoArbSabrSmileSection::NoArbSabrSmileSection(
     Time timeToExpiry, Rate forward, const std::vector<Real> &sabrParams,
-    Real shift)
+    Real shift, bool priceTable)
     : SmileSection(timeToExpiry, DayCounter()), forward_(forward),
-      params_(sabrParams), shift_(shift) {
+      params_(sabrParams), shift_(shift), priceTable_(priceTable) {
     init();
 }
 
 NoArbSabrSmileSection::NoArbSabrSmileSection(
     const Date &d, Rate forward, const std::vector<Real> &sabrParams,
-    const DayCounter &dc, Real shift)
-    : SmileSection(d, dc, Date()), forward_(forward), params_(sabrParams), shift_(shift) {
+    const DayCounter &dc, Real shift, bool priceTable)
+    : SmileSection(d, dc, Date()), forward_(forward), params_(sabrParams),
+      shift_(shift), priceTable_(priceTable) {
     init();
 }
 
@@ -51,7 +52,8 @@ void NoArbSabrSmileSection::init() {
                   << ") must be zero, other shifts are not implemented yet");
     model_ =
         boost::make_shared<NoArbSabrModel>(exerciseTime(), forward_, params_[0],
-                                           params_[1], params_[2], params_[3]);
+                                           params_[1], params_[2], params_[3],
+                                           priceTable_);
 }
 
 Real NoArbSabrSmileSection::optionPrice(Rate strike, Option::Type type,
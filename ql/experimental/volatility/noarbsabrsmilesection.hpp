@@ -19,6 +19,11 @@
 
 /*! \file noarbsabrsmilesection.hpp
     \brief no arbitrage sabr smile section
+
+    If priceTable is true, the model integrals are tabulated
+    once on construction (see NoArbSabrModel), which speeds up
+    repeated option price and volatility evaluations at the
+    cost of a slower construction.
 */
 
 #ifndef quantlib_noarbsabr_smile_section_hpp
@@ -36,11 +41,13 @@ class NoArbSabrSmileSection : public SmileSection {
   public:
     NoArbSabrSmileSection(Time timeToExpiry, Rate forward,
                           const std::vector<Real> &sabrParameters,
-                          const Real shift = 0.0);
+                          const Real shift = 0.0,
+                          const bool priceTable = false);
     NoArbSabrSmileSection(const Date &d, Rate forward,
                           const std::vector<Real> &sabrParameters,
                           const DayCounter &dc = Actual365Fixed(),
-                          const Real shift = 0.0);
+                          const Real shift = 0.0,
+                          const bool priceTable = false);
     Real minStrike() const { return 0.0; }
     Real maxStrike() const { return QL_MAX_REAL; }
     Real atmLevel() const { return forward_; }
@@ -61,6 +68,7 @@ class NoArbSabrSmileSection : public SmileSection {
     Rate forward_;
     std::vector<Real> params_;
     Real shift_;
+    bool priceTable_;
 };
 }
 
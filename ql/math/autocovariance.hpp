@@ -24,7 +24,7 @@
 #ifndef quantlib_auto_covariance_hpp
 #define quantlib_auto_covariance_hpp
 
-#include <ql/math/fastfouriertransform.hpp>
+#include <ql/math/fftplan.hpp>
 #include <ql/math/array.hpp>
 #include <complex>
 #include <vector>
@@ -36,23 +36,22 @@ namespace QuantLib {
     namespace detail {
 
         // Outputs double FT for a given input:
-        // input -> FFT -> norm -> FFT -> out
+        // input -> FFT -> norm -> inverse FFT -> out
+        // The transforms are real and their length is at least twice
+        // the data size, so that out[k]/out.size() is the sum of
+        // x[j]*x[j+k] without wrap-around.
         template <typename ForwardIterator>
-        std::vector<std::complex<Real> > double_ft(ForwardIterator begin,
-                                                   ForwardIterator end) {
+        std::vector<Real> double_ft(ForwardIterator begin,
+                                    ForwardIterator end) {
             std::size_t nData = std::distance(begin, end);
-            std::size_t order = FastFourierTransform::min_order(nData) + 1;
-            FastFourierTransform fft(order);
+            RealFFTPlan fft(2*FFTPlan::good_size(nData));
             std::vector<std::complex<Real> > ft(fft.output_size());
             fft.transform(begin, end, ft.begin());
-            Array tmp(ft.size(), 0.0);
-            std::complex<Real> z = std::complex<Real>();
-            for (Size i=0; i<ft.size(); ++i) {
-                tmp[i] = std::norm<Real>(ft[i]);
-                ft[i] = z;
-            }
-            fft.transform(tmp.begin(), tmp.end(), ft.begin());
-            return ft;
+            for (Size i=0; i<ft.size(); ++i)
+                ft[i] = std::norm<Real>(ft[i]);
+            std::vector<Real> out(fft.size());
+            fft.inverse_transform(ft.begin(), ft.end(), out.begin());
+            return out;
         }
 
 
@@ -84,10 +83,10 @@ namespace QuantLib {
         using namespace detail;
         std::size_t nData = std::distance(begin, end);
         QL_REQUIRE(maxLag < nData, "maxLag must be less than data size");
-        const std::vector<std::complex<Real> >& ft = double_ft(begin, end);
+        const std::vector<Real>& ft = double_ft(begin, end);
         Real w = 1.0 / (Real)ft.size();
         for (std::size_t k = 0; k <= maxLag; ++k)
-            *out++ = ft[k].real() * w;
+            *out++ = ft[k] * w;
     }
 
     //! Unbiased auto-covariances
@@ -103,10 +102,10 @@ namespace QuantLib {
         std::size_t nData = std::distance(begin, end);
         QL_REQUIRE(maxLag < nData,
                    "number of covariances must be less than data size");
-        const std::vector<std::complex<Real> >& ft = double_ft(begin, end);
+        const std::vector<Real>& ft = double_ft(begin, end);
         Real w1 = 1.0 / (Real)ft.size(), w2 = (Real)nData;
         for (std::size_t k = 0; k <= maxLag; ++k, w2 -= 1.0) {
-            *out++ = ft[k].real() * w1 / w2;
+            *out++ = ft[k] * w1 / w2;
         }
     }
 
@@ -151,13 +150,13 @@ namespace QuantLib {
         std::size_t nData = std::distance(begin, end);
         QL_REQUIRE(maxLag < nData,
                    "number of correlations must be less than data size");
-        const std::vector<std::complex<Real> >& ft = double_ft(begin, end);
+        const std::vector<Real>& ft = double_ft(begin, end);
         Real w1 = 1.0 / (Real)ft.size(), w2 = (Real)nData;
-        Real variance = ft[0].real() * w1 / w2;
+        Real variance = ft[0] * w1 / w2;
         *out++ = variance * w2 / (w2-1.0);
         w2 -= 1.0;
         for (std::size_t k = 1; k <= maxLag; ++k, w2 -= 1.0)
-            *out++ = ft[k].real() * w1 / (variance * w2);
+            *out++ = ft[k] * w1 / (variance * w2);
     }
 
     //! Unbiased auto-correlations.
@@ -113,54 +113,57 @@ namespace QuantLib {
 
     // West 2004
 
-    namespace {
-
-        class eqn3 { /* Relates to eqn3 Genz 2004 */
-          public:
-            eqn3(Real h, Real k, Real asr) {
-                hk_ = h * k;
-                hs_  = (h * h + k * k) / 2;
-                asr_ = asr;
-            }
-            Real operator()(Real x) const {
-                Real sn = std::sin(asr_ * (-x + 1) * 0.5);
-                return std::exp((sn * hk_ - hs_) / (1.0 - sn * sn));
-            }
-          private:
-            Real hk_, asr_, hs_;
-        };
-
-        class eqn6 { /* Relates to eqn6 Genz 2004 */
-          public:
-            eqn6(Real a, Real c, Real d, Real bs, Real hk)
-            : a_(a), c_(c), d_(d), bs_(bs), hk_(hk) {}
-            Real operator()(Real x) const {
-                Real xs = a_ * (-x + 1);
-                xs = std::fabs(xs*xs);
-                Real rs = std::sqrt(1 - xs);
-                Real asr = -(bs_ / xs + hk_) / 2;
-                if (asr > -100.0) {
-                    return (a_ * std::exp(asr) *
-                            (std::exp(-hk_ * (1 - rs) / (2 * (1 + rs))) / rs -
-                             (1 + c_ * xs * (1 + d_ * xs))));
-                } else {
-                    return 0.0;
-                }
-            }
-          private:
-            Real a_, c_, d_, bs_, hk_;
-        };
-
-    }
-
     BivariateCumulativeNormalDistributionWe04DP::
     BivariateCumulativeNormalDistributionWe04DP(Real rho)
-    : correlation_(rho) {
+    : correlation_(rho), asr_(0.0), a_(0.0) {
 
         QL_REQUIRE(rho>=-1.0,
                    "rho must be >= -1.0 (" << rho << " not allowed)");
         QL_REQUIRE(rho<=1.0,
                    "rho must be <= 1.0 (" << rho << " not allowed)");
+
+        TabulatedGaussLegendre gaussLegendreQuad(20);
+        if (std::fabs(correlation_) < 0.3) {
+            gaussLegendreQuad.order(6);
+        } else if (std::fabs(correlation_) < 0.75) {
+            gaussLegendreQuad.order(12);
+        }
+
+        // same nodes and order of summation as TabulatedGaussLegendre
+        std::vector<Real> x;
+        const Size order = gaussLegendreQuad.order();
+        const Real* xi = gaussLegendreQuad.x();
+        const Real* wi = gaussLegendreQuad.weights();
+        for (Size i=0; i<(order+1)/2; ++i) {
+            x.push_back(xi[i]);
+            w_.push_back(wi[i]);
+            if (i > 0 || (order & 1) == 0) {
+                x.push_back(-xi[i]);
+                w_.push_back(wi[i]);
+            }
+        }
+
+        if (std::fabs(correlation_) < 0.925) {
+            // eqn3 in Genz 2004
+            asr_ = std::asin(correlation_);
+            for (Size j=0; j<x.size(); ++j) {
+                Real sn = std::sin(asr_ * (-x[j] + 1) * 0.5);
+                sn_.push_back(sn);
+                cs_.push_back(1.0 - sn * sn);
+            }
+        } else if (std::fabs(correlation_) < 1) {
+            // eqn6 in Genz 2004
+            a_ = std::sqrt((1 - correlation_) * (1 + correlation_));
+            for (Size j=0; j<x.size(); ++j) {
+                Real xs = a_ / 2 * (-x[j] + 1);
+                xs = std::fabs(xs*xs);
+                Real rs = std::sqrt(1 - xs);
+                xs_.push_back(xs);
+                rs_.push_back(rs);
+                omrs_.push_back(1 - rs);
+                tprs_.push_back(2 * (1 + rs));
+            }
+        }
     }
 
 
@@ -174,21 +177,12 @@ namespace QuantLib {
            151-160. (available at
            www.sci.wsu.edu/math/faculty/henz/homepage)
 
-           The Gauss-Legendre quadrature have been extracted to
-           TabulatedGaussLegendre (x,w zero-based)
-
-           Tthe functions ot be integrated numerically have been moved
-           to classes eqn3 and eqn6
+           The Gauss-Legendre quadrature nodes and the parts of the
+           integrands of eqn3 and eqn6 which only depend on the
+           correlation are tabulated in the constructor.
 
            Change some magic numbers to M_PI */
 
-        TabulatedGaussLegendre gaussLegendreQuad(20);
-        if (std::fabs(correlation_) < 0.3) {
-            gaussLegendreQuad.order(6);
-        } else if (std::fabs(correlation_) < 0.75) {
-            gaussLegendreQuad.order(12);
-        }
-
         Real h = -x;
         Real k = -y;
         Real hk = h * k;
@@ -198,10 +192,10 @@ namespace QuantLib {
         {
             if (std::fabs(correlation_) > 0)
             {
-                Real asr = std::asin(correlation_);
-                eqn3 f(h,k,asr);
-                BVN = gaussLegendreQuad(f);
-                BVN *= asr * (0.25 / M_PI);
+                Real hs = (h * h + k * k) / 2;
+                for (Size j=0; j<w_.size(); ++j)
+                    BVN += w_[j] * std::exp((sn_[j] * hk - hs) / cs_[j]);
+                BVN *= asr_ * (0.25 / M_PI);
             }
             BVN += cumnorm_(-h) * cumnorm_(-k);
         }
@@ -215,7 +209,7 @@ namespace QuantLib {
             if (std::fabs(correlation_) < 1)
             {
                 Real Ass = (1 - correlation_) * (1 + correlation_);
-                Real a = std::sqrt(Ass);
+                Real a = a_;
                 Real bs = (h-k)*(h-k);
                 Real c = (4 - hk) / 8;
                 Real d = (12 - hk) / 16;
@@ -234,8 +228,16 @@ namespace QuantLib {
                         (1 - c * bs * (1 - d * bs / 5) / 3);
                 }
                 a /= 2;
-                eqn6 f(a,c,d,bs,hk);
-                BVN += gaussLegendreQuad(f);
+                Real sum = 0.0;
+                for (Size j=0; j<w_.size(); ++j) {
+                    Real xs = xs_[j];
+                    Real asr = -(bs / xs + hk) / 2;
+                    if (asr > -100.0)
+                        sum += w_[j] * (a * std::exp(asr) *
+                               (std::exp(-hk * omrs_[j] / tprs_[j]) / rs_[j]
+                                - (1 + c * xs * (1 + d * xs))));
+                }
+                BVN += sum;
                 BVN /= (-2.0 * M_PI);
             }
 
@@ -258,4 +260,11 @@ namespace QuantLib {
         return BVN;
     }
 
+    void BivariateCumulativeNormalDistributionWe04DP::values(
+                                    const Real* xBegin, const Real* xEnd,
+                                    const Real* yBegin, Real* out) const {
+        for (; xBegin != xEnd; ++xBegin, ++yBegin, ++out)
+            *out = (*this)(*xBegin, *yBegin);
+    }
+
 }
@@ -26,6 +26,7 @@
 #define quantlib_bivariatenormal_distribution_hpp
 
 #include <ql/math/distributions/normaldistribution.hpp>
+#include <vector>
 
 namespace QuantLib {
 
@@ -86,17 +87,37 @@ namespace QuantLib {
           QuantLib::CumulativeNormalDistribution
         - The arrays XX and W are zero-based
 
-        \test the correctness of the returned value is tested by
-              checking it against known good results.
+        The parts of the integrands which only depend on the
+        correlation are tabulated at the quadrature nodes when the
+        instance is built; evaluating the distribution then only
+        needs the exponentials.  The results are the same as those
+        of the original code.
+
+        \test
+        - the correctness of the returned value is tested by
+          checking it against known good results.
+        - the values returned by values() are checked against those
+          of operator().
     */
     class BivariateCumulativeNormalDistributionWe04DP {
       public:
         BivariateCumulativeNormalDistributionWe04DP(Real rho);
         // function
         Real operator()(Real a, Real b) const;
+        //! values at the points (x[i], y[i]), written to out
+        /*! out can be the same as xBegin or yBegin. */
+        void values(const Real* xBegin, const Real* xEnd,
+                    const Real* yBegin, Real* out) const;
       private:
         Real correlation_;
         CumulativeNormalDistribution cumnorm_;
+        // quadrature weights and tabulated integrands, in the order
+        // in which they are summed
+        std::vector<Real> w_;
+        Real asr_;
+        std::vector<Real> sn_, cs_;
+        Real a_;
+        std::vector<Real> xs_, rs_, omrs_, tprs_;
     };
 
     //! default bivariate implementation
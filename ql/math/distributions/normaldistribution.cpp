@@ -22,6 +22,7 @@
 
 #include <ql/math/distributions/normaldistribution.hpp>
 #include <ql/math/comparison.hpp>
+#include <algorithm>
 
 #if defined(__GNUC__) && (((__GNUC__ == 4) && (__GNUC_MINOR__ >= 8)) || (__GNUC__ > 4))
 #pragma GCC diagnostic push
@@ -36,6 +37,22 @@
 
 namespace QuantLib {
 
+    namespace {
+
+        // points processed at a time by the array methods
+        const Size blockSize = 64;
+
+        // Laplace's continued fraction for Mills' ratio; 32 terms give
+        // full precision for x >= 3.5
+        inline Real millsRatioDenominator(Real x) {
+            Real b = x;
+            for (Integer k=32; k>=1; --k)
+                b = x + k/b;
+            return b;
+        }
+
+    }
+
     Real CumulativeNormalDistribution::operator()(Real z) const {
         //QL_REQUIRE(!(z >= average_ && 2.0*average_-z > average_),
         //           "not a real number. ");
@@ -63,6 +80,29 @@ namespace QuantLib {
         return result;
     }
 
+    void CumulativeNormalDistribution::values(const Real* xBegin,
+                                              const Real* xEnd,
+                                              Real* out) const {
+        for (; xBegin != xEnd; ++xBegin, ++out) {
+            const Real z = (*xBegin - average_) / sigma_;
+            const Real a = std::fabs(z);
+            if (a < 3.5) {
+                *out = 0.5 * ( 1.0 + errorFunction_( z*M_SQRT_2 ) );
+            } else {
+                // continued fraction; a*a is split so that the
+                // exponent is exact, which keeps the relative accuracy
+                // far in the tail
+                Real r = 0.0;
+                if (a < 40.0) {
+                    const Real h = static_cast<float>(a);
+                    r = std::exp(-0.5*h*h) * std::exp(-0.5*(a-h)*(a+h))
+                        * M_1_SQRTPI * M_SQRT_2 / millsRatioDenominator(a);
+                }
+                *out = (z > 0.0) ? 1.0 - r : r;
+            }
+        }
+    }
+
     #if !defined(QL_PATCH_SOLARIS)
     const CumulativeNormalDistribution InverseCumulativeNormal::f_;
     #endif
@@ -97,6 +137,41 @@ namespace QuantLib {
     const Real InverseCumulativeNormal::x_low_ = 0.02425;
     const Real InverseCumulativeNormal::x_high_= 1.0 - x_low_;
 
+    void InverseCumulativeNormal::values(const Real* xBegin,
+                                         const Real* xEnd,
+                                         Real* out) const {
+        const Size n = xEnd - xBegin;
+        // the input is copied in blocks, so that out can overwrite it;
+        // the last block is padded, so that the loop on the central
+        // region always has the same trip count and can be vectorized
+        Real x[blockSize], z[blockSize];
+        for (Size i0=0; i0<n; i0+=blockSize) {
+            const Size m = std::min(blockSize, n-i0);
+            std::copy(xBegin+i0, xBegin+i0+m, x);
+            std::fill(x+m, x+blockSize, 0.5);
+
+            for (Size i=0; i<blockSize; ++i) {
+                const Real u = x[i] - 0.5;
+                const Real r = u*u;
+                z[i] = (((((a1_*r+a2_)*r+a3_)*r+a4_)*r+a5_)*r+a6_)*u /
+                    (((((b1_*r+b2_)*r+b3_)*r+b4_)*r+b5_)*r+1.0);
+            }
+            for (Size i=0; i<m; ++i) {
+                if (x[i] < x_low_ || x_high_ < x[i])
+                    z[i] = tail_value(x[i]);
+            }
+            #ifdef REFINE_TO_FULL_MACHINE_PRECISION_USING_HALLEYS_METHOD
+            for (Size i=0; i<m; ++i) {
+                const Real r = (f_(z[i]) - x[i])
+                    * M_SQRT2 * M_SQRTPI * exp(0.5 * z[i]*z[i]);
+                z[i] -= r/(1+0.5*z[i]*r);
+            }
+            #endif
+            for (Size i=0; i<m; ++i)
+                out[i0+i] = average_ + sigma_*z[i];
+        }
+    }
+
     Real InverseCumulativeNormal::tail_value(Real x) {
         if (x <= 0.0 || x >= 1.0) {
             // try to recover if due to numerical error
@@ -64,6 +64,17 @@ namespace QuantLib {
         For this implementation see M. Abramowitz and I. Stegun,
         Handbook of Mathematical Functions,
         Dover Publications, New York (1972)
+
+        The values() method evaluates the distribution on a whole
+        array.  Below 3.5 standard deviations from the mean it returns
+        the same results as operator(); beyond, it uses the Laplace
+        continued fraction for Mills' ratio instead of the asymptotic
+        expansion, which keeps the relative error in the lower tail
+        around \f$ 10^{-13} \f$ (operator() is only accurate to about
+        \f$ 10^{-7} \f$ beyond 6 standard deviations).
+
+        \test the values returned by values() are checked against
+              those of operator() and of the error function.
     */
     class CumulativeNormalDistribution
     : public std::unary_function<Real,Real> {
@@ -73,6 +84,9 @@ namespace QuantLib {
         // function
         Real operator()(Real x) const;
         Real derivative(Real x) const;
+        //! values at the points in [xBegin, xEnd), written to out
+        /*! out can be the same as xBegin. */
+        void values(const Real* xBegin, const Real* xEnd, Real* out) const;
       private:
         Real average_, sigma_;
         NormalDistribution gaussian_;
@@ -97,6 +111,14 @@ namespace QuantLib {
       in this case the traditional Box-Muller approach and its
       variants would not preserve the sequence's low-discrepancy.
 
+      The values() method transforms a whole array and returns the
+      same results as operator(); the central region, which contains
+      95% of the points, is evaluated first for all of them in a loop
+      without branches which the compiler can vectorize, and the
+      points in the tails are corrected afterwards.
+
+      \test the values returned by values() are checked against
+            those of operator().
     */
     class InverseCumulativeNormal
         : public std::unary_function<Real,Real> {
@@ -107,6 +129,9 @@ namespace QuantLib {
         Real operator()(Real x) const {
             return average_ + sigma_*standard_value(x);
         }
+        //! values at the points in [xBegin, xEnd), written to out
+        /*! out can be the same as xBegin. */
+        void values(const Real* xBegin, const Real* xEnd, Real* out) const;
         // value for average=0, sigma=1
         /* Compared to operator(), this method avoids 2 floating point
            operations (we use average=0 and sigma=1 most of the
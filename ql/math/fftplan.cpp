@@ -0,0 +1,345 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/math/fftplan.hpp>
+
+namespace QuantLib {
+
+    namespace {
+
+        // radices above this are handled by Bluestein's algorithm
+        const Size maxRadix = 31;
+
+        // sines and cosines for the radix-3 and radix-5 butterflies
+        const Real s3  = 0.866025403784438646764; // sin(2pi/3)
+        const Real c51 = 0.309016994374947424102; // cos(2pi/5)
+        const Real c52 = -0.80901699437494742410; // cos(4pi/5)
+        const Real s51 = 0.951056516295153572116; // sin(2pi/5)
+        const Real s52 = 0.587785252292473129169; // sin(4pi/5)
+
+        // plain complex product; the library one also checks for
+        // infinities and NaNs, which makes it several times slower
+        inline std::complex<Real> mul(const std::complex<Real>& a,
+                                      const std::complex<Real>& b) {
+            return std::complex<Real>(a.real()*b.real() - a.imag()*b.imag(),
+                                      a.real()*b.imag() + a.imag()*b.real());
+        }
+
+        // -i*a
+        inline std::complex<Real> minusI(const std::complex<Real>& a) {
+            return std::complex<Real>(a.imag(), -a.real());
+        }
+
+        std::complex<Real> unitRoot(Size k, Size n) {
+            // k/n is reduced first to keep the accuracy for large k
+            const Real angle = -2.0*M_PI*Real(k % n)/Real(n);
+            return std::complex<Real>(std::cos(angle), std::sin(angle));
+        }
+
+    }
+
+    FFTPlan::FFTPlan(Size n)
+    : n_(n) {
+        QL_REQUIRE(n > 0, "null FFT size");
+
+        std::vector<Size> factors;
+        Size r = n;
+        while (r % 4 == 0) {
+            factors.push_back(4);
+            r /= 4;
+        }
+        while (r % 2 == 0) {
+            factors.push_back(2);
+            r /= 2;
+        }
+        for (Size p=3; p*p <= r; p += 2) {
+            while (r % p == 0) {
+                factors.push_back(p);
+                r /= p;
+            }
+        }
+        if (r > 1)
+            factors.push_back(r);
+
+        if (!factors.empty() && factors.back() > maxRadix) {
+            // Bluestein: jk = (j^2 + k^2 - (k-j)^2)/2 turns the
+            // transform into a convolution with the chirp
+            // exp(i pi k^2/n), which is done with power-of-two FFTs.
+            Size m = 1;
+            while (m < 2*n-1)
+                m *= 2;
+            convolution_ = boost::shared_ptr<FFTPlan>(new FFTPlan(m));
+
+            chirp_.resize(n);
+            for (Size k=0; k<n; ++k)
+                chirp_[k] = std::conj(unitRoot((k*k) % (2*n), 2*n));
+
+            std::vector<complex> b(m, complex(0.0, 0.0));
+            b[0] = chirp_[0];
+            for (Size k=1; k<n; ++k)
+                b[k] = b[m-k] = chirp_[k];
+            filter_.resize(m);
+            convolution_->forward(&b[0], &filter_[0]);
+            for (Size k=0; k<m; ++k)
+                filter_[k] /= Real(m);
+            return;
+        }
+
+        // the input index q_1 + p_1 (q_2 + p_2 (q_3 + ...)) goes to
+        // q_1 m_1 + q_2 m_2 + ..., with m_s = n/(p_1...p_s)
+        permutation_.resize(n);
+        for (Size i=0; i<n; ++i) {
+            Size rest = i, pos = 0, m = n;
+            for (Size s=0; s<factors.size(); ++s) {
+                m /= factors[s];
+                pos += (rest % factors[s])*m;
+                rest /= factors[s];
+            }
+            permutation_[pos] = i;
+        }
+
+        // the stages combine the innermost transforms first
+        stages_.resize(factors.size());
+        Size m = 1;
+        for (Size s=factors.size(); s>0; --s) {
+            Stage& stage = stages_[factors.size()-s];
+            const Size p = factors[s-1];
+            stage.radix = p;
+            stage.m = m;
+            stage.twiddles.resize((p-1)*m);
+            for (Size k=0; k<m; ++k)
+                for (Size q=1; q<p; ++q)
+                    stage.twiddles[k*(p-1)+q-1] = unitRoot(q*k, p*m);
+            if (p > 5) {
+                stage.roots.resize(p);
+                for (Size q=0; q<p; ++q)
+                    stage.roots[q] = unitRoot(q, p);
+            }
+            m *= p;
+        }
+    }
+
+    Size FFTPlan::good_size(Size n) {
+        for (Size m = std::max<Size>(n, 1); ; ++m) {
+            Size r = m;
+            while (r % 2 == 0) r /= 2;
+            while (r % 3 == 0) r /= 3;
+            while (r % 5 == 0) r /= 5;
+            if (r == 1)
+                return m;
+        }
+    }
+
+    void FFTPlan::forward(const complex* in, complex* out) const {
+        if (convolution_) {
+            const Size m = convolution_->size();
+            std::vector<complex> a(m, complex(0.0, 0.0)), c(m);
+            for (Size j=0; j<n_; ++j)
+                a[j] = mul(in[j], std::conj(chirp_[j]));
+            convolution_->forward(&a[0], &c[0]);
+            // the inverse transform is done as conj(F(conj(.)))
+            for (Size l=0; l<m; ++l)
+                c[l] = std::conj(mul(c[l], filter_[l]));
+            convolution_->forward(&c[0], &a[0]);
+            for (Size k=0; k<n_; ++k)
+                out[k] = std::conj(mul(a[k], chirp_[k]));
+            return;
+        }
+
+        for (Size i=0; i<n_; ++i)
+            out[i] = in[permutation_[i]];
+
+        std::vector<complex> t;
+        for (Size s=0; s<stages_.size(); ++s) {
+            const Stage& stage = stages_[s];
+            const Size p = stage.radix, m = stage.m;
+            const complex* w = &stage.twiddles[0];
+            if (p > 5)
+                t.resize(p);
+
+            for (Size base=0; base<n_; base+=p*m) {
+                for (Size k=0; k<m; ++k) {
+                    complex* x = out + base + k;
+                    const complex* wk = w + k*(p-1);
+                    switch (p) {
+                      case 2: {
+                          const complex t1 = mul(x[m], wk[0]);
+                          x[m] = x[0] - t1;
+                          x[0] += t1;
+                          break;
+                      }
+                      case 3: {
+                          const complex t1 = mul(x[m], wk[0]),
+                                        t2 = mul(x[2*m], wk[1]);
+                          const complex a = t1 + t2, b = t1 - t2;
+                          const complex c = x[0] - 0.5*a;
+                          const complex d = minusI(s3*b);
+                          x[0] += a;
+                          x[m] = c + d;
+                          x[2*m] = c - d;
+                          break;
+                      }
+                      case 4: {
+                          const complex t1 = mul(x[m], wk[0]),
+                                        t2 = mul(x[2*m], wk[1]),
+                                        t3 = mul(x[3*m], wk[2]);
+                          const complex a0 = x[0] + t2, a1 = x[0] - t2;
+                          const complex b0 = t1 + t3, b1 = minusI(t1 - t3);
+                          x[0] = a0 + b0;
+                          x[m] = a1 + b1;
+                          x[2*m] = a0 - b0;
+                          x[3*m] = a1 - b1;
+                          break;
+                      }
+                      case 5: {
+                          const complex t1 = mul(x[m], wk[0]),
+                                        t2 = mul(x[2*m], wk[1]),
+                                        t3 = mul(x[3*m], wk[2]),
+                                        t4 = mul(x[4*m], wk[3]);
+                          const complex a1 = t1 + t4, b1 = t1 - t4;
+                          const complex a2 = t2 + t3, b2 = t2 - t3;
+                          const complex c1 = x[0] + c51*a1 + c52*a2;
+                          const complex c2 = x[0] + c52*a1 + c51*a2;
+                          const complex d1 = minusI(s51*b1 + s52*b2);
+                          const complex d2 = minusI(s52*b1 - s51*b2);
+                          x[0] += a1 + a2;
+                          x[m] = c1 + d1;
+                          x[2*m] = c2 + d2;
+                          x[3*m] = c2 - d2;
+                          x[4*m] = c1 - d1;
+                          break;
+                      }
+                      default: {
+                          const complex* roots = &stage.roots[0];
+                          t[0] = x[0];
+                          for (Size q=1; q<p; ++q)
+                              t[q] = mul(x[q*m], wk[q-1]);
+                          for (Size u=0; u<p; ++u) {
+                              complex sum = t[0];
+                              // qu is kept reduced modulo p
+                              for (Size q=1, qu=u; q<p; ++q) {
+                                  sum += mul(t[q], roots[qu]);
+                                  qu += u;
+                                  if (qu >= p)
+                                      qu -= p;
+                              }
+                              x[u*m] = sum;
+                          }
+                      }
+                    }
+                }
+            }
+        }
+    }
+
+    void FFTPlan::execute(const complex* in, complex* out,
+                          bool inverse) const {
+        if (!inverse) {
+            forward(in, out);
+        } else {
+            std::vector<complex> tmp(n_);
+            for (Size i=0; i<n_; ++i)
+                tmp[i] = std::conj(in[i]);
+            forward(&tmp[0], out);
+            for (Size i=0; i<n_; ++i)
+                out[i] = std::conj(out[i]);
+        }
+    }
+
+    void FFTPlan::batch_transform(const complex* in, complex* out,
+                                  Size howMany) const {
+        #pragma omp parallel for if (howMany > 1)
+        for (Size i=0; i<howMany; ++i)
+            execute(in + i*n_, out + i*n_, false);
+    }
+
+    void FFTPlan::batch_inverse_transform(const complex* in, complex* out,
+                                          Size howMany) const {
+        #pragma omp parallel for if (howMany > 1)
+        for (Size i=0; i<howMany; ++i)
+            execute(in + i*n_, out + i*n_, true);
+    }
+
+
+    RealFFTPlan::RealFFTPlan(Size n)
+    : n_(n), plan_((n % 2 == 0 && n > 0) ? n/2 : n) {
+        if (n_ % 2 == 0) {
+            twiddles_.resize(n_/2 + 1);
+            for (Size k=0; k<=n_/2; ++k)
+                twiddles_[k] = unitRoot(k, n_);
+        }
+    }
+
+    void RealFFTPlan::execute(const Real* in, complex* out) const {
+        if (n_ % 2 == 1) {
+            std::vector<complex> x(in, in+n_), y(n_);
+            plan_.execute(&x[0], &y[0], false);
+            std::copy(y.begin(), y.begin() + output_size(), out);
+            return;
+        }
+
+        // even and odd samples as real and imaginary parts
+        const Size h = n_/2;
+        std::vector<complex> z(h);
+        for (Size j=0; j<h; ++j)
+            z[j] = complex(in[2*j], in[2*j+1]);
+        plan_.execute(&z[0], out, false);
+
+        // the k-th and (h-k)-th outputs depend on the same two values
+        // and are computed in place together
+        const complex z0 = out[0];
+        out[0] = complex(z0.real() + z0.imag(), 0.0);
+        out[h] = complex(z0.real() - z0.imag(), 0.0);
+        for (Size k=1; 2*k<=h; ++k) {
+            const complex a = out[k], b = std::conj(out[h-k]);
+            const complex e = 0.5*(a + b);
+            const complex o = minusI(0.5*(a - b));
+            out[k] = e + mul(twiddles_[k], o);
+            out[h-k] = std::conj(e) + mul(twiddles_[h-k], std::conj(o));
+        }
+    }
+
+    void RealFFTPlan::execute_inverse(const complex* in, Real* out) const {
+        if (n_ % 2 == 1) {
+            std::vector<complex> x(n_), y(n_);
+            x[0] = in[0];
+            for (Size k=1; k<=n_/2; ++k) {
+                x[k] = in[k];
+                x[n_-k] = std::conj(in[k]);
+            }
+            plan_.execute(&x[0], &y[0], true);
+            for (Size j=0; j<n_; ++j)
+                out[j] = y[j].real();
+            return;
+        }
+
+        const Size h = n_/2;
+        std::vector<complex> Z(h), z(h);
+        for (Size k=0; k<h; ++k) {
+            const complex a = in[k], b = std::conj(in[h-k]);
+            const complex e = 0.5*(a + b);
+            const complex o = mul(0.5*(a - b), std::conj(twiddles_[k]));
+            Z[k] = e - minusI(o);
+        }
+        plan_.execute(&Z[0], &z[0], true);
+        for (Size j=0; j<h; ++j) {
+            out[2*j]   = 2.0*z[j].real();
+            out[2*j+1] = 2.0*z[j].imag();
+        }
+    }
+
+}
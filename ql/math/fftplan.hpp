@@ -0,0 +1,186 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file fftplan.hpp
+    \brief mixed-radix fast Fourier transform plans
+*/
+
+#ifndef quantlib_fft_plan_hpp
+#define quantlib_fft_plan_hpp
+
+#include <ql/errors.hpp>
+#include <ql/types.hpp>
+#include <boost/shared_ptr.hpp>
+#include <complex>
+#include <vector>
+
+namespace QuantLib {
+
+    //! plan for complex fast Fourier transforms of a given length
+    /*! The length can be any positive integer.  It is factored into
+        radices 4, 2, 3 and other small primes, which are combined by
+        an iterative decimation-in-time algorithm; lengths with a large
+        prime factor are transformed with Bluestein's algorithm, i.e.,
+        as a convolution of power-of-two length.  The permutation of
+        the input and all the twiddle factors are computed once, at
+        construction; afterwards, the plan is not modified and can be
+        used by several threads at the same time.
+
+        The forward transform is
+        \f$ X_k = \sum_j x_j e^{-2\pi i jk/n} \f$; the inverse
+        transform has the opposite sign in the exponent and, as in
+        FastFourierTransform, is not normalized.
+
+        \test the transforms are checked against the direct
+              evaluation of the discrete Fourier transform and against
+              FastFourierTransform.
+    */
+    class FFTPlan {
+      public:
+        typedef std::complex<Real> complex;
+
+        explicit FFTPlan(Size n);
+        //! the length of the transforms
+        Size size() const { return n_; }
+        //! the required size for the output vector
+        Size output_size() const { return n_; }
+        //! the smallest length not less than n with no factors but 2, 3, 5
+        static Size good_size(Size n);
+
+        //! forward transform
+        /*! The input sequence can be shorter than size(), in which
+            case it is padded with zeros; the output sequence must be
+            allocated by the user.
+        */
+        template <class InputIterator, class RandomAccessIterator>
+        void transform(InputIterator inBegin, InputIterator inEnd,
+                       RandomAccessIterator out) const {
+            transform_impl(inBegin, inEnd, out, false);
+        }
+        //! inverse transform
+        template <class InputIterator, class RandomAccessIterator>
+        void inverse_transform(InputIterator inBegin, InputIterator inEnd,
+                               RandomAccessIterator out) const {
+            transform_impl(inBegin, inEnd, out, true);
+        }
+
+        //! transforms of several sequences of length size()
+        /*! The howMany input sequences are stored one after the other
+            in [in, in + howMany*size()), and the results are stored in
+            the same way in out; in and out must not overlap.  If
+            OpenMP is enabled, the sequences are transformed in
+            parallel.
+        */
+        void batch_transform(const complex* in, complex* out,
+                             Size howMany) const;
+        void batch_inverse_transform(const complex* in, complex* out,
+                                     Size howMany) const;
+
+        //! transform of a single sequence; in and out must not overlap
+        void execute(const complex* in, complex* out, bool inverse) const;
+      private:
+        template <class InputIterator, class RandomAccessIterator>
+        void transform_impl(InputIterator inBegin, InputIterator inEnd,
+                            RandomAccessIterator out, bool inverse) const {
+            std::vector<complex> in(n_), result(n_);
+            Size i = 0;
+            for (; inBegin != inEnd; ++i, ++inBegin) {
+                QL_REQUIRE(i < n_, "FFT size is too small");
+                in[i] = *inBegin;
+            }
+            execute(&in[0], &result[0], inverse);
+            std::copy(result.begin(), result.end(), out);
+        }
+
+        struct Stage {
+            Size radix, m;                 // transforms of length radix*m
+            std::vector<complex> twiddles; // radix-1 for each k < m
+            std::vector<complex> roots;    // for radices other than 2, 3, 4
+        };
+        void forward(const complex* in, complex* out) const;
+
+        Size n_;
+        std::vector<Size> permutation_;
+        std::vector<Stage> stages_;
+        // Bluestein
+        boost::shared_ptr<FFTPlan> convolution_;
+        std::vector<complex> chirp_, filter_;
+    };
+
+
+    //! plan for fast Fourier transforms of real sequences
+    /*! The forward transform of a real sequence of length n is
+        Hermitian, so that only its first n/2+1 values are returned.
+        For even lengths, the sequence is transformed as a complex
+        sequence of half the length, which halves the cost with
+        respect to FFTPlan.
+
+        The inverse transform takes the first n/2+1 values of a
+        Hermitian sequence and returns the real sequence of length n;
+        as for FFTPlan, it is not normalized.
+
+        \test the transforms are checked against FFTPlan.
+    */
+    class RealFFTPlan {
+      public:
+        typedef std::complex<Real> complex;
+
+        explicit RealFFTPlan(Size n);
+        Size size() const { return n_; }
+        //! the number of non-redundant values of the forward transform
+        Size output_size() const { return n_/2 + 1; }
+
+        //! forward transform; the input can be shorter than size()
+        template <class InputIterator, class RandomAccessIterator>
+        void transform(InputIterator inBegin, InputIterator inEnd,
+                       RandomAccessIterator out) const {
+            std::vector<Real> in(n_, 0.0);
+            Size i = 0;
+            for (; inBegin != inEnd; ++i, ++inBegin) {
+                QL_REQUIRE(i < n_, "FFT size is too small");
+                in[i] = *inBegin;
+            }
+            std::vector<complex> result(output_size());
+            execute(&in[0], &result[0]);
+            std::copy(result.begin(), result.end(), out);
+        }
+        //! inverse transform of the first n/2+1 values
+        template <class InputIterator, class RandomAccessIterator>
+        void inverse_transform(InputIterator inBegin, InputIterator inEnd,
+                               RandomAccessIterator out) const {
+            std::vector<complex> in(output_size());
+            Size i = 0;
+            for (; inBegin != inEnd; ++i, ++inBegin) {
+                QL_REQUIRE(i < in.size(), "FFT size is too small");
+                in[i] = *inBegin;
+            }
+            std::vector<Real> result(n_);
+            execute_inverse(&in[0], &result[0]);
+            std::copy(result.begin(), result.end(), out);
+        }
+
+        void execute(const Real* in, complex* out) const;
+        void execute_inverse(const complex* in, Real* out) const;
+      private:
+        Size n_;
+        FFTPlan plan_;                  // of length n/2 if n is even
+        std::vector<complex> twiddles_; // exp(-2 pi i k/n), k <= n/2
+    };
+
+}
+
+#endif
@@ -0,0 +1,135 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file incrementallinearleastsquares.hpp
+    \brief linear least squares regression with samples added one by one
+*/
+
+#ifndef quantlib_incremental_linear_least_squares_hpp
+#define quantlib_incremental_linear_least_squares_hpp
+
+#include <ql/math/matrixutilities/svd.hpp>
+#include <ql/math/array.hpp>
+#include <algorithm>
+#include <numeric>
+
+namespace QuantLib {
+
+    //! linear least squares regression with samples added one by one
+    /*! Each sample, i.e., the values of the basis functions at a
+        point together with the observed value, is merged into the
+        upper triangular factor \f$ R \f$ of the QR decomposition of
+        the design matrix by Givens rotations; memory is
+        \f$ O(m^2) \f$ in the number \f$ m \f$ of basis functions
+        regardless of the number of samples, and the design matrix
+        is never stored.
+
+        The coefficients are obtained from the singular value
+        decomposition of \f$ R \f$, which has the same singular
+        values and right singular vectors as the design matrix.
+        Small singular values are discarded with the same threshold
+        as GeneralLinearLeastSquares, so that the results agree with
+        the latter up to round-off, also for rank-deficient samples.
+
+        \test the results are checked against GeneralLinearLeastSquares.
+    */
+    class IncrementalLinearLeastSquares {
+      public:
+        explicit IncrementalLinearLeastSquares(Size dim);
+        //! adds the sample with basis values [begin, begin+dim())
+        template <class Iterator>
+        void add(Iterator begin, Real y);
+        void reset();
+        //! \name Inspectors
+        //@{
+        Size dim() const { return qty_.size(); }
+        Size samples() const { return samples_; }
+        //@}
+        Disposable<Array> coefficients() const;
+      private:
+        Matrix r_;
+        Array qty_, row_;
+        Size samples_;
+    };
+
+
+    // inline definitions
+
+    inline IncrementalLinearLeastSquares::IncrementalLinearLeastSquares(
+                                                                    Size dim)
+    : r_(dim, dim, 0.0), qty_(dim, 0.0), row_(dim), samples_(0) {
+        QL_REQUIRE(dim > 0, "null dimension");
+    }
+
+    template <class Iterator>
+    inline void IncrementalLinearLeastSquares::add(Iterator begin, Real y) {
+        const Size m = qty_.size();
+        std::copy(begin, begin+m, row_.begin());
+        for (Size k=0; k<m; ++k) {
+            if (row_[k] == 0.0)
+                continue;
+            // rotate (r_kk, row_k) onto (h, 0)
+            const Real h = std::sqrt(r_[k][k]*r_[k][k] + row_[k]*row_[k]);
+            const Real c = r_[k][k]/h;
+            const Real s = row_[k]/h;
+            r_[k][k] = h;
+            for (Size j=k+1; j<m; ++j) {
+                const Real t = r_[k][j];
+                r_[k][j] = c*t + s*row_[j];
+                row_[j] = c*row_[j] - s*t;
+            }
+            const Real t = qty_[k];
+            qty_[k] = c*t + s*y;
+            y = c*y - s*t;
+        }
+        ++samples_;
+    }
+
+    inline void IncrementalLinearLeastSquares::reset() {
+        std::fill(r_.begin(), r_.end(), 0.0);
+        std::fill(qty_.begin(), qty_.end(), 0.0);
+        samples_ = 0;
+    }
+
+    inline Disposable<Array>
+    IncrementalLinearLeastSquares::coefficients() const {
+        const Size m = qty_.size();
+        Array a(m, 0.0);
+        if (samples_ == 0)
+            return a;
+
+        const SVD svd(r_);
+        const Matrix& V = svd.V();
+        const Matrix& U = svd.U();
+        const Array& w = svd.singularValues();
+        const Real threshold = samples_ * QL_EPSILON * w[0];
+
+        for (Size i=0; i<m; ++i) {
+            if (w[i] > threshold) {
+                const Real u = std::inner_product(U.column_begin(i),
+                                                  U.column_end(i),
+                                                  qty_.begin(), 0.0)/w[i];
+                for (Size j=0; j<m; ++j)
+                    a[j] += u*V[j][i];
+            }
+        }
+        return a;
+    }
+
+}
+
+#endif
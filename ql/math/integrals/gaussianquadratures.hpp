@@ -230,6 +230,11 @@ namespace QuantLib {
 
         void order(Size);
         Size order() const { return order_; }
+        /*! the (order+1)/2 non-negative abscissas and their weights;
+            each abscissa but zero is used together with its opposite.
+        */
+        const Real* weights() const { return w_; }
+        const Real* x() const { return x_; }
 
       private:
         Size order_;
@@ -29,10 +29,37 @@
 #include <ql/math/interpolations/extrapolation.hpp>
 #include <ql/math/comparison.hpp>
 #include <ql/errors.hpp>
+#include <algorithm>
 #include <vector>
 
 namespace QuantLib {
 
+    namespace detail {
+
+        /* Returns the index i of the interval [x_i, x_{i+1}] containing
+           x, as the binary search in Interpolation::templateImpl::locate
+           would; the search starts from the given interval, so that it
+           takes constant time when x is in the same interval or in the
+           next one, which is the common case for sorted arguments. */
+        template <class I>
+        Size locateFrom(const I& begin, const I& end, Real x, Size i) {
+            const Size last = (end-begin)-2;
+            if (i > last)
+                i = last;
+            if (x >= begin[i]) {
+                if (i == last || x < begin[i+1])
+                    return i;
+                if (i+1 == last || x < begin[i+2])
+                    return i+1;
+                return std::upper_bound(begin+i+2, end-1, x)-begin-1;
+            } else {
+                Size j = std::upper_bound(begin, begin+i, x)-begin;
+                return j > 0 ? j-1 : 0;
+            }
+        }
+
+    }
+
     //! base class for 1-D interpolations.
     /*! Classes derived from this class will provide interpolated
         values from two sequences of equal length, representing
@@ -52,9 +79,20 @@ namespace QuantLib {
             virtual std::vector<Real> yValues() const = 0;
             virtual bool isInRange(Real) const = 0;
             virtual Real value(Real) const = 0;
+            //! as value(x), starting the search from the interval hint
+            /*! hint is set to the interval containing x.  The default
+                implementation ignores it.
+            */
+            virtual Real value(Real x, Size& /* hint */) const {
+                return value(x);
+            }
             virtual Real primitive(Real) const = 0;
             virtual Real derivative(Real) const = 0;
             virtual Real secondDerivative(Real) const = 0;
+            virtual void values(const Real* x, Size n, Real* y) const {
+                for (Size i=0; i<n; ++i)
+                    y[i] = value(x[i]);
+            }
         };
         boost::shared_ptr<Impl> impl_;
       public:
@@ -105,6 +143,10 @@ namespace QuantLib {
                 else
                     return std::upper_bound(xBegin_,xEnd_-1,x)-xBegin_-1;
             }
+            //! as locate(x), but starting the search from the interval i
+            Size locate(Real x, Size i) const {
+                return detail::locateFrom(xBegin_, xEnd_, x, i);
+            }
             I1 xBegin_, xEnd_;
             I2 yBegin_;
         };
@@ -116,6 +158,20 @@ namespace QuantLib {
             checkRange(x,allowExtrapolation);
             return impl_->value(x);
         }
+        //! value at x, starting the search from the interval hint
+        /*! hint is updated to the interval containing x, so that the
+            search takes constant time when the next point lies in the
+            same interval or in the next one.  Each caller (e.g., each
+            thread) should keep its own hint; any initial value is
+            valid.  The Linear, LogLinear, Cubic, ForwardFlat and
+            BackwardFlat interpolations (and those built on them) use
+            the hint; the others ignore it.
+        */
+        Real operator()(Real x, Size& hint,
+                        bool allowExtrapolation = false) const {
+            checkRange(x,allowExtrapolation);
+            return impl_->value(x, hint);
+        }
         Real primitive(Real x, bool allowExtrapolation = false) const {
             checkRange(x,allowExtrapolation);
             return impl_->primitive(x);
@@ -128,6 +184,23 @@ namespace QuantLib {
             checkRange(x,allowExtrapolation);
             return impl_->secondDerivative(x);
         }
+        //! values at the points in [xBegin, xEnd), written to out
+        /*! The points can be given in any order; however, the search
+            for the interval containing each of them starts from the
+            one containing the previous point, so that the cost of the
+            search is constant on average when the points are sorted.
+            The Linear, LogLinear, Cubic, ForwardFlat and BackwardFlat
+            interpolations (and those built on them) also avoid the
+            virtual call for each point.
+        */
+        void values(const Real* xBegin, const Real* xEnd, Real* out,
+                    bool allowExtrapolation = false) const {
+            if (!allowExtrapolation && !allowsExtrapolation()) {
+                for (const Real* x=xBegin; x!=xEnd; ++x)
+                    checkRange(*x, false);
+            }
+            impl_->values(xBegin, xEnd-xBegin, out);
+        }
         Real xMin() const {
             return impl_->xMin();
         }
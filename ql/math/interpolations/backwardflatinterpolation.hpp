@@ -89,6 +89,24 @@ namespace QuantLib {
                 else
                     return this->yBegin_[i+1];
             }
+            Real value(Real x, Size& hint) const {
+                Size i = hint = this->locate(x, hint);
+                if (x <= this->xBegin_[0] || x == this->xBegin_[i])
+                    return this->yBegin_[i];
+                else
+                    return this->yBegin_[i+1];
+            }
+            void values(const Real* x, Size n, Real* y) const {
+                const Real xFirst = this->xBegin_[0];
+                Size j = 0;
+                for (Size i=0; i<n; ++i) {
+                    j = this->locate(x[i], j);
+                    if (x[i] <= xFirst || x[i] == this->xBegin_[j])
+                        y[i] = this->yBegin_[j];
+                    else
+                        y[i] = this->yBegin_[j+1];
+                }
+            }
             Real primitive(Real x) const {
                 Size i = this->locate(x);
                 Real dx = x-this->xBegin_[i];
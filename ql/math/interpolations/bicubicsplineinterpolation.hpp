@@ -77,6 +77,27 @@ namespace QuantLib {
                                           CubicInterpolation::SecondDerivative, 0.0);
                 return spline(y,true);
             }
+            void values(const Real* x, const Real* y, Size n,
+                        Real* z) const {
+                // the spline along y only depends on x, so that it is
+                // built once for each run of points with the same x
+                std::vector<Real> section(splines_.size());
+                for (Size k=0; k<n; ) {
+                    Size l = k+1;
+                    while (l < n && x[l] == x[k])
+                        ++l;
+                    for (Size i=0; i<splines_.size(); i++)
+                        section[i]=splines_[i](x[k],true);
+
+                    CubicInterpolation spline(this->yBegin_, this->yEnd_,
+                                              section.begin(),
+                                              CubicInterpolation::Spline, false,
+                                              CubicInterpolation::SecondDerivative, 0.0,
+                                              CubicInterpolation::SecondDerivative, 0.0);
+                    spline.values(y+k, y+l, z+k, true);
+                    k = l;
+                }
+            }
             
             Real derivativeX(Real x, Real y) const {
                 std::vector<Real> section(this->zData_.columns());
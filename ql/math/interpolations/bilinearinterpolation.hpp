@@ -60,6 +60,27 @@ namespace QuantLib {
                 return (1.0-t)*(1.0-u)*z1 + t*(1.0-u)*z2
                      + (1.0-t)*u*z3 + t*u*z4;
             }
+            void values(const Real* x, const Real* y, Size n,
+                        Real* z) const {
+                Size i = 0, j = 0;
+                for (Size k=0; k<n; ++k) {
+                    i = this->locateX(x[k], i);
+                    j = this->locateY(y[k], j);
+
+                    Real z1 = this->zData_[j][i];
+                    Real z2 = this->zData_[j][i+1];
+                    Real z3 = this->zData_[j+1][i];
+                    Real z4 = this->zData_[j+1][i+1];
+
+                    Real t=(x[k]-this->xBegin_[i])/
+                        (this->xBegin_[i+1]-this->xBegin_[i]);
+                    Real u=(y[k]-this->yBegin_[j])/
+                        (this->yBegin_[j+1]-this->yBegin_[j]);
+
+                    z[k] = (1.0-t)*(1.0-u)*z1 + t*(1.0-u)*z2
+                         + (1.0-t)*u*z3 + t*u*z4;
+                }
+            }
         };
 
     }
@@ -698,6 +698,20 @@ namespace QuantLib {
                 Real dx_ = x-this->xBegin_[j];
                 return this->yBegin_[j] + dx_*(a_[j] + dx_*(b_[j] + dx_*c_[j]));
             }
+            Real value(Real x, Size& hint) const {
+                Size j = hint = this->locate(x, hint);
+                Real dx_ = x-this->xBegin_[j];
+                return this->yBegin_[j] + dx_*(a_[j] + dx_*(b_[j] + dx_*c_[j]));
+            }
+            void values(const Real* x, Size n, Real* y) const {
+                Size j = 0;
+                for (Size i=0; i<n; ++i) {
+                    j = this->locate(x[i], j);
+                    Real dx_ = x[i]-this->xBegin_[j];
+                    y[i] = this->yBegin_[j]
+                         + dx_*(a_[j] + dx_*(b_[j] + dx_*c_[j]));
+                }
+            }
             Real primitive(Real x) const {
                 Size j = this->locate(x);
                 Real dx_ = x-this->xBegin_[j];
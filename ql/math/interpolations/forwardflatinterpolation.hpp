@@ -86,6 +86,18 @@ namespace QuantLib {
                 Size i = this->locate(x);
                 return this->yBegin_[i];
             }
+            Real value(Real x, Size& hint) const {
+                hint = this->locate(x, hint);
+                return this->yBegin_[x >= this->xBegin_[n_-1] ? n_-1 : hint];
+            }
+            void values(const Real* x, Size n, Real* y) const {
+                const Real xLast = this->xBegin_[n_-1];
+                Size j = 0;
+                for (Size i=0; i<n; ++i) {
+                    j = this->locate(x[i], j);
+                    y[i] = this->yBegin_[x[i] >= xLast ? n_-1 : j];
+                }
+            }
             Real primitive(Real x) const {
                 Size i = this->locate(x);
                 Real dx = x-this->xBegin_[i];
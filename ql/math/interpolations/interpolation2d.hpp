@@ -25,7 +25,7 @@
 #ifndef quantlib_interpolation2D_hpp
 #define quantlib_interpolation2D_hpp
 
-#include <ql/math/interpolations/extrapolation.hpp>
+#include <ql/math/interpolation.hpp>
 #include <ql/math/comparison.hpp>
 #include <ql/math/matrix.hpp>
 #include <ql/errors.hpp>
@@ -59,6 +59,11 @@ namespace QuantLib {
             virtual const Matrix& zData() const = 0;
             virtual bool isInRange(Real x, Real y) const = 0;
             virtual Real value(Real x, Real y) const = 0;
+            virtual void values(const Real* x, const Real* y, Size n,
+                                Real* z) const {
+                for (Size i=0; i<n; ++i)
+                    z[i] = value(x[i], y[i]);
+            }
         };
         boost::shared_ptr<Impl> impl_;
       public:
@@ -145,6 +150,14 @@ namespace QuantLib {
                 else
                     return std::upper_bound(yBegin_,yEnd_-1,y)-yBegin_-1;
             }
+            //! as locateX(x), but starting the search from the interval i
+            Size locateX(Real x, Size i) const {
+                return detail::locateFrom(xBegin_, xEnd_, x, i);
+            }
+            //! as locateY(y), but starting the search from the interval j
+            Size locateY(Real y, Size j) const {
+                return detail::locateFrom(yBegin_, yEnd_, y, j);
+            }
             I1 xBegin_, xEnd_;
             I2 yBegin_, yEnd_;
             const M& zData_;
@@ -156,6 +169,21 @@ namespace QuantLib {
             checkRange(x,y,allowExtrapolation);
             return impl_->value(x,y);
         }
+        //! values at the points (x_i, y_i), written to out
+        /*! As for Interpolation::values, the search for the cell
+            containing each point starts from the one containing the
+            previous point, so that sorted points (e.g., along a line
+            or a row of the grid) are located in constant time.
+        */
+        void values(const Real* xBegin, const Real* xEnd,
+                    const Real* yBegin, Real* out,
+                    bool allowExtrapolation = false) const {
+            if (!allowExtrapolation && !allowsExtrapolation()) {
+                for (Size i=0; i<Size(xEnd-xBegin); ++i)
+                    checkRange(xBegin[i], yBegin[i], false);
+            }
+            impl_->values(xBegin, yBegin, xEnd-xBegin, out);
+        }
         Real xMin() const {
             return impl_->xMin();
         }
@@ -86,6 +86,17 @@ namespace QuantLib {
                 Size i = this->locate(x);
                 return this->yBegin_[i] + (x-this->xBegin_[i])*s_[i];
             }
+            Real value(Real x, Size& hint) const {
+                Size i = hint = this->locate(x, hint);
+                return this->yBegin_[i] + (x-this->xBegin_[i])*s_[i];
+            }
+            void values(const Real* x, Size n, Real* y) const {
+                Size j = 0;
+                for (Size i=0; i<n; ++i) {
+                    j = this->locate(x[i], j);
+                    y[i] = this->yBegin_[j] + (x[i]-this->xBegin_[j])*s_[j];
+                }
+            }
             Real primitive(Real x) const {
                 Size i = this->locate(x);
                 Real dx = x-this->xBegin_[i];
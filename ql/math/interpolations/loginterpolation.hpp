@@ -308,6 +308,14 @@ namespace QuantLib {
             Real value(Real x) const {
                 return std::exp(interpolation_(x, true));
             }
+            Real value(Real x, Size& hint) const {
+                return std::exp(interpolation_(x, hint, true));
+            }
+            void values(const Real* x, Size n, Real* y) const {
+                interpolation_.values(x, x+n, y, true);
+                for (Size i=0; i<n; ++i)
+                    y[i] = std::exp(y[i]);
+            }
             Real primitive(Real) const {
                 QL_FAIL("LogInterpolation primitive not implemented");
             }
@@ -56,9 +56,145 @@
 #pragma clang diagnostic pop
 #endif
 
+#include <vector>
+
+#if defined(QL_ENABLE_LAPACK)
+extern "C" {
+    void dgemm_(const char* transa, const char* transb,
+                const int* m, const int* n, const int* k,
+                const double* alpha, const double* a, const int* lda,
+                const double* b, const int* ldb,
+                const double* beta, double* c, const int* ldc);
+}
+#endif
 
 namespace QuantLib {
 
+    namespace {
+
+        // dimensions of the blocks of the result kept in registers
+        const Size mr = 4, nr = 8;
+
+        #if !defined(QL_ENABLE_LAPACK)
+
+        // depth of the panels of the factors kept in cache
+        const Size kc = 256;
+
+        // adds the product of the mr rows of the first factor, starting
+        // at a[0]...a[mr-1], by a packed n x nr panel of the second one
+        // to the block c; the fixed trip count of the inner loop allows
+        // the compiler to vectorize it
+        inline void multiplyBlock(Size n, const Real* const* a,
+                                  const Real* b, Real c[mr][nr]) {
+            for (Size k=0; k<n; ++k, b+=nr) {
+                const Real x0 = a[0][k], x1 = a[1][k],
+                           x2 = a[2][k], x3 = a[3][k];
+                for (Size j=0; j<nr; ++j) {
+                    c[0][j] += x0*b[j];
+                    c[1][j] += x1*b[j];
+                    c[2][j] += x2*b[j];
+                    c[3][j] += x3*b[j];
+                }
+            }
+        }
+
+        #endif
+
+    }
+
+    void multiply(const Matrix& m1, const Matrix& m2, Matrix& result) {
+        QL_REQUIRE(m1.columns() == m2.rows(),
+                   "matrices with different sizes (" <<
+                   m1.rows() << "x" << m1.columns() << ", " <<
+                   m2.rows() << "x" << m2.columns() << ") cannot be "
+                   "multiplied");
+        QL_REQUIRE(result.rows() == m1.rows() &&
+                   result.columns() == m2.columns(),
+                   "result matrix has wrong size (" <<
+                   result.rows() << "x" << result.columns() << " instead of "
+                   << m1.rows() << "x" << m2.columns() << ")");
+        QL_REQUIRE(&result != &m1 && &result != &m2,
+                   "result matrix cannot be one of the factors");
+
+        const Size m = m1.rows(), l = m1.columns(), n = m2.columns();
+        if (m == 0 || n == 0)
+            return;
+        if (l == 0) {
+            std::fill(result.begin(), result.end(), 0.0);
+            return;
+        }
+
+        if (m < mr || n < 2*nr) {
+            // not worth blocking
+            std::fill(result.begin(), result.end(), 0.0);
+            for (Size i=0; i<m; ++i)
+                for (Size k=0; k<l; ++k)
+                    for (Size j=0; j<n; ++j)
+                        result[i][j] += m1[i][k]*m2[k][j];
+            return;
+        }
+
+        #if defined(QL_ENABLE_LAPACK)
+
+        // the row-major product C = A B is the column-major
+        // product C^T = B^T A^T
+        const int rows = int(n), columns = int(m), depth = int(l);
+        const double one = 1.0, zero = 0.0;
+        dgemm_("N", "N", &rows, &columns, &depth,
+               &one, m2.begin(), &rows, m1.begin(), &depth,
+               &zero, result.begin(), &rows);
+
+        #else
+
+        std::fill(result.begin(), result.end(), 0.0);
+
+        /* The second factor is copied in panels of kc rows, split in
+           contiguous blocks of nr columns (the last one padded with
+           zeroes); each panel is multiplied by the corresponding
+           columns of the first factor, mr rows at a time.  As in the
+           plain triple loop, each element of the result accumulates
+           its terms in increasing order of k, so that the results are
+           the same unless the compiler contracts the two loops into
+           fused multiply-adds differently.  This doesn't hold for the
+           dgemm call above, which may sum in any order; the results
+           then agree up to round-off.
+        */
+        const Size blocks = (n+nr-1)/nr;
+        std::vector<Real> panel(std::min(l,kc)*blocks*nr);
+        for (Size k0=0; k0<l; k0+=kc) {
+            const Size depth = std::min(kc, l-k0);
+            for (Size b=0; b<blocks; ++b) {
+                const Size j0 = b*nr, width = std::min(nr, n-j0);
+                Real* p = &panel[b*depth*nr];
+                for (Size k=0; k<depth; ++k, p+=nr) {
+                    std::copy(m2[k0+k]+j0, m2[k0+k]+j0+width, p);
+                    std::fill(p+width, p+nr, 0.0);
+                }
+            }
+            for (Size i0=0; i0<m; i0+=mr) {
+                // missing rows in the last block are replaced by
+                // copies of the last one, and discarded afterwards
+                const Size height = std::min(mr, m-i0);
+                const Real* a[mr];
+                for (Size r=0; r<mr; ++r)
+                    a[r] = m1[i0+std::min(r,height-1)]+k0;
+                for (Size b=0; b<blocks; ++b) {
+                    const Size j0 = b*nr, width = std::min(nr, n-j0);
+                    Real c[mr][nr];
+                    for (Size r=0; r<mr; ++r)
+                        for (Size j=0; j<nr; ++j)
+                            c[r][j] = (r<height && j<width) ?
+                                result[i0+r][j0+j] : 0.0;
+                    multiplyBlock(depth, a, &panel[b*depth*nr], c);
+                    for (Size r=0; r<height; ++r)
+                        std::copy(c[r], c[r]+width, result[i0+r]+j0);
+                }
+            }
+        }
+
+        #endif
+    }
+
     Disposable<Matrix> inverse(const Matrix& m) {
         #if !defined(QL_NO_UBLAS_SUPPORT)
 
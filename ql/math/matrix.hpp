@@ -158,6 +158,15 @@ namespace QuantLib {
     /*! \relates Matrix */
     const Disposable<Matrix> operator*(const Matrix&, const Matrix&);
 
+    /*! \relates Matrix
+        Stores the product of m1 and m2 into result, which must
+        already have the right size and must be distinct from both
+        factors.  No matrix is allocated, which makes this preferable
+        to operator* in loops where the product is computed
+        repeatedly.
+    */
+    void multiply(const Matrix& m1, const Matrix& m2, Matrix& result);
+
     // misc. operations
 
     /*! \relates Matrix */
@@ -538,19 +547,8 @@ namespace QuantLib {
 
     inline const Disposable<Matrix> operator*(const Matrix& m1,
                                               const Matrix& m2) {
-        QL_REQUIRE(m1.columns() == m2.rows(),
-                   "matrices with different sizes (" <<
-                   m1.rows() << "x" << m1.columns() << ", " <<
-                   m2.rows() << "x" << m2.columns() << ") cannot be "
-                   "multiplied");
-        Matrix result(m1.rows(),m2.columns(),0.0);
-        for (Size i=0; i<result.rows(); ++i) {
-            for (Size k=0; k<m1.columns(); ++k) {
-                for (Size j=0; j<result.columns(); ++j) {
-                    result[i][j] += m1[i][k]*m2[k][j];
-                }
-            }
-        }
+        Matrix result(m1.rows(),m2.columns());
+        multiply(m1, m2, result);
         return result;
     }
 
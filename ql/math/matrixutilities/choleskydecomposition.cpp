@@ -21,6 +21,13 @@
 #include <ql/math/matrixutilities/choleskydecomposition.hpp>
 #include <ql/math/comparison.hpp>
 
+#if defined(QL_ENABLE_LAPACK)
+extern "C" {
+    void dpotrf_(const char* uplo, const int* n, double* a,
+                 const int* lda, int* info);
+}
+#endif
+
 namespace QuantLib {
 
     const Disposable<Matrix> CholeskyDecomposition(const Matrix &S,
@@ -36,6 +43,26 @@ namespace QuantLib {
                            "input matrix is not symmetric");
         #endif
 
+        #if defined(QL_ENABLE_LAPACK)
+        if (size > 0) {
+            // the upper factor of the column-major (symmetric) matrix
+            // is the lower factor of the row-major one
+            Matrix factor = S;
+            const int n = int(size);
+            int info = 0;
+            dpotrf_("U", &n, factor.begin(), &n, &info);
+            QL_REQUIRE(info >= 0, "invalid argument passed to dpotrf");
+            if (info == 0) {
+                for (i=0; i<size; i++)
+                    std::fill(factor.row_begin(i)+i+1, factor.row_end(i),
+                              0.0);
+                return factor;
+            }
+            QL_REQUIRE(flexible, "input matrix is not positive definite");
+            // semi-definite matrices are handled below
+        }
+        #endif
+
         Matrix result(size, size, 0.0);
         Real sum;
         for (i=0; i<size; i++) {
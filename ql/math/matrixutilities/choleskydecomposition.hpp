@@ -28,7 +28,11 @@
 
 namespace QuantLib {
 
-    /*! \relates Matrix */
+    /*! \relates Matrix
+
+        If QL_ENABLE_LAPACK is defined, positive-definite matrices
+        are decomposed by the LAPACK dpotrf routine.
+    */
     const Disposable<Matrix> CholeskyDecomposition(const Matrix& m,
                                                    bool flexible = false);
 
@@ -0,0 +1,129 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file gmres.cpp
+    \brief generalized minimal residual method
+*/
+
+#include <ql/math/matrixutilities/gmres.hpp>
+#include <algorithm>
+#include <vector>
+
+namespace QuantLib {
+
+    GMRES::GMRES(const GMRES::MatrixMult& A,
+                 Size maxIter, Real relTol,
+                 const GMRES::MatrixMult& preConditioner)
+    : A_(A), M_(preConditioner),
+      maxIter_(maxIter), relTol_(relTol) {
+        QL_REQUIRE(maxIter_ > 0, "maxIter must be greater than zero");
+    }
+
+    GMRESResult GMRES::solve(const Array& b, const Array& x0) const {
+        return solveWithRestart(maxIter_, b, x0);
+    }
+
+    GMRESResult GMRES::solveWithRestart(Size restart, const Array& b,
+                                        const Array& x0) const {
+        QL_REQUIRE(restart > 0, "restart must be greater than zero");
+
+        const Real bnorm2 = norm2(b);
+        if (bnorm2 == 0.0) {
+            GMRESResult result = { 0, 0.0, b};
+            return result;
+        }
+
+        Array x = ((!x0.empty()) ? x0 : Array(b.size(), 0.0));
+        Array r = b - A_(x);
+        Real beta = norm2(r);
+        Real error = beta/bnorm2;
+
+        Size iterations = 0;
+        while (error >= relTol_ && iterations < maxIter_) {
+            const Size m = std::min(restart, maxIter_-iterations);
+
+            // Arnoldi process with modified Gram-Schmidt; the
+            // Hessenberg matrix, stored by columns, is reduced to
+            // upper triangular form by Givens rotations as it is built.
+            std::vector<Array> v(1, r/beta), z, h;
+            std::vector<Real> cs, sn, g(1, beta);
+
+            Size j;
+            for (j=0; j < m && error >= relTol_; ++j, ++iterations) {
+                z.push_back((M_) ? M_(v[j]) : v[j]);
+                Array w = A_(z[j]);
+                h.push_back(Array(j+2));
+                Array& hj = h.back();
+                for (Size i=0; i <= j; ++i) {
+                    const Real hij = DotProduct(w, v[i]);
+                    for (Size k=0; k < w.size(); ++k)
+                        w[k] -= hij*v[i][k];
+                    hj[i] = hij;
+                }
+                hj[j+1] = norm2(w);
+                if (hj[j+1] != 0.0)
+                    v.push_back(w/hj[j+1]);
+
+                for (Size i=0; i < j; ++i) {
+                    const Real t = cs[i]*hj[i] + sn[i]*hj[i+1];
+                    hj[i+1] = -sn[i]*hj[i] + cs[i]*hj[i+1];
+                    hj[i] = t;
+                }
+                const Real d = std::sqrt(hj[j]*hj[j] + hj[j+1]*hj[j+1]);
+                QL_REQUIRE(d != 0.0, "singular matrix in GMRES");
+                cs.push_back(hj[j]/d);
+                sn.push_back(hj[j+1]/d);
+                hj[j] = d;
+                hj[j+1] = 0.0;
+
+                g.push_back(-sn[j]*g[j]);
+                g[j] *= cs[j];
+                error = std::fabs(g[j+1])/bnorm2;
+
+                // lucky breakdown, the solution is in the basis
+                if (v.size() == j+1) {
+                    ++j; ++iterations;
+                    break;
+                }
+            }
+
+            Array y(j);
+            for (Integer i=Integer(j)-1; i >= 0; --i) {
+                Real s = g[i];
+                for (Size k=i+1; k < j; ++k)
+                    s -= h[k][i]*y[k];
+                y[i] = s/h[i][i];
+            }
+            for (Size i=0; i < j; ++i)
+                for (Size k=0; k < x.size(); ++k)
+                    x[k] += y[i]*z[i][k];
+
+            r = b - A_(x);
+            beta = norm2(r);
+            error = beta/bnorm2;
+        }
+
+        QL_REQUIRE(error < relTol_, "could not converge");
+
+        GMRESResult result = { iterations, error, x};
+        return result;
+    }
+
+    Real GMRES::norm2(const Array& a) const {
+        return std::sqrt(DotProduct(a, a));
+    }
+}
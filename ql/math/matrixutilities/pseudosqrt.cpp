@@ -124,7 +124,7 @@ namespace QuantLib {
                 }
                 Real temp, error=0;
                 tempMatrix_ = transpose(currentRoot_);
-                currentMatrix_ = currentRoot_ * tempMatrix_;
+                multiply(currentRoot_, tempMatrix_, currentMatrix_);
                 for (i=0;i<size_;i++) {
                     for (j=0;j<size_;j++) {
                         temp = currentMatrix_[i][j]*targetVariance_[i]
@@ -432,10 +432,12 @@ namespace QuantLib {
     }
 
 
-    const Disposable<Matrix> rankReducedSqrt(const Matrix& matrix,
-                                             Size maxRank,
-                                             Real componentRetainedPercentage,
-                                             SalvagingAlgorithm::Type sa) {
+    const Disposable<Matrix> rankReducedSqrt(
+                          const Matrix& matrix,
+                          Size maxRank,
+                          Real componentRetainedPercentage,
+                          SalvagingAlgorithm::Type sa,
+                          SymmetricSchurDecomposition::Algorithm algorithm) {
         Size size = matrix.rows();
 
         #if defined(QL_EXTRA_SAFETY_CHECKS)
@@ -456,7 +458,7 @@ namespace QuantLib {
                    "max rank required < 1");
 
         // spectral (a.k.a Principal Component) analysis
-        SymmetricSchurDecomposition jd(matrix);
+        SymmetricSchurDecomposition jd(matrix, algorithm);
         Array eigenValues = jd.eigenvalues();
 
         // salvaging algorithm
@@ -478,7 +480,8 @@ namespace QuantLib {
                   int maxIterations = 40;
                   Real tolerance = 1e-6;
                   Matrix adjustedMatrix = highamImplementation(matrix, maxIterations, tolerance);
-                  jd = SymmetricSchurDecomposition(adjustedMatrix);
+                  jd = SymmetricSchurDecomposition(adjustedMatrix,
+                                                   algorithm);
                   eigenValues = jd.eigenvalues();
               }
               break;
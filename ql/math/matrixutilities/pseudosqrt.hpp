@@ -24,7 +24,7 @@
 #ifndef quantlib_pseudo_sqrt_hpp
 #define quantlib_pseudo_sqrt_hpp
 
-#include <ql/math/matrix.hpp>
+#include <ql/math/matrixutilities/symmetricschurdecomposition.hpp>
 
 namespace QuantLib {
 
@@ -74,14 +74,20 @@ namespace QuantLib {
         approximation of the pseudo square root using a (user selected)
         salvaging algorithm.
 
+        The spectral decomposition uses the given eigenvalue
+        algorithm; see SymmetricSchurDecomposition.
+
         \pre the given matrix must be symmetric.
 
         \relates Matrix
     */
-    const Disposable<Matrix> rankReducedSqrt(const Matrix&,
-                                             Size maxRank,
-                                             Real componentRetainedPercentage,
-                                             SalvagingAlgorithm::Type);
+    const Disposable<Matrix> rankReducedSqrt(
+              const Matrix&,
+              Size maxRank,
+              Real componentRetainedPercentage,
+              SalvagingAlgorithm::Type,
+              SymmetricSchurDecomposition::Algorithm =
+                                    SymmetricSchurDecomposition::Jacobi);
 
 }
 
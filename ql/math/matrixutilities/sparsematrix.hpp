@@ -65,15 +65,28 @@ namespace QuantLib {
     typedef boost::numeric::ublas::matrix_reference<SparseMatrix>
         SparseMatrixReference;
 
+    /*! The product runs directly on the compressed rows of the
+        matrix; if OpenMP is enabled, the rows are split among the
+        available threads when there are enough of them to pay for
+        the overhead.
+    */
     inline Disposable<Array> prod(const SparseMatrix& A, const Array& x) {
-        Array b(x.size());
+        QL_REQUIRE(x.size() == A.size2(),
+                   "vector size does not match matrix size");
 
-        for (Size i=0; i < A.filled1()-1; ++i) {
-            const Size begin = A.index1_data()[i];
-            const Size end   = A.index1_data()[i+1];
+        // rows past the filled ones are empty
+        Array b(A.size1(), 0.0);
+
+        const Size rows = A.filled1()-1;
+        const Size* const index1 = A.index1_data().begin();
+        const Size* const index2 = A.index2_data().begin();
+        const Real* const values = A.value_data().begin();
+
+        #pragma omp parallel for if (rows > 10000)
+        for (Size i=0; i < rows; ++i) {
             Real t=0;
-            for (Size j=begin; j < end; ++j) {
-                t += A.value_data()[j]*x[A.index2_data()[j]];
+            for (Size j=index1[i]; j < index1[i+1]; ++j) {
+                t += values[j]*x[index2[j]];
             }
 
             b[i]=t;
@@ -0,0 +1,125 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/qldefines.hpp>
+
+#if !defined(QL_NO_UBLAS_SUPPORT)
+
+#include <ql/math/matrixutilities/sparsepreconditioners.hpp>
+
+namespace QuantLib {
+
+    SparseJacobiPreconditioner::SparseJacobiPreconditioner(
+                                                        const SparseMatrix& A)
+    : inverseDiagonal_(A.size1()) {
+        QL_REQUIRE(A.size1() == A.size2(),
+                   "Jacobi preconditioner works only with square matrices");
+        for (Size i=0; i < A.size1(); ++i) {
+            const Real d = A(i,i);
+            QL_REQUIRE(d != 0.0, "zero diagonal element in row " << i);
+            inverseDiagonal_[i] = 1.0/d;
+        }
+    }
+
+    Disposable<Array> SparseJacobiPreconditioner::apply(
+                                                     const Array& b) const {
+        QL_REQUIRE(b.size() == inverseDiagonal_.size(),
+                   "vector size does not match matrix size");
+        Array x(b.size());
+        for (Size i=0; i < b.size(); ++i)
+            x[i] = b[i]*inverseDiagonal_[i];
+        return x;
+    }
+
+
+    SparseILU0Preconditioner::SparseILU0Preconditioner(const SparseMatrix& A)
+    : rows_(A.size1()+1), diagonal_(A.size1()) {
+        QL_REQUIRE(A.size1() == A.size2(),
+                   "ILU(0) preconditioner works only with square matrices");
+
+        const Size n = A.size1();
+        const Size filledRows = A.filled1()-1;
+
+        // copy the compressed rows, which the matrix keeps sorted;
+        // rows past the filled ones are empty
+        columns_.assign(A.index2_data().begin(),
+                        A.index2_data().begin()+A.filled2());
+        values_.assign(A.value_data().begin(),
+                       A.value_data().begin()+A.filled2());
+        for (Size i=0; i <= n; ++i)
+            rows_[i] = (i <= filledRows) ? A.index1_data()[i] : A.filled2();
+
+        for (Size i=0; i < n; ++i) {
+            Size k = rows_[i];
+            while (k < rows_[i+1] && columns_[k] < i)
+                ++k;
+            QL_REQUIRE(k < rows_[i+1] && columns_[k] == i
+                       && values_[k] != 0.0,
+                       "zero diagonal element in row " << i);
+            diagonal_[i] = k;
+        }
+
+        // IKJ variant of the Gaussian elimination restricted to the
+        // sparsity pattern of the matrix
+        std::vector<Size> position(n, Null<Size>());
+        for (Size i=1; i < n; ++i) {
+            for (Size k=rows_[i]; k < rows_[i+1]; ++k)
+                position[columns_[k]] = k;
+
+            for (Size k=rows_[i]; k < diagonal_[i]; ++k) {
+                const Size l = columns_[k];
+                values_[k] /= values_[diagonal_[l]];
+                const Real f = values_[k];
+                for (Size m=diagonal_[l]+1; m < rows_[l+1]; ++m) {
+                    const Size p = position[columns_[m]];
+                    if (p != Null<Size>())
+                        values_[p] -= f*values_[m];
+                }
+            }
+            QL_REQUIRE(values_[diagonal_[i]] != 0.0,
+                       "zero pivot in row " << i);
+
+            for (Size k=rows_[i]; k < rows_[i+1]; ++k)
+                position[columns_[k]] = Null<Size>();
+        }
+    }
+
+    Disposable<Array> SparseILU0Preconditioner::apply(const Array& b) const {
+        const Size n = diagonal_.size();
+        QL_REQUIRE(b.size() == n, "vector size does not match matrix size");
+
+        Array x(b);
+        // forward substitution with L, which has a unit diagonal...
+        for (Size i=0; i < n; ++i) {
+            Real s = x[i];
+            for (Size k=rows_[i]; k < diagonal_[i]; ++k)
+                s -= values_[k]*x[columns_[k]];
+            x[i] = s;
+        }
+        // ...and backward substitution with U, in place
+        for (Size i=n; i-- > 0; ) {
+            Real s = x[i];
+            for (Size k=diagonal_[i]+1; k < rows_[i+1]; ++k)
+                s -= values_[k]*x[columns_[k]];
+            x[i] = s/values_[diagonal_[i]];
+        }
+        return x;
+    }
+
+}
+
+#endif
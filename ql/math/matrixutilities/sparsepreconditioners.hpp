@@ -0,0 +1,77 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file sparsepreconditioners.hpp
+    \brief Jacobi and ILU(0) preconditioners for sparse matrices
+*/
+
+#ifndef quantlib_sparse_preconditioners_hpp
+#define quantlib_sparse_preconditioners_hpp
+
+#include <ql/qldefines.hpp>
+
+#if !defined(QL_NO_UBLAS_SUPPORT)
+
+#include <ql/math/array.hpp>
+#include <ql/math/matrixutilities/sparsematrix.hpp>
+#include <vector>
+
+namespace QuantLib {
+
+    //! Jacobi preconditioner
+    /*! Divides by the diagonal of the matrix, which must not contain
+        zeros.
+    */
+    class SparseJacobiPreconditioner {
+      public:
+        explicit SparseJacobiPreconditioner(const SparseMatrix& A);
+        Disposable<Array> apply(const Array& b) const;
+      private:
+        Array inverseDiagonal_;
+    };
+
+    //! Incomplete LU preconditioner without fill-in
+    /*! The factors have the same sparsity pattern as the matrix and
+        are stored together in compressed-row form, so that both the
+        factorization and the triangular solves run over the non-zero
+        entries only.  Their cost is proportional to the number of
+        non-zero entries, unlike that of SparseILUPreconditioner which
+        is quadratic in the size of the matrix; the latter allows for
+        fill-in, though, and can therefore be more accurate.  The
+        diagonal of the matrix must not contain zeros.
+
+        References:
+        Saad, Yousef. 1996, Iterative methods for sparse linear systems,
+        http://www-users.cs.umn.edu/~saad/books.html
+
+        \test the factorization is checked to be exact for a
+              tridiagonal matrix and is used with GMRES and BiCGstab.
+    */
+    class SparseILU0Preconditioner {
+      public:
+        explicit SparseILU0Preconditioner(const SparseMatrix& A);
+        Disposable<Array> apply(const Array& b) const;
+      private:
+        // compressed rows of L (unit diagonal omitted) and U together
+        std::vector<Size> rows_, columns_, diagonal_;
+        std::vector<Real> values_;
+    };
+
+}
+
+#endif
+#endif
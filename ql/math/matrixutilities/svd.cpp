@@ -34,11 +34,24 @@
 
 
 #include <ql/math/matrixutilities/svd.hpp>
+#include <vector>
+
+#if defined(QL_ENABLE_LAPACK)
+extern "C" {
+    void dgesvd_(const char* jobu, const char* jobvt,
+                 const int* m, const int* n, double* a, const int* lda,
+                 double* s, double* u, const int* ldu,
+                 double* vt, const int* ldvt,
+                 double* work, const int* lwork, int* info);
+}
+#endif
 
 namespace QuantLib {
 
     namespace {
 
+        #if !defined(QL_ENABLE_LAPACK)
+
         /*  returns hypotenuse of real (non-complex) scalars a and b by
             avoiding underflow/overflow
             using (a * sqrt( 1 + (b/a) * (b/a))), rather than
@@ -53,6 +66,8 @@ namespace QuantLib {
             }
         }
 
+        #endif
+
     }
 
 
@@ -94,6 +109,34 @@ namespace QuantLib {
         s_ = Array(n_);
         U_ = Matrix(m_,n_, 0.0);
         V_ = Matrix(n_,n_);
+
+        #if defined(QL_ENABLE_LAPACK)
+
+        /* The row-major A is seen by LAPACK as the column-major A^T.
+           Decomposing the latter as X S Y^T gives A = Y S X^T; the
+           row-major Y has the same layout as the column-major Y^T
+           returned by LAPACK, while X must be transposed.
+        */
+        const int rows = n_, columns = m_;
+        std::vector<Real> x(n_*n_);
+        Real optimalSize;
+        int lwork = -1, info = 0;
+        dgesvd_("S", "S", &rows, &columns, A.begin(), &rows, s_.begin(),
+                &x[0], &rows, U_.begin(), &rows,
+                &optimalSize, &lwork, &info);
+        lwork = int(optimalSize);
+        std::vector<Real> work(lwork);
+        dgesvd_("S", "S", &rows, &columns, A.begin(), &rows, s_.begin(),
+                &x[0], &rows, U_.begin(), &rows,
+                &work[0], &lwork, &info);
+        QL_REQUIRE(info >= 0, "invalid argument passed to dgesvd");
+        QL_REQUIRE(info == 0, "singular value decomposition did not converge");
+        for (Integer i=0; i<n_; i++)
+            for (Integer k=0; k<n_; k++)
+                V_[i][k] = x[k*n_+i];
+
+        #else
+
         Array e(n_);
         Array work(m_);
         Integer i, j, k;
@@ -480,6 +523,7 @@ namespace QuantLib {
                 break;
             }
         }
+        #endif
     }
 
     const Matrix& SVD::U() const {
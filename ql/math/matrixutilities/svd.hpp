@@ -48,6 +48,10 @@ namespace QuantLib {
     /*! Refer to Golub and Van Loan: Matrix computation,
         The Johns Hopkins University Press
 
+        If QL_ENABLE_LAPACK is defined, the decomposition is
+        delegated to the LAPACK dgesvd routine; the singular vectors
+        might then differ in sign from those returned otherwise.
+
         \test the correctness of the returned values is tested by
               checking their properties.
     */
@@ -19,16 +19,32 @@
 */
 
 #include <ql/math/matrixutilities/symmetricschurdecomposition.hpp>
+#include <ql/math/matrixutilities/tqreigendecomposition.hpp>
 #include <vector>
 
+#if defined(QL_ENABLE_LAPACK)
+extern "C" {
+    void dsyev_(const char* jobz, const char* uplo, const int* n,
+                double* a, const int* lda, double* w,
+                double* work, const int* lwork, int* info);
+}
+#endif
+
 namespace QuantLib {
 
-    SymmetricSchurDecomposition::SymmetricSchurDecomposition(const Matrix & s)
+    SymmetricSchurDecomposition::SymmetricSchurDecomposition(
+                                                 const Matrix & s,
+                                                 Algorithm algorithm)
     : diagonal_(s.rows()), eigenVectors_(s.rows(), s.columns(), 0.0) {
 
         QL_REQUIRE(s.rows() > 0 && s.columns() > 0, "null matrix given");
         QL_REQUIRE(s.rows()==s.columns(), "input matrix must be square");
 
+        if (algorithm == TridiagonalQR) {
+            tridiagonalQR_(s);
+            return;
+        }
+
         Size size = s.rows();
         for (Size q=0; q<size; q++) {
             diagonal_[q] = s[q][q];
@@ -138,4 +154,121 @@ namespace QuantLib {
         }
     }
 
+    void SymmetricSchurDecomposition::tridiagonalQR_(const Matrix& s) {
+        Size size = s.rows();
+
+        #if defined(QL_ENABLE_LAPACK)
+
+        // the matrix is symmetric, so storage order doesn't matter;
+        // the eigenvectors are returned in the columns of the
+        // column-major result, i.e., in its rows when read row-major,
+        // and in order of increasing eigenvalue
+        Matrix a = s;
+        Array w(size);
+        const int n = int(size);
+        Real optimalSize;
+        int lwork = -1, info = 0;
+        dsyev_("V", "U", &n, a.begin(), &n, w.begin(),
+               &optimalSize, &lwork, &info);
+        lwork = int(optimalSize);
+        std::vector<Real> work(lwork);
+        dsyev_("V", "U", &n, a.begin(), &n, w.begin(),
+               &work[0], &lwork, &info);
+        QL_REQUIRE(info >= 0, "invalid argument passed to dsyev");
+        QL_REQUIRE(info == 0, "eigenvalue decomposition did not converge");
+        for (Size col=0; col<size; ++col) {
+            diagonal_[col] = w[size-1-col];
+            std::copy(a.row_begin(size-1-col), a.row_end(size-1-col),
+                      eigenVectors_.column_begin(col));
+        }
+
+        #else
+
+        Matrix a = s;
+        Matrix q(size, size, 0.0);
+        for (Size i=0; i<size; ++i)
+            q[i][i] = 1.0;
+
+        // Householder reduction: after step k, the k-th column of a
+        // is zero below the subdiagonal. The reflections are
+        // accumulated in q, so that s = q * a * q^T at the end.
+        std::vector<Real> v(size), p(size);
+        for (Size k=0; k+2<size; ++k) {
+            Real norm2 = 0.0;
+            for (Size i=k+1; i<size; ++i)
+                norm2 += a[i][k]*a[i][k];
+            if (norm2 == 0.0)
+                continue;
+            const Real alpha = (a[k+1][k] > 0.0 ? -1.0 : 1.0)
+                * std::sqrt(norm2);
+            Real vNorm2 = 0.0;
+            for (Size i=k+1; i<size; ++i) {
+                v[i] = a[i][k];
+                if (i == k+1)
+                    v[i] -= alpha;
+                vNorm2 += v[i]*v[i];
+            }
+            if (vNorm2 == 0.0)
+                continue;
+            const Real beta = 2.0/vNorm2;
+
+            // a <- h a h with h = 1 - beta v v^T on the trailing block
+            Real vp = 0.0;
+            for (Size i=k+1; i<size; ++i) {
+                Real sum = 0.0;
+                for (Size j=k+1; j<size; ++j)
+                    sum += a[i][j]*v[j];
+                p[i] = beta*sum;
+                vp += v[i]*p[i];
+            }
+            const Real kappa = 0.5*beta*vp;
+            for (Size i=k+1; i<size; ++i)
+                p[i] -= kappa*v[i];
+            for (Size i=k+1; i<size; ++i)
+                for (Size j=k+1; j<size; ++j)
+                    a[i][j] -= v[i]*p[j] + p[i]*v[j];
+            a[k+1][k] = a[k][k+1] = alpha;
+            for (Size i=k+2; i<size; ++i)
+                a[i][k] = a[k][i] = 0.0;
+
+            // q <- q h
+            for (Size i=0; i<size; ++i) {
+                Real sum = 0.0;
+                for (Size j=k+1; j<size; ++j)
+                    sum += q[i][j]*v[j];
+                sum *= beta;
+                for (Size j=k+1; j<size; ++j)
+                    q[i][j] -= sum*v[j];
+            }
+        }
+
+        Array d(size), e(size-1);
+        for (Size i=0; i<size; ++i)
+            d[i] = a[i][i];
+        for (Size i=0; i+1<size; ++i)
+            e[i] = a[i+1][i];
+
+        TqrEigenDecomposition tqr(d, e,
+                                  TqrEigenDecomposition::WithEigenVector,
+                                  TqrEigenDecomposition::CloseEigenValue);
+
+        // eigenvalues come sorted in decreasing order
+        diagonal_ = tqr.eigenvalues();
+        eigenVectors_ = q * tqr.eigenvectors();
+
+        #endif
+
+        Real maxEv = std::max(std::fabs(diagonal_[0]),
+                              std::fabs(diagonal_[size-1]));
+        for (Size col=0; col<size; ++col) {
+            // check for round-off errors
+            if (std::fabs(diagonal_[col]) <= size*QL_EPSILON*maxEv)
+                diagonal_[col] = 0.0;
+            if (eigenVectors_[0][col] < 0.0) {
+                for (Size row=0; row<size; ++row)
+                    eigenVectors_[row][col] = -eigenVectors_[row][col];
+            }
+        }
+    }
+
 }
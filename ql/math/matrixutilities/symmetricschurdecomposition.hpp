@@ -44,18 +44,33 @@ namespace QuantLib {
         second edition, by Golub and Van Loan,
         The Johns Hopkins University Press
 
+        Alternatively, the matrix can be reduced to tridiagonal form
+        by Householder reflections and the tridiagonal problem solved
+        by the implicit-shift QR algorithm of TqrEigenDecomposition.
+        This takes a fixed number of \f$ O(n^3) \f$ steps instead of
+        repeated Jacobi sweeps and is considerably faster for larger
+        matrices; results agree with the Jacobi ones up to round-off,
+        apart from the choice of eigenvectors for degenerate
+        eigenvalues. Eigenvalues whose absolute value is below
+        \f$ n \epsilon \f$ times the largest one are set to zero.
+        If QL_ENABLE_LAPACK is defined, this second algorithm is
+        delegated to the LAPACK dsyev routine.
+
         \test the correctness of the returned values is tested by
               checking their properties.
     */
     class SymmetricSchurDecomposition {
       public:
+        enum Algorithm { Jacobi, TridiagonalQR };
         /*! \pre s must be symmetric */
-        SymmetricSchurDecomposition(const Matrix &s);
+        SymmetricSchurDecomposition(const Matrix &s,
+                                    Algorithm algorithm = Jacobi);
         const Array& eigenvalues() const { return diagonal_; }
         const Matrix& eigenvectors() const { return eigenVectors_; }
       private:
         Array diagonal_;
         Matrix eigenVectors_;
+        void tridiagonalQR_(const Matrix& s);
         void jacobiRotate_(Matrix & m, Real rot, Real dil,
                            Size j1, Size k1, Size j2, Size k2) const;
     };
@@ -26,10 +26,32 @@
 #define quantlib_inversecumulative_rsg_h
 
 #include <ql/methods/montecarlo/sample.hpp>
+#include <ql/math/distributions/normaldistribution.hpp>
 #include <vector>
 
 namespace QuantLib {
 
+    namespace detail {
+
+        template <class IC>
+        inline void inverseCumulativeValues(const IC& ic,
+                                            const Real* xBegin,
+                                            const Real* xEnd,
+                                            Real* out) {
+            for (; xBegin != xEnd; ++xBegin, ++out)
+                *out = ic(*xBegin);
+        }
+
+        inline void inverseCumulativeValues(
+                                       const InverseCumulativeNormal& ic,
+                                       const Real* xBegin,
+                                       const Real* xEnd,
+                                       Real* out) {
+            ic.values(xBegin, xEnd, out);
+        }
+
+    }
+
     //! Inverse cumulative random sequence generator
     /*! It uses a sequence of uniform deviate in (0, 1) as the
         source of cumulative distribution values.
@@ -51,6 +73,9 @@ namespace QuantLib {
             IC::IC();
             Real IC::operator() const;
         \endcode
+
+        When IC is InverseCumulativeNormal, the whole sequence is
+        transformed at once by means of its values() method.
     */
     template <class USG, class IC>
     class InverseCumulativeRsg {
@@ -87,12 +112,13 @@ namespace QuantLib {
     template <class USG, class IC>
     inline const typename InverseCumulativeRsg<USG, IC>::sample_type&
     InverseCumulativeRsg<USG, IC>::nextSequence() const {
-        typename USG::sample_type sample =
+        const typename USG::sample_type& sample =
             uniformSequenceGenerator_.nextSequence();
         x_.weight = sample.weight;
-        for (Size i = 0; i < dimension_; i++) {
-            x_.value[i] = ICD_(sample.value[i]);
-        }
+        if (dimension_ > 0)
+            detail::inverseCumulativeValues(ICD_, &sample.value[0],
+                                            &sample.value[0] + dimension_,
+                                            &x_.value[0]);
         return x_;
     }
 
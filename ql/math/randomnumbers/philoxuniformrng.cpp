@@ -0,0 +1,157 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/math/randomnumbers/philoxuniformrng.hpp>
+#include <ql/math/randomnumbers/seedgenerator.hpp>
+
+namespace QuantLib {
+
+    namespace {
+
+        inline void philox(const boost::uint32_t counter[4],
+                           const boost::uint32_t key[2],
+                           boost::uint32_t out[4]) {
+            boost::uint32_t c0 = counter[0], c1 = counter[1],
+                            c2 = counter[2], c3 = counter[3];
+            boost::uint32_t k0 = key[0], k1 = key[1];
+            for (Size i=0; i<10; ++i) {
+                const boost::uint64_t p0 =
+                    boost::uint64_t(0xD2511F53UL) * c0;
+                const boost::uint64_t p1 =
+                    boost::uint64_t(0xCD9E8D57UL) * c2;
+                c0 = boost::uint32_t(p1 >> 32) ^ c1 ^ k0;
+                c1 = boost::uint32_t(p1);
+                c2 = boost::uint32_t(p0 >> 32) ^ c3 ^ k1;
+                c3 = boost::uint32_t(p0);
+                // Weyl sequence for the round keys
+                k0 += 0x9E3779B9UL;
+                k1 += 0xBB67AE85UL;
+            }
+            out[0] = c0;
+            out[1] = c1;
+            out[2] = c2;
+            out[3] = c3;
+        }
+
+        // blocks processed together by nextReals
+        const Size lanes = 8;
+
+        // same as philox, for consecutive counters; the loops on the
+        // lanes have a fixed trip count so that they can be vectorized
+        inline void philoxLanes(boost::uint64_t index,
+                                const boost::uint32_t counter[4],
+                                const boost::uint32_t key[2],
+                                Real* out) {
+            boost::uint32_t c0[lanes], c1[lanes], c2[lanes], c3[lanes];
+            for (Size j=0; j<lanes; ++j) {
+                c0[j] = boost::uint32_t(index + j);
+                c1[j] = boost::uint32_t((index + j) >> 32);
+                c2[j] = counter[2];
+                c3[j] = counter[3];
+            }
+            boost::uint32_t k0 = key[0], k1 = key[1];
+            for (Size i=0; i<10; ++i) {
+                for (Size j=0; j<lanes; ++j) {
+                    const boost::uint64_t p0 =
+                        boost::uint64_t(0xD2511F53UL) * c0[j];
+                    const boost::uint64_t p1 =
+                        boost::uint64_t(0xCD9E8D57UL) * c2[j];
+                    c0[j] = boost::uint32_t(p1 >> 32) ^ c1[j] ^ k0;
+                    c1[j] = boost::uint32_t(p1);
+                    c2[j] = boost::uint32_t(p0 >> 32) ^ c3[j] ^ k1;
+                    c3[j] = boost::uint32_t(p0);
+                }
+                k0 += 0x9E3779B9UL;
+                k1 += 0xBB67AE85UL;
+            }
+            for (Size j=0; j<lanes; ++j) {
+                out[4*j]   = (Real(c0[j]) + 0.5)/4294967296.0;
+                out[4*j+1] = (Real(c1[j]) + 0.5)/4294967296.0;
+                out[4*j+2] = (Real(c2[j]) + 0.5)/4294967296.0;
+                out[4*j+3] = (Real(c3[j]) + 0.5)/4294967296.0;
+            }
+        }
+
+    }
+
+    PhiloxUniformRng::PhiloxUniformRng(BigNatural seed,
+                                       BigNatural substream)
+    : index_(4) {
+        const boost::uint64_t s =
+            (seed != 0 ? seed : SeedGenerator::instance().get());
+        key_[0] = boost::uint32_t(s);
+        key_[1] = boost::uint32_t(s >> 32);
+        const boost::uint64_t m = substream;
+        counter_[0] = counter_[1] = 0;
+        counter_[2] = boost::uint32_t(m);
+        counter_[3] = boost::uint32_t(m >> 32);
+    }
+
+    void PhiloxUniformRng::refill() const {
+        philox(counter_, key_, buffer_);
+        increment(1);
+        index_ = 0;
+    }
+
+    void PhiloxUniformRng::increment(BigNatural n) const {
+        // the lower half of the counter is the block index
+        const boost::uint64_t c =
+            ((boost::uint64_t(counter_[1]) << 32) | counter_[0]) + n;
+        counter_[0] = boost::uint32_t(c);
+        counter_[1] = boost::uint32_t(c >> 32);
+    }
+
+    void PhiloxUniformRng::discard(BigNatural n) {
+        const Size left = 4 - index_;
+        if (n <= left) {
+            index_ += n;
+            return;
+        }
+        n -= left;
+        increment(n/4);
+        index_ = 4;
+        if (n % 4 != 0) {
+            refill();
+            index_ = n % 4;
+        }
+    }
+
+    void PhiloxUniformRng::nextReals(Size n, Real* out) const {
+        // numbers left over from the last block
+        for (; n > 0 && index_ < 4; --n)
+            *out++ = (Real(buffer_[index_++]) + 0.5)/4294967296.0;
+
+        // whole blocks are written directly
+        for (; n >= 4*lanes; n -= 4*lanes, out += 4*lanes) {
+            const boost::uint64_t index =
+                (boost::uint64_t(counter_[1]) << 32) | counter_[0];
+            philoxLanes(index, counter_, key_, out);
+            increment(lanes);
+        }
+        boost::uint32_t block[4];
+        for (; n >= 4; n -= 4, out += 4) {
+            philox(counter_, key_, block);
+            increment(1);
+            for (Size i=0; i<4; ++i)
+                out[i] = (Real(block[i]) + 0.5)/4294967296.0;
+        }
+
+        for (; n > 0; --n)
+            *out++ = nextReal();
+    }
+
+}
@@ -0,0 +1,93 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file philoxuniformrng.hpp
+    \brief Philox counter-based uniform random number generator
+*/
+
+#ifndef quantlib_philox_uniform_rng_hpp
+#define quantlib_philox_uniform_rng_hpp
+
+#include <ql/methods/montecarlo/sample.hpp>
+#include <boost/cstdint.hpp>
+
+namespace QuantLib {
+
+    //! Philox-4x32-10 counter-based uniform random number generator
+    /*! The n-th block of four 32-bit numbers is obtained by applying
+        ten rounds of a keyed bijection to the counter n; the key is
+        given by the seed.  Since no state other than the counter is
+        carried from one number to the next, the generator can jump
+        in constant time to any position of its sequence, and blocks
+        of numbers can be generated independently of each other.
+
+        The upper half of the 128-bit counter is set to the given
+        substream, so that each substream is a sequence of
+        \f$ 2^{66} \f$ numbers which doesn't overlap with the others.
+        Parallel simulations can thus give each thread the same seed
+        and a different substream, instead of relying on different
+        seeds producing independent sequences.
+
+        References:
+        J. K. Salmon, M. A. Moraes, R. O. Dror and D. E. Shaw,
+        Parallel Random Numbers: As Easy as 1, 2, 3, Proceedings of
+        the International Conference for High Performance Computing,
+        Networking, Storage and Analysis (SC11), 2011.
+
+        \test
+        - the correctness of the returned values is tested by
+          checking them against known good results.
+        - skipping and block generation are checked against the
+          numbers drawn one by one.
+    */
+    class PhiloxUniformRng {
+      public:
+        typedef Sample<Real> sample_type;
+        /*! if the given seed is 0, a random seed will be chosen
+            based on clock() */
+        explicit PhiloxUniformRng(BigNatural seed = 0,
+                                  BigNatural substream = 0);
+        /*! returns a sample with weight 1.0 containing a random number
+            in the (0.0, 1.0) interval  */
+        sample_type next() const { return sample_type(nextReal(),1.0); }
+        //! return a random number in the (0.0, 1.0)-interval
+        Real nextReal() const {
+            return (Real(nextInt32()) + 0.5)/4294967296.0;
+        }
+        //! return a random integer in the [0,0xffffffff]-interval
+        unsigned long nextInt32() const {
+            if (index_ == 4)
+                refill();
+            return buffer_[index_++];
+        }
+        //! writes the next n random numbers in (0.0, 1.0) to out
+        void nextReals(Size n, Real* out) const;
+        //! skips the next n random numbers
+        void discard(BigNatural n);
+      private:
+        void refill() const;
+        void increment(BigNatural n) const;
+        boost::uint32_t key_[2];
+        mutable boost::uint32_t counter_[4];
+        mutable boost::uint32_t buffer_[4];
+        mutable Size index_;
+    };
+
+}
+
+
+#endif
@@ -28,6 +28,7 @@
 
 #include <ql/methods/montecarlo/pathgenerator.hpp>
 #include <ql/math/randomnumbers/mt19937uniformrng.hpp>
+#include <ql/math/randomnumbers/philoxuniformrng.hpp>
 #include <ql/math/randomnumbers/inversecumulativerng.hpp>
 #include <ql/math/randomnumbers/randomsequencegenerator.hpp>
 #include <ql/math/randomnumbers/sobolrsg.hpp>
@@ -77,6 +78,18 @@ namespace QuantLib {
     typedef GenericPseudoRandom<MersenneTwisterUniformRng,
                                 InverseCumulativePoisson> PoissonPseudoRandom;
 
+    //! traits for pseudo-random number generation with Philox
+    /*! The generators returned by make_sequence_generator() use
+        substream 0; for parallel simulations, build a
+        RandomSequenceGenerator from a PhiloxUniformRng with the
+        same seed and a different substream for each thread.
+
+        \test a sequence generator is generated and tested by comparing
+              samples against those of a Philox generator.
+    */
+    typedef GenericPseudoRandom<PhiloxUniformRng,
+                                InverseCumulativeNormal> PhiloxPseudoRandom;
+
 
     template <class URSG, class IC>
     struct GenericLowDiscrepancy {
@@ -37,17 +37,16 @@ namespace QuantLib {
 
     const SobolBrownianBridgeRsg::sample_type&
     SobolBrownianBridgeRsg::nextSequence() const {
-        gen_.nextPath();
-        std::vector<Real> output(factors_);
-        for (Size i=0; i < steps_; ++i) {
-            gen_.nextStep(output);
-            std::copy(output.begin(), output.end(),
-                      seq_.value.begin()+i*factors_);
-        }
-
+        nextSequences(1, &seq_.value[0]);
         return seq_;
     }
 
+    void SobolBrownianBridgeRsg::nextSequences(Size n, Real* out) const {
+        gen_.nextPaths(n, out);
+        if (n > 0 && out+(n-1)*dim_ != &seq_.value[0])
+            std::copy(out+(n-1)*dim_, out+n*dim_, seq_.value.begin());
+    }
+
     const SobolBrownianBridgeRsg::sample_type&
     SobolBrownianBridgeRsg::lastSequence() const {
         return seq_;
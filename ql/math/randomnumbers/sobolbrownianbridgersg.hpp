@@ -43,6 +43,11 @@ namespace QuantLib {
         const sample_type& nextSequence() const;
         const sample_type& lastSequence() const;
         Size dimension() const;
+        /*! writes the next n sequences to out, one after the other,
+            as if nextSequence() was called n times; out must have
+            room for n*dimension() values.
+        */
+        void nextSequences(Size n, Real* out) const;
 
       private:
         const Size factors_, steps_, dim_;
@@ -27,6 +27,8 @@
 #define quantlib_sobol_ld_rsg_hpp
 
 #include <ql/methods/montecarlo/sample.hpp>
+#include <ql/errors.hpp>
+#include <algorithm>
 #include <vector>
 
 namespace QuantLib {
@@ -100,11 +102,22 @@ namespace QuantLib {
         or so dimensions which is why we have the Alternative
         Primitive Polynomials.
 
+        Several points can be drawn at once into a contiguous buffer
+        by means of nextInt32Sequences() or nextSequences().  For
+        each point, the Gray-code update xors the same direction
+        integer of every dimension; these are stored contiguously the
+        first time a block is drawn, so that the update is a single
+        loop over the dimensions.  Together with skipTo(), this
+        allows the sequence to be partitioned among several
+        generators.
+
         \test
         - the correctness of the returned values is tested by
           reproducing known good values.
         - the correctness of the returned values is tested by checking
           their discrepancy against known good values.
+        - the points drawn in blocks are checked against those drawn
+          one at a time.
     */
     class SobolRsg {
       public:
@@ -129,6 +142,16 @@ namespace QuantLib {
         }
         const sample_type& lastSequence() const { return sequence_; }
         Size dimension() const { return dimensionality_; }
+        /*! writes the next n points of the sequence to out, one
+            after the other, as if nextInt32Sequence() was called n
+            times; out must have room for n*dimension() integers.
+        */
+        void nextInt32Sequences(Size n, unsigned long* out) const;
+        /*! writes the next n points of the sequence to out, one
+            after the other, as if nextSequence() was called n times;
+            out must have room for n*dimension() values.
+        */
+        void nextSequences(Size n, Real* out) const;
       private:
         static const int bits_;
         static const double normalizationFactor_;
@@ -138,8 +161,68 @@ namespace QuantLib {
         mutable sample_type sequence_;
         mutable std::vector<unsigned long> integerSequence_;
         std::vector<std::vector<unsigned long> > directionIntegers_;
+        // direction integers ordered by bit, then by dimension
+        mutable std::vector<unsigned long> directionIntegersByBit_;
+        void sortDirectionIntegersByBit() const;
+        void advance() const;
     };
 
+
+    // inline definitions
+
+    inline void SobolRsg::advance() const {
+        if (firstDraw_) {
+            firstDraw_ = false;
+            return;
+        }
+        ++sequenceCounter_;
+        QL_REQUIRE(sequenceCounter_ != 0, "period exceeded");
+        // the Gray code of the counter changes in the bit
+        // corresponding to its rightmost zero bit
+        unsigned long c = sequenceCounter_;
+        Size j = 0;
+        while (c & 1) {
+            c >>= 1;
+            ++j;
+        }
+        const unsigned long* v = &directionIntegersByBit_[j*dimensionality_];
+        unsigned long* x = &integerSequence_[0];
+        for (Size k=0; k<dimensionality_; ++k)
+            x[k] ^= v[k];
+    }
+
+    inline void SobolRsg::nextInt32Sequences(Size n,
+                                             unsigned long* out) const {
+        if (directionIntegersByBit_.empty())
+            sortDirectionIntegersByBit();
+        for (Size i=0; i<n; ++i, out+=dimensionality_) {
+            advance();
+            std::copy(integerSequence_.begin(), integerSequence_.end(),
+                      out);
+        }
+    }
+
+    inline void SobolRsg::nextSequences(Size n, Real* out) const {
+        if (directionIntegersByBit_.empty())
+            sortDirectionIntegersByBit();
+        for (Size i=0; i<n; ++i, out+=dimensionality_) {
+            advance();
+            for (Size k=0; k<dimensionality_; ++k)
+                out[k] = integerSequence_[k] * normalizationFactor_;
+        }
+        if (n > 0)
+            std::copy(out-dimensionality_, out, sequence_.value.begin());
+    }
+
+    inline void SobolRsg::sortDirectionIntegersByBit() const {
+        const Size bits = directionIntegers_[0].size();
+        directionIntegersByBit_.resize(bits*dimensionality_);
+        for (Size k=0; k<dimensionality_; ++k)
+            for (Size j=0; j<bits; ++j)
+                directionIntegersByBit_[j*dimensionality_+k] =
+                    directionIntegers_[k][j];
+    }
+
 }
 
 #endif
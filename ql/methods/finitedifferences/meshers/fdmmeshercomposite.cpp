@@ -132,11 +132,13 @@ namespace QuantLib {
     Disposable<Array> FdmMesherComposite::locations(Size direction) const {
         Array retVal(layout_->size());
 
-        const FdmLinearOpIterator endIter = layout_->end();
-        for (FdmLinearOpIterator iter = layout_->begin();
-             iter != endIter; ++iter) {
-            retVal[iter.index()] =
-                mesher_[direction]->locations()[iter.coordinates()[direction]];
+        const std::vector<Real>& x = mesher_[direction]->locations();
+        const Size n = layout_->dim()[direction];
+        const Size s = layout_->spacing()[direction];
+        for (Size l=0; l < layout_->lines(direction); ++l) {
+            const Size start = layout_->lineStart(direction, l);
+            for (Size k=0; k < n; ++k)
+                retVal[start + k*s] = x[k];
         }
 
         return retVal;
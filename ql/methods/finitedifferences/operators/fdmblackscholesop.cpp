@@ -25,6 +25,7 @@
 #include <ql/methods/finitedifferences/operators/fdmlinearoplayout.hpp>
 #include <ql/methods/finitedifferences/operators/fdmblackscholesop.hpp>
 #include <ql/methods/finitedifferences/operators/secondderivativeop.hpp>
+#include <ql/termstructures/volatility/equityfx/interpolatedlocalvolsurface.hpp>
 
 namespace QuantLib {
 
@@ -41,7 +42,11 @@ namespace QuantLib {
       volTS_ (bsProcess->blackVolatility().currentLink()),
       localVol_((localVol) ? bsProcess->localVolatility().currentLink()
                            : boost::shared_ptr<LocalVolTermStructure>()),
+      interpolatedLocalVol_(
+          boost::dynamic_pointer_cast<InterpolatedLocalVolSurface>(localVol_)),
       x_     ((localVol) ? Array(Exp(mesher->locations(direction))) : Array()),
+      logX_  ((interpolatedLocalVol_) ? mesher->locations(direction)
+                                      : Array()),
       dxMap_ (FirstDerivativeOp(direction, mesher)),
       dxxMap_(SecondDerivativeOp(direction, mesher)),
       mapT_  (direction, mesher),
@@ -54,7 +59,15 @@ namespace QuantLib {
         const Rate r = rTS_->forwardRate(t1, t2, Continuous).rate();
         const Rate q = qTS_->forwardRate(t1, t2, Continuous).rate();
 
-        if (localVol_) {
+        if (interpolatedLocalVol_) {
+            // tabulated local vols, looked up for the whole slice
+            const Array vol =
+                interpolatedLocalVol_->localVols(0.5*(t1+t2), logX_);
+            const Array v = vol*vol;
+            mapT_.axpyb(r - q - 0.5*v, dxMap_,
+                        dxxMap_.mult(0.5*v), Array(1, -r));
+        }
+        else if (localVol_) {
             const boost::shared_ptr<FdmLinearOpLayout> layout=mesher_->layout();
             const FdmLinearOpIterator endIter = layout->end();
 
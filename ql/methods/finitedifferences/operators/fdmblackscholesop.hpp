@@ -34,6 +34,8 @@
 
 namespace QuantLib {
 
+    class InterpolatedLocalVolSurface;
+
     class FdmBlackScholesOp : public FdmLinearOpComposite {
       public:
         FdmBlackScholesOp(
@@ -63,7 +65,9 @@ namespace QuantLib {
         const boost::shared_ptr<YieldTermStructure> rTS_, qTS_;
         const boost::shared_ptr<BlackVolTermStructure> volTS_;
         const boost::shared_ptr<LocalVolTermStructure> localVol_;
-        const Array x_;
+        const boost::shared_ptr<InterpolatedLocalVolSurface>
+            interpolatedLocalVol_;
+        const Array x_, logX_;
         const FirstDerivativeOp  dxMap_;
         const TripleBandLinearOp dxxMap_;
         TripleBandLinearOp mapT_;
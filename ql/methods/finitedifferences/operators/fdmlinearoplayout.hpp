@@ -68,6 +68,23 @@ namespace QuantLib {
                                       spacing_.begin(), Size(0));
         }
 
+        //! \name Lines along a direction
+        /*! The points differing only in the coordinate along the
+            given direction form a line; the k-th point of a line is
+            at lineStart(direction, line) + k*spacing()[direction].
+            Operators can be set up line by line with plain strided
+            loops, without the bookkeeping of an iterator.
+        */
+        //@{
+        Size lines(Size direction) const {
+            return size_/dim_[direction];
+        }
+        Size lineStart(Size direction, Size line) const {
+            const Size s = spacing_[direction];
+            return line % s + (line/s)*s*dim_[direction];
+        }
+        //@}
+
         Size neighbourhood(const FdmLinearOpIterator& iterator,
                            Size i, Integer offset) const;
 
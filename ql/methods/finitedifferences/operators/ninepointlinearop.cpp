@@ -54,19 +54,30 @@ namespace QuantLib {
             "inconsistent derivative directions");
 
         const boost::shared_ptr<FdmLinearOpLayout> layout = mesher->layout();
-        const FdmLinearOpIterator endIter = layout->end();
-
-        for (FdmLinearOpIterator iter = layout->begin(); iter!=endIter; ++iter) {
-            const Size i = iter.index();
-
-            i10_[i] = layout->neighbourhood(iter, d1_, -1);
-            i01_[i] = layout->neighbourhood(iter, d0_, -1);
-            i21_[i] = layout->neighbourhood(iter, d0_,  1);
-            i12_[i] = layout->neighbourhood(iter, d1_,  1);
-            i00_[i] = layout->neighbourhood(iter, d0_, -1, d1_, -1);
-            i20_[i] = layout->neighbourhood(iter, d0_,  1, d1_, -1);
-            i02_[i] = layout->neighbourhood(iter, d0_, -1, d1_,  1);
-            i22_[i] = layout->neighbourhood(iter, d0_,  1, d1_,  1);
+        const Size n0 = layout->dim()[d0_], s0 = layout->spacing()[d0_];
+        const Size n1 = layout->dim()[d1_], s1 = layout->spacing()[d1_];
+
+        // lines along d0; the coordinate along d1 is the same for all
+        // the points of a line. Neighbours are reflected at the
+        // boundaries.
+        for (Size l=0; l < layout->lines(d0_); ++l) {
+            const Size start = layout->lineStart(d0_, l);
+            const Size c1 = (start/s1) % n1;
+            const bool hasLower1 = (c1 > 0), hasUpper1 = (c1 < n1-1);
+
+            for (Size k=0, i=start; k < n0; ++k, i+=s0) {
+                const Size im = (k > 0)    ? i-s0 : i+s0;
+                const Size ip = (k < n0-1) ? i+s0 : i-s0;
+
+                i01_[i] = im;
+                i21_[i] = ip;
+                i10_[i] = hasLower1 ? i-s1  : i+s1;
+                i12_[i] = hasUpper1 ? i+s1  : i-s1;
+                i00_[i] = hasLower1 ? im-s1 : im+s1;
+                i20_[i] = hasLower1 ? ip-s1 : ip+s1;
+                i02_[i] = hasUpper1 ? im+s1 : im-s1;
+                i22_[i] = hasUpper1 ? ip+s1 : ip-s1;
+            }
         }
     }
 
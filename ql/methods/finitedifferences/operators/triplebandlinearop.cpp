@@ -40,24 +40,24 @@ namespace QuantLib {
       mesher_(mesher) {
 
         const boost::shared_ptr<FdmLinearOpLayout> layout = mesher->layout();
-        const FdmLinearOpIterator endIter = layout->end();
-
-        std::vector<Size> newDim(layout->dim());
-        std::iter_swap(newDim.begin(), newDim.begin()+direction_);
-        std::vector<Size> newSpacing = FdmLinearOpLayout(newDim).spacing();
-        std::iter_swap(newSpacing.begin(), newSpacing.begin()+direction_);
-
-        for (FdmLinearOpIterator iter = layout->begin(); iter!=endIter; ++iter) {
-            const Size i = iter.index();
-
-            i0_[i] = layout->neighbourhood(iter, direction, -1);
-            i2_[i] = layout->neighbourhood(iter, direction,  1);
-
-            const std::vector<Size>& coordinates = iter.coordinates();
-            const Size newIndex =
-                  std::inner_product(coordinates.begin(), coordinates.end(),
-                                     newSpacing.begin(), Size(0));
-            reverseIndex_[newIndex] = i;
+        const Size n = layout->dim()[direction_];
+        const Size s = layout->spacing()[direction_];
+
+        // the neighbours are reflected at the boundaries; the reverse
+        // index lists the points line by line along the direction.
+        // For more than two dimensions the lines are not necessarily
+        // listed in the order used by earlier versions. This doesn't
+        // change the results of solve_splitting, which requires the
+        // lower coefficient at the start and the upper one at the end
+        // of each line to be zero; that decouples the lines, so the
+        // order in which they are solved doesn't matter.
+        for (Size l=0, j=0; l < layout->lines(direction_); ++l) {
+            const Size start = layout->lineStart(direction_, l);
+            for (Size k=0, i=start; k < n; ++k, ++j, i+=s) {
+                i0_[i] = (k > 0)   ? i-s : i+s;
+                i2_[i] = (k < n-1) ? i+s : i-s;
+                reverseIndex_[j] = i;
+            }
         }
     }
 
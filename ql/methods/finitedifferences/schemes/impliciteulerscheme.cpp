@@ -20,6 +20,7 @@
 */
 
 #include <ql/math/matrixutilities/bicgstab.hpp>
+#include <ql/math/matrixutilities/gmres.hpp>
 #include <ql/methods/finitedifferences/schemes/impliciteulerscheme.hpp>
 #if defined(__GNUC__) && (((__GNUC__ == 4) && (__GNUC_MINOR__ >= 8)) || (__GNUC__ > 4))
 #pragma GCC diagnostic push
@@ -36,9 +37,13 @@ namespace QuantLib {
     ImplicitEulerScheme::ImplicitEulerScheme(
         const boost::shared_ptr<FdmLinearOpComposite>& map,
         const bc_set& bcSet,
-        Real relTol)
+        Real relTol,
+        SolverType solverType,
+        Size gmresRestart)
     : dt_    (Null<Real>()),
       relTol_(relTol),
+      solverType_(solverType),
+      gmresRestart_(gmresRestart),
       map_   (map),
       bcSet_ (bcSet) {
     }
@@ -54,15 +59,26 @@ namespace QuantLib {
 
         bcSet_.applyBeforeSolving(*map_, a);
 
-        a = BiCGstab(
-                boost::function<Disposable<Array>(const Array&)>(
-                    boost::bind(&ImplicitEulerScheme::apply, this, _1)), 
-                10*a.size(), relTol_,
-                boost::function<Disposable<Array>(const Array&)>(
-                    boost::bind(&FdmLinearOpComposite::preconditioner, 
-                                map_, _1, -dt_))
-            ).solve(a).x;
-        
+        const boost::function<Disposable<Array>(const Array&)> applyF(
+            boost::bind(&ImplicitEulerScheme::apply, this, _1));
+        const boost::function<Disposable<Array>(const Array&)> preconditioner(
+            boost::bind(&FdmLinearOpComposite::preconditioner,
+                        map_, _1, -dt_));
+
+        switch (solverType_) {
+          case BiCGstab:
+            a = QuantLib::BiCGstab(applyF, 10*a.size(), relTol_,
+                                   preconditioner).solve(a).x;
+            break;
+          case GMRES:
+            a = QuantLib::GMRES(applyF, 10*a.size(), relTol_,
+                                preconditioner)
+                .solveWithRestart(gmresRestart_, a, a).x;
+            break;
+          default:
+            QL_FAIL("unknown solver type");
+        }
+
         bcSet_.applyAfterSolving(a);
     }
 
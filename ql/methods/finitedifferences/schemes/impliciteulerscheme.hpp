@@ -32,8 +32,17 @@
 
 namespace QuantLib {
 
+    //! Implicit-Euler scheme
+    /*! The linear system of each step is solved iteratively, with the
+        preconditioner given by the operator.  GMRES needs a single
+        operator application per iteration instead of the two of
+        BiCGstab and converges smoothly; the restart bounds the
+        number of vectors stored.
+    */
     class ImplicitEulerScheme {
       public:
+        enum SolverType { BiCGstab, GMRES };
+
         // typedefs
         typedef OperatorTraits<FdmLinearOp> traits;
         typedef traits::operator_type operator_type;
@@ -45,7 +54,9 @@ namespace QuantLib {
         ImplicitEulerScheme(
             const boost::shared_ptr<FdmLinearOpComposite>& map,
             const bc_set& bcSet = bc_set(),
-            Real relTol = 1e-8);
+            Real relTol = 1e-8,
+            SolverType solverType = BiCGstab,
+            Size gmresRestart = 50);
 
         void step(array_type& a, Time t);
         void setStep(Time dt);
@@ -55,6 +66,8 @@ namespace QuantLib {
           
         Time dt_;
         const Real relTol_;
+        const SolverType solverType_;
+        const Size gmresRestart_;
         const boost::shared_ptr<FdmLinearOpComposite> map_;
         const BoundaryConditionSchemeHelper bcSet_;
     };
@@ -51,6 +51,13 @@ namespace QuantLib {
                         Array& newValues) const;
         \endcode
 
+        The descendants, probabilities and discounts of each level
+        are queried from the derived class once, the first time the
+        level is used, and stored in contiguous arrays; the default
+        stepback and the calculation of state prices then run over
+        the stored arrays. Therefore, derived classes must not change
+        them once a level has been used.
+
         \ingroup lattices
     */
     template <class Impl>
@@ -74,6 +81,17 @@ namespace QuantLib {
         Real presentValue(DiscretizedAsset&) const;
         //@}
 
+        /*! \name Rollback of several assets
+            The assets, which must be at the same time, are rolled
+            back together level by level, so that the tree is
+            traversed once for all of them.
+        */
+        //@{
+        void rollback(const std::vector<DiscretizedAsset*>&, Time to) const;
+        void partialRollback(const std::vector<DiscretizedAsset*>&,
+                             Time to) const;
+        //@}
+
         const Array& statePrices(Size i) const;
 
         void stepback(Size i,
@@ -87,23 +105,61 @@ namespace QuantLib {
         mutable std::vector<Array> statePrices_;
 
       private:
+        /* Branching of a level; the descendant and probability of
+           branch l of node j are stored at index l*size+j. */
+        struct Level {
+            std::vector<Size> descendants;
+            std::vector<Real> probabilities;
+            Array discounts;
+        };
+        const Level& level(Size i) const;
+
         Size n_;
         mutable Size statePricesLimit_;
+        mutable std::vector<Level> levels_;
     };
 
 
     // template definitions
 
+    template <class Impl>
+    const typename TreeLattice<Impl>::Level&
+    TreeLattice<Impl>::level(Size i) const {
+        if (i >= levels_.size())
+            levels_.resize(i+1);
+        Level& level = levels_[i];
+        if (level.discounts.empty()) {
+            const Size size = this->impl().size(i);
+            level.descendants.resize(n_*size);
+            level.probabilities.resize(n_*size);
+            level.discounts = Array(size);
+            for (Size j=0; j<size; j++) {
+                level.discounts[j] = this->impl().discount(i,j);
+                for (Size l=0; l<n_; l++) {
+                    level.descendants[l*size+j] =
+                        this->impl().descendant(i,j,l);
+                    level.probabilities[l*size+j] =
+                        this->impl().probability(i,j,l);
+                }
+            }
+        }
+        return level;
+    }
+
     template <class Impl>
     void TreeLattice<Impl>::computeStatePrices(Size until) const {
         for (Size i=statePricesLimit_; i<until; i++) {
             statePrices_.push_back(Array(this->impl().size(i+1), 0.0));
-            for (Size j=0; j<this->impl().size(i); j++) {
-                DiscountFactor disc = this->impl().discount(i,j);
+            const Level& level = this->level(i);
+            const Size size = level.discounts.size();
+            const Size* k = &level.descendants[0];
+            const Real* p = &level.probabilities[0];
+            for (Size j=0; j<size; j++) {
+                DiscountFactor disc = level.discounts[j];
                 Real statePrice = statePrices_[i][j];
                 for (Size l=0; l<n_; l++) {
-                    statePrices_[i+1][this->impl().descendant(i,j,l)] +=
-                        statePrice*disc*this->impl().probability(i,j,l);
+                    statePrices_[i+1][k[l*size+j]] +=
+                        statePrice*disc*p[l*size+j];
                 }
             }
         }
@@ -146,7 +202,7 @@ namespace QuantLib {
             return;
 
         QL_REQUIRE(from > to,
-                   "cannot roll the asset back to" << to
+                   "cannot roll the asset back to " << to
                    << " (it is already at t = " << from << ")");
 
         Integer iFrom = Integer(t_.index(from));
@@ -163,18 +219,67 @@ namespace QuantLib {
         }
     }
 
+    template <class Impl>
+    void TreeLattice<Impl>::rollback(
+                             const std::vector<DiscretizedAsset*>& assets,
+                             Time to) const {
+        partialRollback(assets,to);
+        for (Size k=0; k<assets.size(); ++k)
+            assets[k]->adjustValues();
+    }
+
+    template <class Impl>
+    void TreeLattice<Impl>::partialRollback(
+                             const std::vector<DiscretizedAsset*>& assets,
+                             Time to) const {
+
+        if (assets.empty())
+            return;
+
+        Time from = assets.front()->time();
+        for (Size k=1; k<assets.size(); ++k)
+            QL_REQUIRE(close(assets[k]->time(),from),
+                       "assets at different times (" << from << " and "
+                       << assets[k]->time() << ")");
+
+        if (close(from,to))
+            return;
+
+        QL_REQUIRE(from > to,
+                   "cannot roll the assets back to " << to
+                   << " (they are already at t = " << from << ")");
+
+        Integer iFrom = Integer(t_.index(from));
+        Integer iTo = Integer(t_.index(to));
+
+        for (Integer i=iFrom-1; i>=iTo; --i) {
+            for (Size k=0; k<assets.size(); ++k) {
+                DiscretizedAsset& asset = *assets[k];
+                Array newValues(this->impl().size(i));
+                this->impl().stepback(i, asset.values(), newValues);
+                asset.time() = t_[i];
+                asset.values() = newValues;
+                // skip the very last adjustment
+                if (i != iTo)
+                    asset.adjustValues();
+            }
+        }
+    }
+
     template <class Impl>
     void TreeLattice<Impl>::stepback(Size i, const Array& values,
                                      Array& newValues) const {
+        const Level& level = this->level(i);
+        const Size size = level.discounts.size();
+        const Size* k = &level.descendants[0];
+        const Real* p = &level.probabilities[0];
+        const Real* d = level.discounts.begin();
         #pragma omp parallel for
-        for (Size j=0; j<this->impl().size(i); j++) {
+        for (Size j=0; j<size; j++) {
             Real value = 0.0;
-            for (Size l=0; l<n_; l++) {
-                value += this->impl().probability(i,j,l) *
-                         values[this->impl().descendant(i,j,l)];
-            }
-            value *= this->impl().discount(i,j);
-            newValues[j] = value;
+            for (Size l=0; l<n_; l++)
+                value += p[l*size+j] * values[k[l*size+j]];
+            newValues[j] = value*d[j];
         }
     }
 
@@ -32,7 +32,7 @@
 namespace QuantLib {
 
     BrownianBridge::BrownianBridge(Size steps)
-    : size_(steps), t_(size_), sqrtdt_(size_),
+    : size_(steps), t_(size_), invSqrtdt_(size_),
       bridgeIndex_(size_), leftIndex_(size_), rightIndex_(size_),
       leftWeight_(size_), rightWeight_(size_), stdDev_(size_) {
         for (Size i=0; i<size_; ++i)
@@ -41,14 +41,14 @@ namespace QuantLib {
     }
 
     BrownianBridge::BrownianBridge(const std::vector<Time>& times)
-    : size_(times.size()), t_(times), sqrtdt_(size_),
+    : size_(times.size()), t_(times), invSqrtdt_(size_),
       bridgeIndex_(size_), leftIndex_(size_), rightIndex_(size_),
       leftWeight_(size_), rightWeight_(size_), stdDev_(size_) {
         initialize();
     }
 
     BrownianBridge::BrownianBridge(const TimeGrid& timeGrid)
-    : size_(timeGrid.size()-1), t_(size_), sqrtdt_(size_),
+    : size_(timeGrid.size()-1), t_(size_), invSqrtdt_(size_),
       bridgeIndex_(size_), leftIndex_(size_), rightIndex_(size_),
       leftWeight_(size_), rightWeight_(size_), stdDev_(size_) {
         for (Size i=0; i<size_; ++i)
@@ -59,9 +59,9 @@ namespace QuantLib {
 
     void BrownianBridge::initialize() {
 
-        sqrtdt_[0] = std::sqrt(t_[0]);
+        invSqrtdt_[0] = 1.0/std::sqrt(t_[0]);
         for (Size i=1; i<size_; ++i)
-            sqrtdt_[i] = std::sqrt(t_[i]-t_[i-1]);
+            invSqrtdt_[i] = 1.0/std::sqrt(t_[i]-t_[i-1]);
 
         // map is used to indicate which points are already constructed.
         // If map[i] is zero, path point i is yet unconstructed.
@@ -109,5 +109,40 @@ namespace QuantLib {
         }
     }
 
+    void BrownianBridge::transformPaths(Size paths,
+                                        const Real* input,
+                                        Real* output) const {
+        // as in transform(), output is used to store the paths...
+        Real* last = output + (size_-1)*paths;
+        for (Size p=0; p<paths; ++p)
+            last[p] = stdDev_[0] * input[p];
+        for (Size i=1; i<size_; ++i) {
+            const Real* in = input + i*paths;
+            const Real* right = output + rightIndex_[i]*paths;
+            Real* out = output + bridgeIndex_[i]*paths;
+            const Real wr = rightWeight_[i], sd = stdDev_[i];
+            if (leftIndex_[i] != 0) {
+                const Real* left = output + (leftIndex_[i]-1)*paths;
+                const Real wl = leftWeight_[i];
+                for (Size p=0; p<paths; ++p)
+                    out[p] = wl * left[p] + wr * right[p] + sd * in[p];
+            } else {
+                for (Size p=0; p<paths; ++p)
+                    out[p] = wr * right[p] + sd * in[p];
+            }
+        }
+        // ...and then the normalized variations
+        for (Size i=size_-1; i>=1; --i) {
+            Real* out = output + i*paths;
+            const Real* previous = out - paths;
+            const Real invSqrtdt = invSqrtdt_[i];
+            for (Size p=0; p<paths; ++p)
+                out[p] = (out[p] - previous[p]) * invSqrtdt;
+        }
+        const Real invSqrtdt = invSqrtdt_[0];
+        for (Size p=0; p<paths; ++p)
+            output[p] *= invSqrtdt;
+    }
+
 }
 
@@ -131,15 +131,33 @@ namespace QuantLib {
             // normalize to unit times
             for (Size i=size_-1; i>=1; --i) {
                 output[i] -= output[i-1];
-                output[i] /= sqrtdt_[i];
+                output[i] *= invSqrtdt_[i];
             }
-            output[0] /= sqrtdt_[0];
+            output[0] *= invSqrtdt_[0];
         }
+
+        //! Brownian-bridge generator function for several paths
+        /*! Transforms the random variates of several paths at once.
+            Both sequences are stored by step: the i-th variate of
+            the p-th path is input[i*paths+p], and the corresponding
+            variation is written to output[i*paths+p].
+
+            Each path is transformed as by the method above, with the
+            same results; however, the bridge indices and weights are
+            read once per step instead of once per path and the
+            innermost loops run on contiguous memory.
+
+            \note output must not overlap input.
+        */
+        void transformPaths(Size paths,
+                            const Real* input,
+                            Real* output) const;
       private:
         void initialize();
         Size size_;
         std::vector<Time> t_;
-        std::vector<Real> sqrtdt_;
+        // inverse square roots of the time steps
+        std::vector<Real> invSqrtdt_;
         std::vector<Size> bridgeIndex_, leftIndex_, rightIndex_;
         std::vector<Real> leftWeight_, rightWeight_, stdDev_;
     };
@@ -73,6 +73,21 @@ namespace QuantLib {
             state(const PathType& path, TimeType t) const = 0;
         virtual std::vector<boost::function1<ValueType, StateType> >
             basisSystem() const = 0;
+        //! values of the basis functions at the given state
+        /*! The default implementation calls the given functions,
+            i.e., the ones returned by basisSystem(), one by one;
+            derived classes can override it with a faster evaluation
+            returning the same values.
+
+            \pre values must have the size of the basis system
+        */
+        virtual void basisValues(
+            const StateType& state,
+            const std::vector<boost::function1<ValueType, StateType> >& basis,
+            Array& values) const {
+            for (Size i=0; i<basis.size(); ++i)
+                values[i] = basis[i](state);
+        }
     };
 }
 
@@ -28,7 +28,7 @@
 
 #include <ql/termstructures/yieldtermstructure.hpp>
 #include <ql/math/functional.hpp>
-#include <ql/math/generallinearleastsquares.hpp>
+#include <ql/math/incrementallinearleastsquares.hpp>
 #include <ql/math/statistics/incrementalstatistics.hpp>
 #include <ql/methods/montecarlo/pathpricer.hpp>
 #include <ql/methods/montecarlo/earlyexercisepathpricer.hpp>
@@ -55,6 +55,14 @@ namespace QuantLib {
         by Simulation: A Simple Least-Squares Approach, The Review of
         Financial Studies, Volume 14, No. 1, 113-147
 
+        During the calibration phase, only the states and exercise
+        values of the paths at the exercise times are stored rather
+        than the paths themselves. The regression at each exercise
+        time is accumulated sample by sample into an
+        IncrementalLinearLeastSquares instance, and the basis is
+        evaluated through EarlyExercisePathPricer::basisValues once
+        per in-the-money sample.
+
         \ingroup mcarlo
 
         \test the correctness of the returned value is tested by
@@ -89,8 +97,12 @@ namespace QuantLib {
         boost::scoped_array<Array> coeff_;
         boost::scoped_array<DiscountFactor> dF_;
 
-        mutable std::vector<PathType> paths_;
+        // states and exercise values of the calibration paths,
+        // indexed by exercise time first
+        mutable std::vector<std::vector<StateType> > states_;
+        mutable std::vector<std::vector<Real> > exercises_;
         const   std::vector<boost::function1<Real, StateType> > v_;
+        mutable Array basisValues_;
 
         const Size len_;
     };
@@ -105,7 +117,10 @@ namespace QuantLib {
       pathPricer_(pathPricer),
       coeff_     (new Array[times.size()-2]),
       dF_        (new DiscountFactor[times.size()-1]),
+      states_    (times.size()),
+      exercises_ (times.size()),
       v_         (pathPricer_->basisSystem()),
+      basisValues_(v_.size()),
       len_       (times.size()) {
 
         for (Size i=0; i<times.size()-1; ++i) {
@@ -118,8 +133,11 @@ namespace QuantLib {
     Real LongstaffSchwartzPathPricer<PathType>::operator()
         (const PathType& path) const {
         if (calibrationPhase_) {
-            // store paths for the calibration
-            paths_.push_back(path);
+            // store what the calibration needs
+            for (Size i=1; i<len_; ++i) {
+                states_[i].push_back(pathPricer_->state(path, i));
+                exercises_[i].push_back((*pathPricer_)(path, i));
+            }
             // result doesn't matter
             return 0.0;
         }
@@ -135,10 +153,11 @@ namespace QuantLib {
             const Real exercise = (*pathPricer_)(path, i);
             if (exercise > 0.0) {
                 const StateType regValue = pathPricer_->state(path, i);
+                pathPricer_->basisValues(regValue, v_, basisValues_);
 
                 Real continuationValue = 0.0;
                 for (Size l=0; l<v_.size(); ++l) {
-                    continuationValue += coeff_[i-1][l] * v_[l](regValue);
+                    continuationValue += coeff_[i-1][l] * basisValues_[l];
                 }
 
                 if (continuationValue < exercise) {
@@ -157,66 +176,64 @@ namespace QuantLib {
 
     template <class PathType> inline
     void LongstaffSchwartzPathPricer<PathType>::calibrate() {
-        const Size n = paths_.size();
-        Array prices(n), exercise(n);
-        std::vector<StateType> p_state(n);
-        std::vector<Real> p_price(n), p_exercise(n);
-
-        for (Size i=0; i<n; ++i) {
-            p_state[i] = pathPricer_->state(paths_[i],len_-1);
-            prices[i] = p_price[i] = (*pathPricer_)(paths_[i], len_-1);
-            p_exercise[i] = prices[i];
-        }
+        const Size n = exercises_[len_-1].size();
+        const Size m = v_.size();
+        std::vector<Real> prices(exercises_[len_-1]);
 
-        post_processing(len_ - 1, p_state, p_price, p_exercise);
+        post_processing(len_ - 1, states_[len_-1], prices,
+                        exercises_[len_-1]);
 
-        std::vector<Real>      y;
-        std::vector<StateType> x;
+        // basis values of the in-the-money paths at the current time
+        std::vector<Real> x;
         for (Size i=len_-2; i>0; --i) {
-            y.clear();
+            const std::vector<StateType>& state = states_[i];
+            const std::vector<Real>& exercise = exercises_[i];
             x.clear();
 
             //roll back step
+            IncrementalLinearLeastSquares regression(m);
             for (Size j=0; j<n; ++j) {
-                exercise[j]=(*pathPricer_)(paths_[j], i);
                 if (exercise[j]>0.0) {
-                    x.push_back(pathPricer_->state(paths_[j], i));
-                    y.push_back(dF_[i]*prices[j]);
+                    pathPricer_->basisValues(state[j], v_, basisValues_);
+                    regression.add(basisValues_.begin(), dF_[i]*prices[j]);
+                    x.insert(x.end(), basisValues_.begin(),
+                             basisValues_.end());
                 }
             }
 
-            if (v_.size() <=  x.size()) {
-                coeff_[i-1] = GeneralLinearLeastSquares(x, y, v_).coefficients();
+            if (m <= regression.samples()) {
+                coeff_[i-1] = regression.coefficients();
             }
             else {
             // if number of itm paths is smaller then the number of
             // calibration functions then early exercise if exerciseValue > 0
-                coeff_[i-1] = Array(v_.size(), 0.0);
+                coeff_[i-1] = Array(m, 0.0);
             }
 
             for (Size j=0, k=0; j<n; ++j) {
                 prices[j]*=dF_[i];
                 if (exercise[j]>0.0) {
                     Real continuationValue = 0.0;
-                    for (Size l=0; l<v_.size(); ++l) {
-                        continuationValue += coeff_[i-1][l] * v_[l](x[k]);
+                    for (Size l=0; l<m; ++l) {
+                        continuationValue += coeff_[i-1][l] * x[k*m+l];
                     }
                     if (continuationValue < exercise[j]) {
                         prices[j] = exercise[j];
                     }
                     ++k;
                 }
-                p_state[j] = pathPricer_->state(paths_[j],i);
-                p_price[j] = prices[j];
-                p_exercise[j] = exercise[j];
             }
 
-            post_processing(i, p_state, p_price, p_exercise);
+            post_processing(i, state, prices, exercise);
         }
 
-        // remove calibration paths and release memory
-        std::vector<PathType> empty;
-        paths_.swap(empty);
+        // remove calibration data and release memory
+        for (Size i=0; i<len_; ++i) {
+            std::vector<StateType> emptyStates;
+            states_[i].swap(emptyStates);
+            std::vector<Real> emptyExercises;
+            exercises_[i].swap(emptyExercises);
+        }
         // entering the calculation phase
         calibrationPhase_ = false;
     }
@@ -175,4 +175,99 @@ namespace QuantLib {
         }
         return ret;
     }
+
+
+    LsmPathBasis::LsmPathBasis(Size order,
+                               LsmBasisSystem::PolynomType polyType)
+    : alpha_(order), beta_(order) {
+        switch (polyType) {
+          case LsmBasisSystem::Monomial:
+            break;
+          case LsmBasisSystem::Laguerre:
+            polynomial_ = boost::shared_ptr<GaussianOrthogonalPolynomial>(
+                                               new GaussLaguerrePolynomial);
+            break;
+          case LsmBasisSystem::Hermite:
+            polynomial_ = boost::shared_ptr<GaussianOrthogonalPolynomial>(
+                                               new GaussHermitePolynomial);
+            break;
+          case LsmBasisSystem::Hyperbolic:
+            polynomial_ = boost::shared_ptr<GaussianOrthogonalPolynomial>(
+                                             new GaussHyperbolicPolynomial);
+            break;
+          case LsmBasisSystem::Legendre:
+            polynomial_ = boost::shared_ptr<GaussianOrthogonalPolynomial>(
+                                               new GaussLegendrePolynomial);
+            break;
+          case LsmBasisSystem::Chebyshev:
+            polynomial_ = boost::shared_ptr<GaussianOrthogonalPolynomial>(
+                                              new GaussChebyshevPolynomial);
+            break;
+          case LsmBasisSystem::Chebyshev2nd:
+            polynomial_ = boost::shared_ptr<GaussianOrthogonalPolynomial>(
+                                           new GaussChebyshev2ndPolynomial);
+            break;
+          default:
+            QL_FAIL("unknown regression type");
+        }
+        // the recursion coefficients are only needed once; beta(0)
+        // does not enter the recursion and might not be defined
+        if (polynomial_) {
+            for (Size i=0; i<order; ++i) {
+                alpha_[i] = polynomial_->alpha(i);
+                beta_[i] = (i > 0) ? polynomial_->beta(i) : 0.0;
+            }
+        }
+    }
+
+    void LsmPathBasis::values(Real x, Array::iterator out) const {
+        const Size order = alpha_.size();
+        out[0] = 1.0;
+        if (!polynomial_) {
+            for (Size i=1; i<=order; ++i)
+                out[i] = out[i-1]*x;
+        } else {
+            // same recursion as GaussianOrthogonalPolynomial::value
+            if (order > 0)
+                out[1] = x-alpha_[0];
+            for (Size i=2; i<=order; ++i)
+                out[i] = (x-alpha_[i-1])*out[i-1] - beta_[i-1]*out[i-2];
+            const Real weight = std::sqrt(polynomial_->w(x));
+            for (Size i=0; i<=order; ++i)
+                out[i] = weight*out[i];
+        }
+    }
+
+
+    LsmMultiPathBasis::LsmMultiPathBasis(
+                                     Size dim, Size order,
+                                     LsmBasisSystem::PolynomType polyType)
+    : dim_(dim), pathBasis_(order, polyType),
+      table_(dim*(order+1)) {
+        QL_REQUIRE(dim>0, "zero dimension");
+        // same terms, in the same order, as multiPathBasisSystem
+        VV tuples(1, std::vector<Size>(dim));
+        terms_ = tuples;
+        for (Size i=1; i<=order; ++i) {
+            tuples = next_order_tuples(tuples);
+            terms_.insert(terms_.end(), tuples.begin(), tuples.end());
+        }
+    }
+
+    void LsmMultiPathBasis::values(const Array& x,
+                                   Array::iterator out) const {
+        #if defined(QL_EXTRA_SAFETY_CHECKS)
+        QL_REQUIRE(x.size()==dim_, "wrong argument size");
+        #endif
+        const Size n = pathBasis_.size();
+        for (Size k=0; k<dim_; ++k)
+            pathBasis_.values(x[k], table_.begin()+k*n);
+        for (Size i=0; i<terms_.size(); ++i) {
+            const std::vector<Size>& term = terms_[i];
+            Real ret = table_[term[0]];
+            for (Size k=1; k<dim_; ++k)
+                ret *= table_[k*n+term[k]];
+            out[i] = ret;
+        }
+    }
 }
@@ -30,10 +30,13 @@
 #include <ql/qldefines.hpp>
 #include <ql/math/array.hpp>
 #include <boost/function.hpp>
+#include <boost/shared_ptr.hpp>
 #include <vector>
 
 namespace QuantLib {
 
+    class GaussianOrthogonalPolynomial;
+
     class LsmBasisSystem {
       public:
         enum PolynomType { Monomial, Laguerre, Hermite, Hyperbolic,
@@ -46,6 +49,43 @@ namespace QuantLib {
             multiPathBasisSystem(Size dim, Size order, PolynomType polyType);
     };
 
+    //! all the functions of LsmBasisSystem::pathBasisSystem at once
+    /*! The values are the same, in the same order, as those of the
+        functions returned by LsmBasisSystem::pathBasisSystem; they
+        are obtained from a single pass of the polynomial recursion
+        instead of a function call (and a recursion) per term.
+    */
+    class LsmPathBasis {
+      public:
+        LsmPathBasis(Size order, LsmBasisSystem::PolynomType polyType);
+        Size size() const { return alpha_.size()+1; }
+        //! writes size() values starting at out
+        void values(Real x, Array::iterator out) const;
+      private:
+        boost::shared_ptr<GaussianOrthogonalPolynomial> polynomial_;
+        std::vector<Real> alpha_, beta_;
+    };
+
+    //! all the functions of LsmBasisSystem::multiPathBasisSystem at once
+    /*! The one-dimensional polynomials are evaluated once per
+        component of the state and multiplied together for each
+        term; values and ordering are the same as those of the
+        functions returned by LsmBasisSystem::multiPathBasisSystem.
+    */
+    class LsmMultiPathBasis {
+      public:
+        LsmMultiPathBasis(Size dim, Size order,
+                          LsmBasisSystem::PolynomType polyType);
+        Size size() const { return terms_.size(); }
+        //! writes size() values starting at out
+        void values(const Array& x, Array::iterator out) const;
+      private:
+        Size dim_;
+        LsmPathBasis pathBasis_;
+        std::vector<std::vector<Size> > terms_;
+        mutable Array table_;
+    };
+
 
 }
 
@@ -28,6 +28,7 @@
 #define quantlib_multi_path_generator_hpp
 
 #include <ql/methods/montecarlo/multipath.hpp>
+#include <ql/methods/montecarlo/brownianbridge.hpp>
 #include <ql/methods/montecarlo/sample.hpp>
 #include <ql/stochasticprocess.hpp>
 
@@ -42,6 +43,13 @@ namespace QuantLib {
         };
         \endcode
 
+        When the Brownian bridge is used, the variates are taken by
+        step and then by factor: the first process->factors()
+        variates of each sequence build the global step of each
+        factor, the next ones their midpoints, and so on.  This gives
+        the best dimensions of a low-discrepancy sequence to the
+        largest steps of all factors.
+
         \ingroup mcarlo
 
         \test the generated paths are checked against cached results
@@ -62,6 +70,8 @@ namespace QuantLib {
         boost::shared_ptr<StochasticProcess> process_;
         GSG generator_;
         mutable sample_type next_;
+        BrownianBridge bb_;
+        mutable std::vector<Real> bridged_;
     };
 
 
@@ -74,7 +84,8 @@ namespace QuantLib {
                    GSG generator,
                    bool brownianBridge)
     : brownianBridge_(brownianBridge), process_(process),
-      generator_(generator), next_(MultiPath(process->size(), times), 1.0) {
+      generator_(generator), next_(MultiPath(process->size(), times), 1.0),
+      bb_(times), bridged_(brownianBridge ? generator.dimension() : 0) {
 
         QL_REQUIRE(generator_.dimension() ==
                    process->factors()*(times.size()-1),
@@ -103,51 +114,51 @@ namespace QuantLib {
     const typename MultiPathGenerator<GSG>::sample_type&
     MultiPathGenerator<GSG>::next(bool antithetic) const {
 
-        if (brownianBridge_) {
-
-            QL_FAIL("Brownian bridge not supported");
-
-        } else {
+        typedef typename GSG::sample_type sequence_type;
+        const sequence_type& sequence_ =
+            antithetic ? generator_.lastSequence()
+                       : generator_.nextSequence();
 
-            typedef typename GSG::sample_type sequence_type;
-            const sequence_type& sequence_ =
-                antithetic ? generator_.lastSequence()
-                           : generator_.nextSequence();
+        Size m = process_->size();
+        Size n = process_->factors();
 
-            Size m = process_->size();
-            Size n = process_->factors();
-
-            MultiPath& path = next_.value;
+        // the factors are bridged together, as the paths of a block
+        const Real* variates = &sequence_.value[0];
+        if (brownianBridge_) {
+            bb_.transformPaths(n, variates, &bridged_[0]);
+            variates = &bridged_[0];
+        }
 
-            Array asset = process_->initialValues();
+        MultiPath& path = next_.value;
+
+        Array asset = process_->initialValues();
+        for (Size j=0; j<m; j++)
+            path[j].front() = asset[j];
+
+        Array temp(n);
+        next_.weight = sequence_.weight;
+
+        const TimeGrid& timeGrid = path[0].timeGrid();
+        Time t, dt;
+        for (Size i = 1; i < path.pathSize(); i++) {
+            Size offset = (i-1)*n;
+            t = timeGrid[i-1];
+            dt = timeGrid.dt(i-1);
+            if (antithetic)
+                std::transform(variates+offset,
+                               variates+offset+n,
+                               temp.begin(),
+                               std::negate<Real>());
+            else
+                std::copy(variates+offset,
+                          variates+offset+n,
+                          temp.begin());
+
+            asset = process_->evolve(t, asset, dt, temp);
             for (Size j=0; j<m; j++)
-                path[j].front() = asset[j];
-
-            Array temp(n);
-            next_.weight = sequence_.weight;
-
-            const TimeGrid& timeGrid = path[0].timeGrid();
-            Time t, dt;
-            for (Size i = 1; i < path.pathSize(); i++) {
-                Size offset = (i-1)*n;
-                t = timeGrid[i-1];
-                dt = timeGrid.dt(i-1);
-                if (antithetic)
-                    std::transform(sequence_.value.begin()+offset,
-                                   sequence_.value.begin()+offset+n,
-                                   temp.begin(),
-                                   std::negate<Real>());
-                else
-                    std::copy(sequence_.value.begin()+offset,
-                              sequence_.value.begin()+offset+n,
-                              temp.begin());
-
-                asset = process_->evolve(t, asset, dt, temp);
-                for (Size j=0; j<m; j++)
-                    path[j][i] = asset[j];
-            }
-            return next_;
+                path[j][i] = asset[j];
         }
+        return next_;
     }
 
 }
@@ -2,6 +2,7 @@
 /* Add the files to be included into Makefile.am instead. */
 
 #include <ql/models/equity/batesmodel.hpp>
+#include <ql/models/equity/characteristicfunctionmodel.hpp>
 #include <ql/models/equity/gjrgarchmodel.hpp>
 #include <ql/models/equity/hestonmodel.hpp>
 #include <ql/models/equity/hestonmodelhelper.hpp>
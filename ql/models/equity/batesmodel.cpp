@@ -21,6 +21,19 @@
 
 namespace QuantLib {
 
+    namespace {
+
+        // jump term for a deterministic, mean-reverting intensity
+        std::complex<Real> detJumpTerm(const std::complex<Real>& l,
+                                       Real lambda, Real kappaLambda,
+                                       Real thetaLambda, Time t) {
+            return (kappaLambda*t - 1.0 + std::exp(-kappaLambda*t))
+                * thetaLambda*l/(kappaLambda*t*lambda)
+                + (1.0 - std::exp(-kappaLambda*t))*l/(kappaLambda*t);
+        }
+
+    }
+
     BatesModel::BatesModel(const boost::shared_ptr<BatesProcess> & process)
     : HestonModel(process) {
         arguments_.resize(8);
@@ -43,6 +56,20 @@ namespace QuantLib {
              lambda(), nu(), delta()));
     }
 
+    std::complex<Real> BatesModel::addOnTerm(const std::complex<Real>& g,
+                                             Time t) const {
+        const Real delta2 = 0.5*delta()*delta();
+        return t*lambda()*(std::exp(nu()*g + delta2*g*g) - 1.0
+                           - g*(std::exp(nu() + delta2) - 1.0));
+    }
+
+    std::complex<Real> BatesModel::characteristicFunction(
+                                  const std::complex<Real>& u, Time t) const {
+        const std::complex<Real> iu(-u.imag(), u.real());
+        return HestonModel::characteristicFunction(u, t)
+            * std::exp(addOnTerm(iu, t));
+    }
+
     BatesDetJumpModel::BatesDetJumpModel(
             const boost::shared_ptr<BatesProcess> & process,
             Real kappaLambda, Real thetaLambda)
@@ -55,6 +82,14 @@ namespace QuantLib {
             ConstantParameter(thetaLambda, PositiveConstraint());
     }
 
+    std::complex<Real> BatesDetJumpModel::characteristicFunction(
+                                  const std::complex<Real>& u, Time t) const {
+        const std::complex<Real> iu(-u.imag(), u.real());
+        return HestonModel::characteristicFunction(u, t)
+            * std::exp(detJumpTerm(addOnTerm(iu, t), lambda(),
+                                   kappaLambda(), thetaLambda(), t));
+    }
+
 
     BatesDoubleExpModel::BatesDoubleExpModel(
         const boost::shared_ptr<HestonProcess> & process,
@@ -69,6 +104,20 @@ namespace QuantLib {
         arguments_[8] = ConstantParameter(lambda, PositiveConstraint());
     }
 
+    std::complex<Real> BatesDoubleExpModel::addOnTerm(
+                               const std::complex<Real>& g, Time t) const {
+        const Real q = 1.0 - p();
+        return t*lambda()*(p()/(1.0 - g*nuUp()) + q/(1.0 + g*nuDown()) - 1.0
+                           - g*(p()/(1.0 - nuUp()) + q/(1.0 + nuDown()) - 1.0));
+    }
+
+    std::complex<Real> BatesDoubleExpModel::characteristicFunction(
+                                  const std::complex<Real>& u, Time t) const {
+        const std::complex<Real> iu(-u.imag(), u.real());
+        return HestonModel::characteristicFunction(u, t)
+            * std::exp(addOnTerm(iu, t));
+    }
+
 
     BatesDoubleExpDetJumpModel::BatesDoubleExpDetJumpModel(
         const boost::shared_ptr<HestonProcess> & process,
@@ -82,5 +131,13 @@ namespace QuantLib {
         arguments_[10] =
             ConstantParameter(thetaLambda, PositiveConstraint());
     }
+
+    std::complex<Real> BatesDoubleExpDetJumpModel::characteristicFunction(
+                                  const std::complex<Real>& u, Time t) const {
+        const std::complex<Real> iu(-u.imag(), u.real());
+        return HestonModel::characteristicFunction(u, t)
+            * std::exp(detJumpTerm(addOnTerm(iu, t), lambda(),
+                                   kappaLambda(), thetaLambda(), t));
+    }
 }
 
@@ -48,8 +48,13 @@ namespace QuantLib {
         Real delta()  const { return arguments_[6](0.0); }
         Real lambda() const { return arguments_[7](0.0); }
 
+        std::complex<Real> characteristicFunction(
+                                  const std::complex<Real>& u, Time t) const;
       protected:
         void generateArguments();
+        //! log of the characteristic function of the jumps at -i*g
+        std::complex<Real> addOnTerm(const std::complex<Real>& g,
+                                     Time t) const;
     };
 
 
@@ -61,6 +66,9 @@ namespace QuantLib {
 
         Real kappaLambda() const { return arguments_[8](0.0); }
         Real thetaLambda() const { return arguments_[9](0.0); }
+
+        std::complex<Real> characteristicFunction(
+                                  const std::complex<Real>& u, Time t) const;
     };
 
 
@@ -74,6 +82,13 @@ namespace QuantLib {
         Real nuDown() const { return arguments_[6](0.0); }
         Real nuUp()   const { return arguments_[7](0.0); }
         Real lambda() const { return arguments_[8](0.0); }
+
+        std::complex<Real> characteristicFunction(
+                                  const std::complex<Real>& u, Time t) const;
+      protected:
+        //! log of the characteristic function of the jumps at -i*g
+        std::complex<Real> addOnTerm(const std::complex<Real>& g,
+                                     Time t) const;
     };
 
 
@@ -86,6 +101,9 @@ namespace QuantLib {
 
         Real kappaLambda() const { return arguments_[9](0.0); }
         Real thetaLambda() const { return arguments_[10](0.0); }
+
+        std::complex<Real> characteristicFunction(
+                                  const std::complex<Real>& u, Time t) const;
     };
 
 }
@@ -0,0 +1,60 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file characteristicfunctionmodel.hpp
+    \brief models with a known characteristic function of the log-asset
+*/
+
+#ifndef quantlib_characteristic_function_model_hpp
+#define quantlib_characteristic_function_model_hpp
+
+#include <ql/termstructures/yieldtermstructure.hpp>
+#include <complex>
+
+namespace QuantLib {
+
+    //! model with a known characteristic function of the log-asset
+    /*! Base class for equity models that can be used with Fourier
+        pricing engines.  The characteristic function is the one of
+        \f$ X_t = \ln(S_t/F_t) \f$, where \f$ F_t \f$ is the forward
+        of the asset for time \f$ t \f$, under the risk-neutral
+        measure, i.e.,
+        \f[
+            \phi(u,t) = E\left[ e^{iuX_t} \right];
+        \f]
+        since \f$ E[e^{X_t}] = 1 \f$, rates and dividends are left to
+        the term structures returned by the model.  The argument is
+        complex, so that Fourier engines can shift the integration
+        contour.
+    */
+    class CharacteristicFunctionModel : public virtual Observable {
+      public:
+        virtual ~CharacteristicFunctionModel() {}
+        //! characteristic function of the log-forward moneyness
+        virtual std::complex<Real> characteristicFunction(
+                              const std::complex<Real>& u, Time t) const = 0;
+        //! \name Market data
+        //@{
+        virtual Real s0() const = 0;
+        virtual const Handle<YieldTermStructure>& riskFreeRate() const = 0;
+        virtual const Handle<YieldTermStructure>& dividendYield() const = 0;
+        //@}
+    };
+
+}
+
+#endif
@@ -49,5 +49,24 @@ namespace QuantLib {
                                          sigma(), rho()));
     }
 
+    std::complex<Real> HestonModel::characteristicFunction(
+                                  const std::complex<Real>& u, Time t) const {
+        // formulation of Albrecher et al., which keeps the complex
+        // logarithm on its principal branch
+        const Real kappa = this->kappa(), sigma2 = sigma()*sigma();
+        const std::complex<Real> iu(-u.imag(), u.real());
+
+        const std::complex<Real> t1 = kappa - rho()*sigma()*iu;
+        const std::complex<Real> d = std::sqrt(t1*t1 + sigma2*(iu - iu*iu));
+        const std::complex<Real> g = (t1 - d)/(t1 + d);
+        const std::complex<Real> e = std::exp(-d*t);
+
+        const std::complex<Real> C = kappa*theta()/sigma2
+            * ((t1 - d)*t - 2.0*std::log((1.0 - g*e)/(1.0 - g)));
+        const std::complex<Real> D = (t1 - d)/sigma2*(1.0 - e)/(1.0 - g*e);
+
+        return std::exp(C + D*v0());
+    }
+
 }
 
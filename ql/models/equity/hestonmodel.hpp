@@ -25,6 +25,7 @@
 #define quantlib_heston_model_hpp
 
 #include <ql/models/model.hpp>
+#include <ql/models/equity/characteristicfunctionmodel.hpp>
 #include <ql/processes/hestonprocess.hpp>
 
 namespace QuantLib {
@@ -39,7 +40,8 @@ namespace QuantLib {
 
         \test calibration is tested against known good values.
     */
-    class HestonModel : public CalibratedModel {
+    class HestonModel : public CalibratedModel,
+                        public CharacteristicFunctionModel {
       public:
         HestonModel(const boost::shared_ptr<HestonProcess>& process);
 
@@ -57,6 +59,19 @@ namespace QuantLib {
         // underlying process
         boost::shared_ptr<HestonProcess> process() const { return process_; }
 
+        //! \name CharacteristicFunctionModel interface
+        //@{
+        std::complex<Real> characteristicFunction(
+                                  const std::complex<Real>& u, Time t) const;
+        Real s0() const { return process_->s0()->value(); }
+        const Handle<YieldTermStructure>& riskFreeRate() const {
+            return process_->riskFreeRate();
+        }
+        const Handle<YieldTermStructure>& dividendYield() const {
+            return process_->dividendYield();
+        }
+        //@}
+
         class FellerConstraint;
       protected:
         void generateArguments();
@@ -62,5 +62,42 @@ namespace QuantLib {
     PiecewiseTimeDependentHestonModel::riskFreeRate() const {
         return riskFreeRate_;
     }
+
+    std::complex<Real>
+    PiecewiseTimeDependentHestonModel::characteristicFunction(
+                               const std::complex<Real>& u, Time term) const {
+        QL_REQUIRE(term < timeGrid_.back(), "maturity is too large");
+
+        // backward recursion over the intervals of the time grid,
+        // as in AnalyticPTDHestonEngine
+        const std::complex<Real> iu(-u.imag(), u.real());
+        std::complex<Real> C = 0.0, D = 0.0;
+
+        for (Size i=timeGrid_.size()-1; i > 0; --i) {
+            const Time begin = timeGrid_[i-1];
+            if (begin < term) {
+                const Time end = std::min(term, timeGrid_[i]);
+                const Time tau = end-begin;
+                const Time t   = 0.5*(end+begin);
+
+                const Real sigma = this->sigma(t);
+                const Real kappa = this->kappa(t);
+                const Real sigma2 = sigma*sigma;
+
+                const std::complex<Real> t1 = kappa - rho(t)*sigma*iu;
+                const std::complex<Real> d =
+                    std::sqrt(t1*t1 + sigma2*(iu - iu*iu));
+                const std::complex<Real> g = (t1-d)/(t1+d);
+                const std::complex<Real> gt
+                                      = (t1-d - D*sigma2)/(t1+d - D*sigma2);
+                const std::complex<Real> e = std::exp(-d*tau);
+
+                D = (t1+d)/sigma2*(g-gt*e)/(1.0-gt*e);
+                C += kappa*theta(t)/sigma2
+                    * ((t1-d)*tau - 2.0*std::log((1.0-gt*e)/(1.0-gt)));
+            }
+        }
+        return std::exp(C + D*v0());
+    }
 }
 
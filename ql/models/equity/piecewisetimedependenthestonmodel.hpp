@@ -26,6 +26,7 @@
 
 #include <ql/timegrid.hpp>
 #include <ql/models/model.hpp>
+#include <ql/models/equity/characteristicfunctionmodel.hpp>
 
 namespace QuantLib {
 
@@ -41,7 +42,8 @@ namespace QuantLib {
         transform methods: application to Heston’s model,
         http://arxiv.org/pdf/0708.2020
     */
-    class PiecewiseTimeDependentHestonModel : public CalibratedModel {
+    class PiecewiseTimeDependentHestonModel
+        : public CalibratedModel, public CharacteristicFunctionModel {
       public:
           PiecewiseTimeDependentHestonModel(
               const Handle<YieldTermStructure>& riskFreeRate,
@@ -71,6 +73,9 @@ namespace QuantLib {
         const TimeGrid& timeGrid() const;
         const Handle<YieldTermStructure>& dividendYield() const;
         const Handle<YieldTermStructure>& riskFreeRate() const;
+
+        std::complex<Real> characteristicFunction(
+                                  const std::complex<Real>& u, Time t) const;
         
       protected:
         const Handle<Quote> s0_;
@@ -23,55 +23,97 @@
 #include <ql/models/marketmodels/evolutiondescription.hpp>
 #include <ql/models/marketmodels/curvestate.hpp>
 #include <algorithm>
+#include <string>
 
 namespace QuantLib {
 
+    namespace {
+
+        // paths simulated by each evolver before the values are
+        // passed to the statistics; this bounds the memory used
+        // for storing them.
+        const Size pathsPerWorker = 1024;
+
+    }
+
+    AccountingEngine::Worker::Worker(
+                         const boost::shared_ptr<MarketModelEvolver>& evolver,
+                         const Clone<MarketModelMultiProduct>& product)
+    : evolver(evolver), product(product), pathsDrawn(0),
+      numerairesHeld(product->numberOfProducts()),
+      numberCashFlowsThisStep(product->numberOfProducts()),
+      cashFlowsGenerated(product->numberOfProducts()) {
+        for (Size i=0; i<cashFlowsGenerated.size(); ++i)
+            cashFlowsGenerated[i].resize(
+                          product->maxNumberOfCashFlowsPerProductPerStep());
+    }
+
     AccountingEngine::AccountingEngine(
                          const boost::shared_ptr<MarketModelEvolver>& evolver,
                          const Clone<MarketModelMultiProduct>& product,
                          Real initialNumeraireValue)
-    : evolver_(evolver), product_(product),
-      initialNumeraireValue_(initialNumeraireValue),
-      numberProducts_(product->numberOfProducts()),
-      numerairesHeld_(product->numberOfProducts()),
-      numberCashFlowsThisStep_(product->numberOfProducts()),
-      cashFlowsGenerated_(product->numberOfProducts()) {
-        for (Size i=0; i<numberProducts_; ++i)
-            cashFlowsGenerated_[i].resize(
-                       product_->maxNumberOfCashFlowsPerProductPerStep());
+    : initialNumeraireValue_(initialNumeraireValue),
+      numberProducts_(product->numberOfProducts()), pathsDone_(0) {
+        workers_.push_back(Worker(evolver, product));
+        initialize(product);
+    }
+
+    AccountingEngine::AccountingEngine(
+              const std::vector<boost::shared_ptr<MarketModelEvolver> >& evs,
+              const Clone<MarketModelMultiProduct>& product,
+              Real initialNumeraireValue)
+    : initialNumeraireValue_(initialNumeraireValue),
+      numberProducts_(product->numberOfProducts()), pathsDone_(0) {
+        QL_REQUIRE(!evs.empty(), "no evolvers given");
+        workers_.reserve(evs.size());
+        for (Size i=0; i<evs.size(); ++i) {
+            QL_REQUIRE(evs[i], "null evolver #" << i);
+            QL_REQUIRE(evs[i]->numeraires() == evs[0]->numeraires(),
+                       "evolver #" << i << " uses different numeraires");
+            workers_.push_back(Worker(evs[i], product));
+        }
+        initialize(product);
+    }
 
+    void AccountingEngine::initialize(
+                              const Clone<MarketModelMultiProduct>& product) {
         const std::vector<Time>& cashFlowTimes =
-            product_->possibleCashFlowTimes();
-        const std::vector<Rate>& rateTimes = product_->evolution().rateTimes();
+            product->possibleCashFlowTimes();
+        const std::vector<Rate>& rateTimes = product->evolution().rateTimes();
         discounters_.reserve(cashFlowTimes.size());
         for (Size j=0; j<cashFlowTimes.size(); ++j)
             discounters_.push_back(MarketModelDiscounter(cashFlowTimes[j],
                                                          rateTimes));
-
     }
 
-    Real AccountingEngine::singlePathValues(std::vector<Real>& values) {
-        std::fill(numerairesHeld_.begin(), numerairesHeld_.end(), 0.0);
-        Real weight = evolver_->startNewPath();
-        product_->reset();
+    Real AccountingEngine::singlePathValues(Worker& worker,
+                                            std::vector<Real>& values) const {
+        MarketModelEvolver& evolver = *worker.evolver;
+        MarketModelMultiProduct& product = *worker.product;
+        std::vector<Real>& numerairesHeld = worker.numerairesHeld;
+
+        std::fill(numerairesHeld.begin(), numerairesHeld.end(), 0.0);
+        Real weight = evolver.startNewPath();
+        ++worker.pathsDrawn;
+        product.reset();
         Real principalInNumerairePortfolio = 1.0;
 
         bool done = false;
         do {
-            Size thisStep = evolver_->currentStep();
-            weight *= evolver_->advanceStep();
-            done = product_->nextTimeStep(evolver_->currentState(),
-                                          numberCashFlowsThisStep_,
-                                          cashFlowsGenerated_);
+            Size thisStep = evolver.currentStep();
+            weight *= evolver.advanceStep();
+            done = product.nextTimeStep(evolver.currentState(),
+                                        worker.numberCashFlowsThisStep,
+                                        worker.cashFlowsGenerated);
             Size numeraire =
-                evolver_->numeraires()[thisStep];
+                evolver.numeraires()[thisStep];
 
             // for each product...
             for (Size i=0; i<numberProducts_; ++i) {
                 // ...and each cash flow...
                 const std::vector<MarketModelMultiProduct::CashFlow>& cashflows =
-                    cashFlowsGenerated_[i];
-                for (Size j=0; j<numberCashFlowsThisStep_[i]; ++j) {
+                    worker.cashFlowsGenerated[i];
+                for (Size j=0; j<worker.numberCashFlowsThisStep[i]; ++j) {
                     // ...convert the cash flow to numeraires.
                     // This is done by calculating the number of
                     // numeraire bonds corresponding to such cash flow...
@@ -79,12 +121,12 @@ namespace QuantLib {
                         discounters_[cashflows[j].timeIndex];
 
                     Real bonds = cashflows[j].amount *
-                        discounter.numeraireBonds(evolver_->currentState(),
+                        discounter.numeraireBonds(evolver.currentState(),
                                                   numeraire);
 
                     // ...and adding the newly bought bonds to the number
                     // of numeraires held.
-                    numerairesHeld_[i] += bonds/principalInNumerairePortfolio;
+                    numerairesHeld[i] += bonds/principalInNumerairePortfolio;
                 }
             }
 
@@ -97,17 +139,17 @@ namespace QuantLib {
                 // the principal of the numeraire and updating the number
                 // of bonds in the numeraire portfolio accordingly.
 
-                Size nextNumeraire = evolver_->numeraires()[thisStep+1];
+                Size nextNumeraire = evolver.numeraires()[thisStep+1];
 
                 principalInNumerairePortfolio *=
-                    evolver_->currentState().discountRatio(numeraire,
-                                                           nextNumeraire);
+                    evolver.currentState().discountRatio(numeraire,
+                                                         nextNumeraire);
             }
 
         } while (!done);
 
-        for (Size i=0; i<numerairesHeld_.size(); ++i)
-            values[i] = numerairesHeld_[i] * initialNumeraireValue_;
+        for (Size i=0; i<numerairesHeld.size(); ++i)
+            values[i] = numerairesHeld[i] * initialNumeraireValue_;
 
         return weight;
     }
@@ -115,10 +157,71 @@ namespace QuantLib {
     void AccountingEngine::multiplePathValues(SequenceStatisticsInc& stats,
                                               Size numberOfPaths)
     {
-        std::vector<Real> values(product_->numberOfProducts());
-        for (Size i=0; i<numberOfPaths; ++i) {
-            Real weight = singlePathValues(values);
-            stats.add(values,weight);
+        std::vector<Real> values(numberProducts_);
+        const Size nWorkers = workers_.size();
+
+        if (nWorkers == 1) {
+            for (Size i=0; i<numberOfPaths; ++i) {
+                Real weight = singlePathValues(workers_[0], values);
+                stats.add(values,weight);
+            }
+            pathsDone_ += numberOfPaths;
+            return;
+        }
+
+        // the paths are simulated in batches; in each of them, every
+        // worker takes a contiguous block of paths and stores their
+        // values, which are then added to the statistics in order.
+        std::vector<Real> batchValues(nWorkers*pathsPerWorker*numberProducts_);
+        std::vector<Real> batchWeights(nWorkers*pathsPerWorker);
+        std::vector<std::string> errors(nWorkers);
+
+        Size remaining = numberOfPaths;
+        while (remaining > 0) {
+            const Size batchSize =
+                std::min<Size>(remaining, nWorkers*pathsPerWorker);
+
+            #pragma omp parallel for
+            for (Size w=0; w<nWorkers; ++w) {
+                try {
+                    Worker& worker = workers_[w];
+                    const Size begin = (batchSize*w)/nWorkers;
+                    const Size end = (batchSize*(w+1))/nWorkers;
+                    // paths can only be skipped forward; a worker that
+                    // got ahead (e.g., after an earlier failure) can't
+                    // reproduce the serial sequence any more
+                    QL_REQUIRE(worker.pathsDrawn <= pathsDone_ + begin,
+                               "worker has drawn " << worker.pathsDrawn
+                               << " paths, cannot go back to path "
+                               << pathsDone_ + begin);
+                    worker.evolver->skipPaths(pathsDone_ + begin
+                                              - worker.pathsDrawn);
+                    worker.pathsDrawn = pathsDone_ + begin;
+                    std::vector<Real> pathValues(numberProducts_);
+                    for (Size i=begin; i<end; ++i) {
+                        batchWeights[i] =
+                            singlePathValues(worker, pathValues);
+                        std::copy(pathValues.begin(), pathValues.end(),
+                                  batchValues.begin()+i*numberProducts_);
+                    }
+                } catch (std::exception& e) {
+                    errors[w] = e.what();
+                }
+            }
+
+            for (Size w=0; w<nWorkers; ++w)
+                QL_REQUIRE(errors[w].empty(),
+                           "evolver #" << w << ": " << errors[w]);
+
+            for (Size i=0; i<batchSize; ++i) {
+                std::copy(batchValues.begin()+i*numberProducts_,
+                          batchValues.begin()+(i+1)*numberProducts_,
+                          values.begin());
+                stats.add(values, batchWeights[i]);
+            }
+
+            pathsDone_ += batchSize;
+            remaining -= batchSize;
         }
     }
 
@@ -41,27 +41,53 @@ namespace QuantLib {
     //struct MarketModelMultiProduct::CashFlow;
 
     //! Engine collecting cash flows along a market-model simulation
+    /*! When more than one evolver is given, the paths are simulated
+        in parallel (if OpenMP is enabled); each evolver is driven by
+        a single thread together with its own copy of the product.
+
+        The evolvers must be equivalent, i.e., built on the same
+        model, numeraires and Brownian-generator factory. Each of
+        them simulates a contiguous block of paths and skips the
+        paths of the others, and the path values are added to the
+        statistics in their original order; therefore, the results
+        are the same as those obtained with a single evolver and the
+        same number of paths.
+    */
     class AccountingEngine {
       public:
         AccountingEngine(const boost::shared_ptr<MarketModelEvolver>& evolver,
                          const Clone<MarketModelMultiProduct>& product,
                          Real initialNumeraireValue);
+        AccountingEngine(
+               const std::vector<boost::shared_ptr<MarketModelEvolver> >&,
+               const Clone<MarketModelMultiProduct>& product,
+               Real initialNumeraireValue);
         void multiplePathValues(SequenceStatisticsInc& stats,
                                 Size numberOfPaths);
       private:
-        Real singlePathValues(std::vector<Real>& values);
-
-        boost::shared_ptr<MarketModelEvolver> evolver_;
-        Clone<MarketModelMultiProduct> product_;
+        // evolver, product and workspace used by a single thread
+        struct Worker {
+            Worker(const boost::shared_ptr<MarketModelEvolver>& evolver,
+                   const Clone<MarketModelMultiProduct>& product);
+            boost::shared_ptr<MarketModelEvolver> evolver;
+            Clone<MarketModelMultiProduct> product;
+            // paths drawn so far by the evolver, skipped ones included
+            Size pathsDrawn;
+            std::vector<Real> numerairesHeld;
+            std::vector<Size> numberCashFlowsThisStep;
+            std::vector<std::vector<MarketModelMultiProduct::CashFlow> >
+                                                         cashFlowsGenerated;
+        };
+        void initialize(const Clone<MarketModelMultiProduct>& product);
+        Real singlePathValues(Worker& worker,
+                              std::vector<Real>& values) const;
+
+        std::vector<Worker> workers_;
 
         Real initialNumeraireValue_;
         Size numberProducts_;
+        Size pathsDone_;
 
-        // workspace
-        std::vector<Real> numerairesHeld_;
-        std::vector<Size> numberCashFlowsThisStep_;
-        std::vector<std::vector<MarketModelMultiProduct::CashFlow> >
-                                                         cashFlowsGenerated_;
         std::vector<MarketModelDiscounter> discounters_;
 
     };
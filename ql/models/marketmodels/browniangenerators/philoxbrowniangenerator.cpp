@@ -0,0 +1,72 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/models/marketmodels/browniangenerators/philoxbrowniangenerator.hpp>
+#include <algorithm>
+
+namespace QuantLib {
+
+    PhiloxBrownianGenerator::PhiloxBrownianGenerator(Size factors,
+                                                     Size steps,
+                                                     BigNatural seed,
+                                                     BigNatural substream)
+    : factors_(factors), steps_(steps), lastStep_(0),
+      generator_(seed, substream), variates_(factors*steps) {}
+
+    Real PhiloxBrownianGenerator::nextStep(std::vector<Real>& output) {
+        #if defined(QL_EXTRA_SAFETY_CHECKS)
+        QL_REQUIRE(output.size() == factors_, "size mismatch");
+        QL_REQUIRE(lastStep_<steps_, "uniform sequence exhausted");
+        #endif
+        std::copy(variates_.begin() + lastStep_*factors_,
+                  variates_.begin() + (lastStep_+1)*factors_,
+                  output.begin());
+        ++lastStep_;
+        return 1.0;
+    }
+
+    Real PhiloxBrownianGenerator::nextPath() {
+        Real* x = &variates_[0];
+        generator_.nextReals(variates_.size(), x);
+        inverseCumulative_.values(x, x + variates_.size(), x);
+        lastStep_ = 0;
+        return 1.0;
+    }
+
+    void PhiloxBrownianGenerator::skipPaths(Size n) {
+        generator_.discard(BigNatural(n)*variates_.size());
+        lastStep_ = 0;
+    }
+
+    Size PhiloxBrownianGenerator::numberOfFactors() const { return factors_; }
+
+    Size PhiloxBrownianGenerator::numberOfSteps() const { return steps_; }
+
+
+    PhiloxBrownianGeneratorFactory::PhiloxBrownianGeneratorFactory(
+                                                     BigNatural seed,
+                                                     BigNatural substream)
+    : seed_(seed), substream_(substream) {}
+
+    boost::shared_ptr<BrownianGenerator>
+    PhiloxBrownianGeneratorFactory::create(Size factors, Size steps) const {
+        return boost::shared_ptr<BrownianGenerator>(
+                 new PhiloxBrownianGenerator(factors, steps,
+                                             seed_, substream_));
+    }
+
+}
@@ -0,0 +1,77 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file philoxbrowniangenerator.hpp
+    \brief Philox Brownian generator for market-model simulations
+*/
+
+#ifndef quantlib_philox_brownian_generator_hpp
+#define quantlib_philox_brownian_generator_hpp
+
+#include <ql/models/marketmodels/browniangenerator.hpp>
+#include <ql/math/randomnumbers/philoxuniformrng.hpp>
+#include <ql/math/distributions/normaldistribution.hpp>
+
+namespace QuantLib {
+
+    //! Philox Brownian generator for market-model simulations
+    /*! Incremental Brownian generator using a Philox counter-based
+        uniform generator and inverse-cumulative Gaussian method.
+        The variates of a whole path are generated and transformed
+        at once when the path is started.
+
+        Since the generator can jump to any position of its sequence,
+        skipped paths cost nothing; simulations can be split among
+        several generators with the same seed, each skipping the
+        paths drawn by the others, or each using a different
+        substream.
+    */
+    class PhiloxBrownianGenerator : public BrownianGenerator {
+      public:
+        PhiloxBrownianGenerator(Size factors,
+                                Size steps,
+                                BigNatural seed = 0,
+                                BigNatural substream = 0);
+
+        Real nextStep(std::vector<Real>&);
+        Real nextPath();
+        void skipPaths(Size n);
+
+        Size numberOfFactors() const;
+        Size numberOfSteps() const;
+      private:
+        Size factors_, steps_;
+        Size lastStep_;
+        PhiloxUniformRng generator_;
+        InverseCumulativeNormal inverseCumulative_;
+        std::vector<Real> variates_;
+    };
+
+    class PhiloxBrownianGeneratorFactory : public BrownianGeneratorFactory {
+      public:
+        PhiloxBrownianGeneratorFactory(BigNatural seed = 0,
+                                       BigNatural substream = 0);
+        boost::shared_ptr<BrownianGenerator> create(Size factors,
+                                                    Size steps) const;
+      private:
+        BigNatural seed_, substream_;
+    };
+
+}
+
+
+#endif
@@ -19,11 +19,15 @@
 
 #include <ql/models/marketmodels/browniangenerators/sobolbrowniangenerator.hpp>
 #include <boost/iterator/permutation_iterator.hpp>
+#include <algorithm>
 
 namespace QuantLib {
 
     namespace {
 
+        // paths drawn together by nextPaths
+        const Size pathsPerBlock = 32;
+
         void fillByFactor(std::vector<std::vector<Size> >& M,
                           Size factors, Size steps) {
             Size counter = 0;
@@ -114,11 +118,10 @@ namespace QuantLib {
                                         unsigned long seed,
                                         SobolRsg::DirectionIntegers integers)
     : factors_(factors), steps_(steps), ordering_(ordering),
-      generator_(SobolRsg(factors*steps, seed, integers),
-                 InverseCumulativeNormal()),
-      bridge_(steps), lastStep_(0),
+      generator_(factors*steps, seed, integers),
+      bridge_(steps), lastStep_(0), drawnPaths_(0),
       orderedIndices_(factors, std::vector<Size>(steps)),
-      bridgedVariates_(factors, std::vector<Real>(steps)) {
+      bridgedVariates_(factors*steps) {
 
         switch (ordering_) {
           case Factors:
@@ -133,27 +136,78 @@ namespace QuantLib {
           default:
             QL_FAIL("unknown ordering");
         }
+
+        stepIndices_.resize(factors_*steps_);
+        for (Size i=0; i<steps_; ++i)
+            for (Size f=0; f<factors_; ++f)
+                stepIndices_[i*factors_+f] = orderedIndices_[f][i];
     }
 
 
     Real SobolBrownianGenerator::nextPath() {
-        typedef InverseCumulativeRsg<SobolRsg,
-                                     InverseCumulativeNormal>::sample_type
-            sample_type;
-
-        const sample_type& sample = generator_.nextSequence();
-        // Brownian-bridge the variates according to the ordered indices
-        for (Size i=0; i<factors_; ++i) {
-            bridge_.transform(boost::make_permutation_iterator(
-                                                  sample.value.begin(),
-                                                  orderedIndices_[i].begin()),
-                              boost::make_permutation_iterator(
-                                                  sample.value.begin(),
-                                                  orderedIndices_[i].end()),
-                              bridgedVariates_[i].begin());
+        nextPaths(1, &bridgedVariates_[0]);
+        return 1.0;
+    }
+
+    void SobolBrownianGenerator::nextPaths(Size n, Real* out) {
+        const Size dim = factors_*steps_;
+        const Size block = std::min(n, pathsPerBlock);
+        variates_.resize(block*dim);
+        orderedVariates_.resize(block*dim);
+        for (Size p0=0; p0<n; p0+=block) {
+            const Size m = std::min(block, n-p0);
+            const Size columns = m*factors_;
+            Real* x = &variates_[0];
+            Real* y = &orderedVariates_[0];
+            generator_.nextSequences(m, x);
+            inverseCumulative_.values(x, x+m*dim, x);
+            // the variates of each factor of each path are gathered
+            // according to the ordered indices and stored by step...
+            for (Size i=0; i<steps_; ++i) {
+                const Size* k = &stepIndices_[i*factors_];
+                Real* w = y + i*columns;
+                for (Size p=0; p<m; ++p, w+=factors_) {
+                    const Real* v = x + p*dim;
+                    for (Size f=0; f<factors_; ++f)
+                        w[f] = v[k[f]];
+                }
+            }
+            // ...so that they can be bridged together; a single path
+            // is already stored as required by out
+            if (m == 1) {
+                bridge_.transformPaths(columns, y, out + p0*dim);
+            } else {
+                bridge_.transformPaths(columns, y, x);
+                for (Size p=0; p<m; ++p) {
+                    for (Size i=0; i<steps_; ++i)
+                        std::copy(x + i*columns + p*factors_,
+                                  x + i*columns + (p+1)*factors_,
+                                  out + (p0+p)*dim + i*factors_);
+                }
+            }
+        }
+        if (n > 0 && out != &bridgedVariates_[0])
+            std::copy(out + (n-1)*dim, out + n*dim,
+                      bridgedVariates_.begin());
+        lastStep_ = 0;
+        drawnPaths_ += n;
+    }
+
+    void SobolBrownianGenerator::skipPaths(Size n) {
+        drawnPaths_ += n;
+        // skipTo costs about as much as drawing one point per bit
+        if (n > 8*sizeof(unsigned long)) {
+            // after skipTo(k), the next draw returns the k-th point
+            // (counting from 0) of a generator that didn't draw yet,
+            // but the (k+1)-th of one that did; drawing a point first
+            // ensures that we are in the second case.
+            generator_.nextInt32Sequence();
+            generator_.skipTo(drawnPaths_-1);
+        } else {
+            for (Size i=0; i<n; ++i)
+                generator_.nextInt32Sequence();
         }
         lastStep_ = 0;
-        return sample.weight;
     }
     
     
@@ -198,8 +252,9 @@ namespace QuantLib {
         QL_REQUIRE(output.size() == factors_, "size mismatch");
         QL_REQUIRE(lastStep_<steps_, "sequence exhausted");
         #endif
-        for (Size i=0; i<factors_; ++i)
-            output[i] = bridgedVariates_[i][lastStep_];
+        std::copy(bridgedVariates_.begin() + lastStep_*factors_,
+                  bridgedVariates_.begin() + (lastStep_+1)*factors_,
+                  output.begin());
         ++lastStep_;
         return 1.0;
     }
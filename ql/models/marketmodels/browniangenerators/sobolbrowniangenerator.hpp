@@ -22,7 +22,6 @@
 #define quantlib_sobol_brownian_generator_hpp
 
 #include <ql/models/marketmodels/browniangenerator.hpp>
-#include <ql/math/randomnumbers/inversecumulativersg.hpp>
 #include <ql/math/randomnumbers/sobolrsg.hpp>
 #include <ql/methods/montecarlo/brownianbridge.hpp>
 #include <ql/math/distributions/normaldistribution.hpp>
@@ -33,6 +32,16 @@ namespace QuantLib {
     //! Sobol Brownian generator for market-model simulations
     /*! Incremental Brownian generator using a Sobol generator,
         inverse-cumulative Gaussian method, and Brownian bridging.
+
+        Skipped paths only advance the underlying Sobol sequence,
+        without any Gaussian inversion or bridging; long skips jump
+        directly to the first path to be drawn, so that separate
+        generators can draw disjoint parts of the sequence.
+
+        Paths can also be drawn in blocks by means of nextPaths(); the
+        Sobol points of all paths in a block are generated, inverted
+        and bridged together, which is faster than drawing the paths
+        one at a time.
     */
     class SobolBrownianGenerator : public BrownianGenerator {
       public:
@@ -56,6 +65,14 @@ namespace QuantLib {
 
         Real nextPath();
         Real nextStep(std::vector<Real>&);
+        void skipPaths(Size n);
+        /*! draws the next n paths, as if nextPath() was called n
+            times; the variations are written to out by path, then
+            by step, then by factor, so that out must have room for
+            n*numberOfFactors()*numberOfSteps() values.  The
+            generator is left at the start of the last path drawn.
+        */
+        void nextPaths(Size n, Real* out);
 
         Size numberOfFactors() const;
         Size numberOfSteps() const;
@@ -68,12 +85,17 @@ namespace QuantLib {
       private:
         Size factors_, steps_;
         Ordering ordering_;
-        InverseCumulativeRsg<SobolRsg,InverseCumulativeNormal> generator_;
+        SobolRsg generator_;
+        InverseCumulativeNormal inverseCumulative_;
         BrownianBridge bridge_;
         // work variables
         Size lastStep_;
+        unsigned long drawnPaths_;
+        std::vector<Real> variates_, orderedVariates_;
         std::vector<std::vector<Size> > orderedIndices_;
-        std::vector<std::vector<Real> > bridgedVariates_;
+        // ordered indices by step, then by factor
+        std::vector<Size> stepIndices_;
+        std::vector<Real> bridgedVariates_;
     };
 
     class SobolBrownianGeneratorFactory : public BrownianGeneratorFactory {
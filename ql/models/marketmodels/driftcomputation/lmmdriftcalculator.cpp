@@ -181,4 +181,83 @@ namespace QuantLib {
         }
     }
 
+    void LMMDriftCalculator::compute(const Matrix& forwards,
+                                     Matrix& drifts) const {
+        const Size paths = forwards.columns();
+        QL_REQUIRE(forwards.rows()==numberOfRates_,
+                   "forwards.rows() <> dim");
+        QL_REQUIRE(drifts.rows()==numberOfRates_ && drifts.columns()==paths,
+                   "drifts and forwards have different sizes");
+
+        if (tmpBlock_.columns() != paths) {
+            tmpBlock_ = Matrix(numberOfRates_, paths);
+            eBlock_ = Matrix(numberOfFactors_, paths);
+        }
+
+        // Precompute forwards factor
+        for (Size i=alive_; i<numberOfRates_; ++i) {
+            const Real d = displacements_[i], t = oneOverTaus_[i];
+            Matrix::const_row_iterator f = forwards.row_begin(i);
+            Matrix::row_iterator x = tmpBlock_.row_begin(i);
+            for (Size j=0; j<paths; ++j)
+                x[j] = (f[j]+d)/(t+f[j]);
+        }
+
+        if (isFullFactor_) {
+            // same as computePlain, one row of drifts at a time
+            for (Size i=alive_; i<numberOfRates_; ++i) {
+                Matrix::row_iterator mu = drifts.row_begin(i);
+                std::fill(mu, mu+paths, 0.0);
+                for (Size k=downs_[i]; k<ups_[i]; ++k) {
+                    const Real c = C_[i][k];
+                    Matrix::const_row_iterator x = tmpBlock_.row_begin(k);
+                    for (Size j=0; j<paths; ++j)
+                        mu[j] += c*x[j];
+                }
+                if (numeraire_>i+1) {
+                    for (Size j=0; j<paths; ++j)
+                        mu[j] = -mu[j];
+                }
+            }
+            return;
+        }
+
+        // same as computeReduced; the rows of eBlock_ hold the
+        // partial sums e_[r][i] for all paths at the current rate.
+        if (numeraire_>0)
+            std::fill(drifts.row_begin(numeraire_-1),
+                      drifts.row_end(numeraire_-1), 0.0);
+
+        std::fill(eBlock_.begin(), eBlock_.end(), 0.0);
+        for (Integer i=static_cast<Integer>(numeraire_)-2;
+             i>=static_cast<Integer>(alive_); --i) {
+            Matrix::row_iterator mu = drifts.row_begin(i);
+            std::fill(mu, mu+paths, 0.0);
+            Matrix::const_row_iterator x = tmpBlock_.row_begin(i+1);
+            for (Size r=0; r<numberOfFactors_; ++r) {
+                const Real a = pseudo_[i+1][r], p = pseudo_[i][r];
+                Matrix::row_iterator e = eBlock_.row_begin(r);
+                for (Size j=0; j<paths; ++j) {
+                    e[j] += x[j] * a;
+                    mu[j] -= e[j]*p;
+                }
+            }
+        }
+
+        std::fill(eBlock_.begin(), eBlock_.end(), 0.0);
+        for (Size i=numeraire_; i<numberOfRates_; ++i) {
+            Matrix::row_iterator mu = drifts.row_begin(i);
+            std::fill(mu, mu+paths, 0.0);
+            Matrix::const_row_iterator x = tmpBlock_.row_begin(i);
+            for (Size r=0; r<numberOfFactors_; ++r) {
+                const Real a = pseudo_[i][r];
+                Matrix::row_iterator e = eBlock_.row_begin(r);
+                for (Size j=0; j<paths; ++j) {
+                    e[j] += x[j] * a;
+                    mu[j] += e[j]*a;
+                }
+            }
+        }
+    }
+
 }
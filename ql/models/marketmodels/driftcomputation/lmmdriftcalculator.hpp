@@ -64,6 +64,12 @@ namespace QuantLib {
         void computeReduced(const std::vector<Rate>& fwds,
                             std::vector<Real>& drifts) const;
 
+        /*! Computes the drifts of a block of paths at once; forwards
+            and drifts are (rates x paths) matrices holding a path in
+            each column. The innermost loops run over the paths, and
+            each column yields the same result as compute(). */
+        void compute(const Matrix& forwards, Matrix& drifts) const;
+
       private:
         Size numberOfRates_, numberOfFactors_;
         bool isFullFactor_;
@@ -74,6 +80,7 @@ namespace QuantLib {
         // temporary variables to be added later
         mutable std::vector<Real> tmp_;
         mutable Matrix e_;
+        mutable Matrix tmpBlock_, eBlock_;
         std::vector<Size> downs_, ups_;
     };
 
@@ -38,6 +38,16 @@ namespace QuantLib {
 
         virtual const std::vector<Size>& numeraires() const = 0;
         virtual Real startNewPath() = 0;
+        //! discards the random numbers of the next n paths
+        /*! This allows several evolvers built on the same Brownian
+            generator factory to share out the paths of a single
+            simulation. The default implementation starts and
+            abandons n paths.
+        */
+        virtual void skipPaths(Size n) {
+            for (Size i=0; i<n; ++i)
+                startNewPath();
+        }
         virtual Real advanceStep() = 0;
         virtual Size currentStep() const = 0;
         virtual const CurveState& currentState() const = 0;
@@ -99,6 +99,10 @@ namespace QuantLib {
         return generator_->nextPath();
     }
 
+    void LogNormalFwdRateBalland::skipPaths(Size n) {
+        generator_->skipPaths(n);
+    }
+
     Real LogNormalFwdRateBalland::advanceStep()
     {
         // we're going from T1 to T2:
@@ -0,0 +1,226 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/models/marketmodels/evolvers/lognormalfwdrateblockpc.hpp>
+#include <ql/models/marketmodels/marketmodel.hpp>
+#include <ql/models/marketmodels/evolutiondescription.hpp>
+#include <ql/models/marketmodels/browniangenerator.hpp>
+
+namespace QuantLib {
+
+    LogNormalFwdRateBlockPc::LogNormalFwdRateBlockPc(
+                           const boost::shared_ptr<MarketModel>& marketModel,
+                           const BrownianGeneratorFactory& factory,
+                           const std::vector<Size>& numeraires,
+                           Size initialStep,
+                           Size blockSize)
+    : marketModel_(marketModel),
+      numeraires_(numeraires),
+      initialStep_(initialStep), blockSize_(blockSize),
+      numberOfRates_(marketModel->numberOfRates()),
+      numberOfFactors_(marketModel_->numberOfFactors()),
+      curveState_(marketModel->evolution().rateTimes()),
+      currentStep_(initialStep), currentPath_(0), nextPath_(blockSize),
+      evolved_(false),
+      forwards_(marketModel->initialRates()),
+      displacements_(marketModel->displacements()),
+      initialForwards_(numberOfRates_), initialLogForwards_(numberOfRates_),
+      initialDrifts_(numberOfRates_), brownians_(numberOfFactors_),
+      correlatedBrownians_(blockSize),
+      alive_(marketModel->evolution().firstAliveRate()),
+      pathWeights_(blockSize),
+      logForwards_(numberOfRates_, blockSize),
+      currentForwards_(numberOfRates_, blockSize),
+      drifts1_(numberOfRates_, blockSize),
+      drifts2_(numberOfRates_, blockSize)
+    {
+        QL_REQUIRE(blockSize_ > 0, "null block size");
+        checkCompatibility(marketModel->evolution(), numeraires);
+
+        Size steps = marketModel->evolution().numberOfSteps();
+
+        generator_ = factory.create(numberOfFactors_, steps-initialStep_);
+
+        stepWeights_ = Matrix(steps, blockSize_);
+        blockBrownians_.resize(steps, Matrix(numberOfFactors_, blockSize_));
+        blockForwards_.resize(steps, Matrix(numberOfRates_, blockSize_));
+
+        calculators_.reserve(steps);
+        fixedDrifts_.reserve(steps);
+        for (Size j=0; j<steps; ++j) {
+            const Matrix& A = marketModel_->pseudoRoot(j);
+            calculators_.push_back(
+                LMMDriftCalculator(A,
+                                   displacements_,
+                                   marketModel->evolution().rateTaus(),
+                                   numeraires[j],
+                                   alive_[j]));
+            std::vector<Real> fixed(numberOfRates_);
+            for (Size k=0; k<numberOfRates_; ++k) {
+                Real variance =
+                    std::inner_product(A.row_begin(k), A.row_end(k),
+                                       A.row_begin(k), 0.0);
+                fixed[k] = -0.5*variance;
+            }
+            fixedDrifts_.push_back(fixed);
+        }
+
+        setForwards(marketModel_->initialRates());
+    }
+
+    const std::vector<Size>& LogNormalFwdRateBlockPc::numeraires() const {
+        return numeraires_;
+    }
+
+    void LogNormalFwdRateBlockPc::setForwards(
+                                        const std::vector<Real>& forwards) {
+        QL_REQUIRE(forwards.size()==numberOfRates_,
+                   "mismatch between forwards and rateTimes");
+        for (Size i=0; i<numberOfRates_; ++i) {
+            initialForwards_[i] = forwards[i];
+            initialLogForwards_[i] = std::log(forwards[i] +
+                                              displacements_[i]);
+        }
+        calculators_[initialStep_].compute(forwards, initialDrifts_);
+        // the paths left in the current block must be evolved again
+        evolved_ = false;
+    }
+
+    void LogNormalFwdRateBlockPc::setInitialState(const CurveState& cs) {
+        setForwards(cs.forwardRates());
+    }
+
+    Real LogNormalFwdRateBlockPc::startNewPath() {
+        if (nextPath_ == blockSize_) {
+            drawBlock();
+            nextPath_ = 0;
+        }
+        if (!evolved_)
+            evolveBlock();
+        currentPath_ = nextPath_++;
+        currentStep_ = initialStep_;
+        return pathWeights_[currentPath_];
+    }
+
+    void LogNormalFwdRateBlockPc::skipPaths(Size n) {
+        const Size left = blockSize_ - nextPath_;
+        if (n <= left) {
+            nextPath_ += n;
+        } else {
+            generator_->skipPaths(n - left);
+            nextPath_ = blockSize_;
+        }
+    }
+
+    void LogNormalFwdRateBlockPc::drawBlock() {
+        // the generator is used path by path, as in LogNormalFwdRatePc
+        const Size steps = blockBrownians_.size();
+        for (Size j=0; j<blockSize_; ++j) {
+            pathWeights_[j] = generator_->nextPath();
+            for (Size s=initialStep_; s<steps; ++s) {
+                stepWeights_[s][j] = generator_->nextStep(brownians_);
+                for (Size k=0; k<numberOfFactors_; ++k)
+                    blockBrownians_[s][k][j] = brownians_[k];
+            }
+        }
+        evolved_ = false;
+    }
+
+    void LogNormalFwdRateBlockPc::evolveBlock() {
+        for (Size i=0; i<numberOfRates_; ++i) {
+            std::fill(logForwards_.row_begin(i), logForwards_.row_end(i),
+                      initialLogForwards_[i]);
+            std::fill(currentForwards_.row_begin(i),
+                      currentForwards_.row_end(i), initialForwards_[i]);
+        }
+
+        const Size steps = blockBrownians_.size();
+        for (Size s=initialStep_; s<steps; ++s) {
+            // we're going from T1 to T2
+
+            // a) compute drifts D1 at T1;
+            if (s > initialStep_) {
+                calculators_[s].compute(currentForwards_, drifts1_);
+            } else {
+                for (Size i=0; i<numberOfRates_; ++i)
+                    std::fill(drifts1_.row_begin(i), drifts1_.row_end(i),
+                              initialDrifts_[i]);
+            }
+
+            // b) evolve forwards up to T2 using D1;
+            const Matrix& A = marketModel_->pseudoRoot(s);
+            const Matrix& Z = blockBrownians_[s];
+            const std::vector<Real>& fixedDrift = fixedDrifts_[s];
+
+            Size alive = alive_[s];
+            for (Size i=alive; i<numberOfRates_; ++i) {
+                Matrix::row_iterator x = logForwards_.row_begin(i);
+                Matrix::row_iterator f = currentForwards_.row_begin(i);
+                Matrix::const_row_iterator d1 = drifts1_.row_begin(i);
+                std::fill(correlatedBrownians_.begin(),
+                          correlatedBrownians_.end(), 0.0);
+                for (Size k=0; k<numberOfFactors_; ++k) {
+                    const Real a = A[i][k];
+                    Matrix::const_row_iterator z = Z.row_begin(k);
+                    for (Size j=0; j<blockSize_; ++j)
+                        correlatedBrownians_[j] += a*z[j];
+                }
+                for (Size j=0; j<blockSize_; ++j) {
+                    x[j] += d1[j] + fixedDrift[i];
+                    x[j] += correlatedBrownians_[j];
+                    f[j] = std::exp(x[j]) - displacements_[i];
+                }
+            }
+
+            // c) recompute drifts D2 using the predicted forwards;
+            calculators_[s].compute(currentForwards_, drifts2_);
+
+            // d) correct forwards using both drifts
+            for (Size i=alive; i<numberOfRates_; ++i) {
+                Matrix::row_iterator x = logForwards_.row_begin(i);
+                Matrix::row_iterator f = currentForwards_.row_begin(i);
+                Matrix::const_row_iterator d1 = drifts1_.row_begin(i);
+                Matrix::const_row_iterator d2 = drifts2_.row_begin(i);
+                for (Size j=0; j<blockSize_; ++j) {
+                    x[j] += (d2[j]-d1[j])/2.0;
+                    f[j] = std::exp(x[j]) - displacements_[i];
+                }
+            }
+
+            // e) store the forwards at T2
+            blockForwards_[s] = currentForwards_;
+        }
+        evolved_ = true;
+    }
+
+    Real LogNormalFwdRateBlockPc::advanceStep() {
+        const Matrix& forwards = blockForwards_[currentStep_];
+        for (Size i=0; i<numberOfRates_; ++i)
+            forwards_[i] = forwards[i][currentPath_];
+        curveState_.setOnForwardRates(forwards_);
+        return stepWeights_[currentStep_++][currentPath_];
+    }
+
+    Size LogNormalFwdRateBlockPc::currentStep() const {
+        return currentStep_;
+    }
+
+    const CurveState& LogNormalFwdRateBlockPc::currentState() const {
+        return curveState_;
+    }
+
+}
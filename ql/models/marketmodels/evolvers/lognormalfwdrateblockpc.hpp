@@ -0,0 +1,100 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file lognormalfwdrateblockpc.hpp
+    \brief Predictor-corrector evolver simulating blocks of paths
+*/
+
+#ifndef quantlib_forward_rate_block_pc_evolver_hpp
+#define quantlib_forward_rate_block_pc_evolver_hpp
+
+#include <ql/models/marketmodels/evolver.hpp>
+#include <ql/models/marketmodels/curvestates/lmmcurvestate.hpp>
+#include <ql/models/marketmodels/driftcomputation/lmmdriftcalculator.hpp>
+#include <ql/math/matrix.hpp>
+
+namespace QuantLib {
+
+    class MarketModel;
+    class BrownianGenerator;
+    class BrownianGeneratorFactory;
+
+    //! Predictor-Corrector working on blocks of paths
+    /*! This evolver follows the same scheme as LogNormalFwdRatePc
+        and, given the same Brownian generator, yields the same
+        paths; however, they are simulated in blocks. When a new
+        block is needed, the Brownian increments of all its paths
+        are drawn and the forwards are evolved for all the paths at
+        once on (rates x paths) matrices, so that drifts and
+        pseudo-root multiplications become loops over the paths
+        which the compiler can vectorize. The evolved forwards are
+        stored and returned one path at a time through the usual
+        interface.
+
+        The memory used is proportional to the number of steps,
+        rates and paths in a block.
+    */
+    class LogNormalFwdRateBlockPc : public MarketModelEvolver {
+      public:
+        LogNormalFwdRateBlockPc(const boost::shared_ptr<MarketModel>&,
+                                const BrownianGeneratorFactory&,
+                                const std::vector<Size>& numeraires,
+                                Size initialStep = 0,
+                                Size blockSize = 64);
+        //! \name MarketModel interface
+        //@{
+        const std::vector<Size>& numeraires() const;
+        Real startNewPath();
+        void skipPaths(Size n);
+        Real advanceStep();
+        Size currentStep() const;
+        const CurveState& currentState() const;
+        void setInitialState(const CurveState&);
+        //@}
+      private:
+        void setForwards(const std::vector<Real>& forwards);
+        void drawBlock();
+        void evolveBlock();
+        // inputs
+        boost::shared_ptr<MarketModel> marketModel_;
+        std::vector<Size> numeraires_;
+        Size initialStep_, blockSize_;
+        boost::shared_ptr<BrownianGenerator> generator_;
+        // fixed variables
+        std::vector<std::vector<Real> > fixedDrifts_;
+        // working variables
+        Size numberOfRates_, numberOfFactors_;
+        LMMCurveState curveState_;
+        Size currentStep_, currentPath_, nextPath_;
+        bool evolved_;
+        std::vector<Rate> forwards_, displacements_, initialForwards_,
+                          initialLogForwards_;
+        std::vector<Real> initialDrifts_, brownians_, correlatedBrownians_;
+        std::vector<Size> alive_;
+        // block variables; the matrices are (rates x paths) except
+        // the Brownian increments, which are (factors x paths)
+        std::vector<Real> pathWeights_;
+        Matrix stepWeights_;
+        std::vector<Matrix> blockBrownians_, blockForwards_;
+        Matrix logForwards_, currentForwards_, drifts1_, drifts2_;
+        // helper classes
+        std::vector<LMMDriftCalculator> calculators_;
+    };
+
+}
+
+#endif
@@ -99,6 +99,10 @@ namespace QuantLib {
         return generator_->nextPath();
     }
 
+    void LogNormalFwdRateEuler::skipPaths(Size n) {
+        generator_->skipPaths(n);
+    }
+
     Real LogNormalFwdRateEuler::advanceStep()
     {
         // we're going from T1 to T2
@@ -100,6 +100,10 @@ namespace QuantLib {
         return generator_->nextPath();
     }
 
+    void LogNormalFwdRateiBalland::skipPaths(Size n) {
+        generator_->skipPaths(n);
+    }
+
     Real LogNormalFwdRateiBalland::advanceStep()
     {
         Real weight = generator_->nextStep(brownians_);
@@ -102,6 +102,10 @@ namespace QuantLib {
         return generator_->nextPath();
     }
 
+    void LogNormalFwdRateIpc::skipPaths(Size n) {
+        generator_->skipPaths(n);
+    }
+
     Real LogNormalFwdRateIpc::advanceStep()
     {
         // we're going from T1 to T2:
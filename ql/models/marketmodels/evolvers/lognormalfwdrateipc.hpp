@@ -42,6 +42,7 @@ namespace QuantLib {
         //@{
         const std::vector<Size>& numeraires() const;
         Real startNewPath();
+        void skipPaths(Size n);
         Real advanceStep();
         Size currentStep() const;
         const CurveState& currentState() const;
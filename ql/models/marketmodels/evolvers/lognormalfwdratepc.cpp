@@ -101,6 +101,10 @@ namespace QuantLib {
         return generator_->nextPath();
     }
 
+    void LogNormalFwdRatePc::skipPaths(Size n) {
+        generator_->skipPaths(n);
+    }
+
     Real LogNormalFwdRatePc::advanceStep()
     {
         // we're going from T1 to T2
@@ -95,6 +95,10 @@ namespace QuantLib {
         return generator_->nextPath();
     }
 
+    void NormalFwdRatePc::skipPaths(Size n) {
+        generator_->skipPaths(n);
+    }
+
     Real NormalFwdRatePc::advanceStep()
     {
         // we're going from T1 to T2
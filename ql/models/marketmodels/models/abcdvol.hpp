@@ -26,6 +26,7 @@
 #include <ql/models/marketmodels/marketmodel.hpp>
 #include <ql/models/marketmodels/evolutiondescription.hpp>
 #include <ql/math/matrix.hpp>
+#include <ql/math/matrixutilities/symmetricschurdecomposition.hpp>
 #include <vector>
 
 namespace QuantLib {
@@ -45,7 +46,9 @@ namespace QuantLib {
             const EvolutionDescription& evolution,
             const Size numberOfFactors,
             const std::vector<Rate>& initialRates,
-            const std::vector<Spread>& displacements);
+            const std::vector<Spread>& displacements,
+            SymmetricSchurDecomposition::Algorithm algorithm =
+                                    SymmetricSchurDecomposition::Jacobi);
         //! \name MarketModel interface
         //@{
         const std::vector<Rate>& initialRates() const;
@@ -303,11 +303,8 @@ namespace QuantLib {
             deformationSize = 0.0;
 
             // factor reduction
-            std::vector<Matrix> corrPseudo(corr.times().size());
-            for (Size i=0; i<corrPseudo.size(); ++i)
-                corrPseudo[i] = rankReducedSqrt(corr.correlation(i),
-                numberOfFactors, 1.0,
-                SalvagingAlgorithm::None);
+            const std::vector<Matrix>& corrPseudo =
+                corr.pseudoRoots(numberOfFactors);
 
             // get Zinverse, we can get wj later
             Matrix zedMatrix =
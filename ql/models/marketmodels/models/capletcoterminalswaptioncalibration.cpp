@@ -87,11 +87,8 @@ namespace QuantLib {
         Real extraMultiplier = useFullAprox ? 1.0 : 0.0;
 
         // factor reduction
-        std::vector<Matrix> corrPseudo(corr.times().size());
-        for (Size i=0; i<corrPseudo.size(); ++i)
-            corrPseudo[i] = rankReducedSqrt(corr.correlation(i),
-                                            numberOfFactors, 1.0,
-                                            SalvagingAlgorithm::None);
+        const std::vector<Matrix>& corrPseudo =
+            corr.pseudoRoots(numberOfFactors);
 
         Matrix zedMatrix =
             SwapForwardMappings::coterminalSwapZedMatrix(cs, displacement);
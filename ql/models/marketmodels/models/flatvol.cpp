@@ -52,7 +52,8 @@ namespace QuantLib {
             const EvolutionDescription& evolution,
             Size numberOfFactors,
             const vector<Rate>& initialRates,
-            const vector<Spread>& displacements)
+            const vector<Spread>& displacements,
+            SymmetricSchurDecomposition::Algorithm algorithm)
     : numberOfFactors_(numberOfFactors),
       numberOfRates_(initialRates.size()),
       numberOfSteps_(evolution.evolutionTimes().size()),
@@ -86,10 +87,12 @@ namespace QuantLib {
         Time effStopTime = 0.0;
         const vector<Time>& corrTimes = corr->times();
         const vector<Time>& evolTimes = evolution.evolutionTimes();
-        Matrix covariance(numberOfRates_, numberOfRates_);
+        vector<Matrix> covariances(numberOfSteps_,
+                                   Matrix(numberOfRates_, numberOfRates_,
+                                          0.0));
         for (Size k=0, kk=0; k<numberOfSteps_; ++k) {
             // one covariance per evolution step
-            std::fill(covariance.begin(), covariance.end(), 0.0);
+            Matrix& covariance = covariances[k];
 
             // there might be more than one correlation matrix
             // in a single evolution step
@@ -128,11 +131,25 @@ namespace QuantLib {
                      covariance[j][i] = covariance[i][j];
                  }
             }
+        }
 
-            pseudoRoots_[k] = rankReducedSqrt(covariance,
-                                              numberOfFactors, 1.0,
-                                              SalvagingAlgorithm::None);
+        // the decompositions are independent of each other
+        vector<std::string> errors(numberOfSteps_);
+        #pragma omp parallel for
+        for (Size k=0; k<numberOfSteps_; ++k) {
+            try {
+                pseudoRoots_[k] = rankReducedSqrt(covariances[k],
+                                                  numberOfFactors, 1.0,
+                                                  SalvagingAlgorithm::None,
+                                                  algorithm);
+            } catch (std::exception& e) {
+                errors[k] = e.what();
+            }
+        }
 
+        for (Size k=0; k<numberOfSteps_; ++k) {
+            QL_REQUIRE(errors[k].empty(),
+                       "step " << k << ": " << errors[k]);
             QL_ENSURE(pseudoRoots_[k].rows()==numberOfRates_,
                       "step " << k
                       << " flat vol wrong number of rows: "
@@ -27,6 +27,7 @@
 #include <ql/models/marketmodels/marketmodel.hpp>
 #include <ql/models/marketmodels/evolutiondescription.hpp>
 #include <ql/math/matrix.hpp>
+#include <ql/math/matrixutilities/symmetricschurdecomposition.hpp>
 #include <ql/math/interpolation.hpp>
 #include <ql/termstructures/yieldtermstructure.hpp>
 #include <ql/handle.hpp>
@@ -44,7 +45,9 @@ namespace QuantLib {
             const EvolutionDescription& evolution,
             Size numberOfFactors,
             const std::vector<Rate>& initialRates,
-            const std::vector<Spread>& displacements);
+            const std::vector<Spread>& displacements,
+            SymmetricSchurDecomposition::Algorithm algorithm =
+                                    SymmetricSchurDecomposition::Jacobi);
         //! \name MarketModel interface
         //@{
         const std::vector<Rate>& initialRates() const;
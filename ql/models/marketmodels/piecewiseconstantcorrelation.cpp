@@ -0,0 +1,83 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ Copyright (C) 2007 Ferdinando Ametrano
+ Copyright (C) 2007 Mark Joshi
+
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/models/marketmodels/piecewiseconstantcorrelation.hpp>
+#include <ql/math/matrixutilities/pseudosqrt.hpp>
+#include <algorithm>
+#include <string>
+
+namespace QuantLib {
+
+    namespace {
+
+        bool sameMatrices(const std::vector<Matrix>& m1,
+                          const std::vector<Matrix>& m2) {
+            if (m1.size() != m2.size())
+                return false;
+            for (Size i=0; i<m1.size(); ++i) {
+                if (m1[i].rows() != m2[i].rows() ||
+                    m1[i].columns() != m2[i].columns() ||
+                    !std::equal(m1[i].begin(), m1[i].end(), m2[i].begin()))
+                    return false;
+            }
+            return true;
+        }
+
+    }
+
+    const std::vector<Matrix>&
+    PiecewiseConstantCorrelation::pseudoRoots(
+                   Size numberOfFactors,
+                   SymmetricSchurDecomposition::Algorithm algorithm) const {
+        const std::vector<Matrix>& corrs = correlations();
+        if (!sameMatrices(corrs, cachedCorrelations_)) {
+            pseudoRoots_.clear();
+            cachedCorrelations_ = corrs;
+        }
+
+        const root_key key(numberOfFactors, algorithm);
+        std::map<root_key, std::vector<Matrix> >::const_iterator cached =
+            pseudoRoots_.find(key);
+        if (cached != pseudoRoots_.end())
+            return cached->second;
+
+        std::vector<Matrix> results(corrs.size());
+        std::vector<std::string> errors(corrs.size());
+        #pragma omp parallel for
+        for (Size i=0; i<corrs.size(); ++i) {
+            try {
+                results[i] = rankReducedSqrt(corrs[i], numberOfFactors, 1.0,
+                                             SalvagingAlgorithm::None,
+                                             algorithm);
+            } catch (std::exception& e) {
+                errors[i] = e.what();
+            }
+        }
+        for (Size i=0; i<errors.size(); ++i)
+            QL_REQUIRE(errors[i].empty(),
+                       "pseudo-root of correlation " << i
+                       << " failed: " << errors[i]);
+
+        std::vector<Matrix>& roots = pseudoRoots_[key];
+        roots.swap(results);
+        return roots;
+    }
+
+}
@@ -22,7 +22,9 @@
 #define quantlib_piecewise_constant_correlation_hpp
 
 #include <ql/math/matrix.hpp>
+#include <ql/math/matrixutilities/symmetricschurdecomposition.hpp>
 #include <vector>
+#include <map>
 
 namespace QuantLib {
 
@@ -37,6 +39,27 @@ namespace QuantLib {
         virtual const std::vector<Matrix>& correlations() const = 0;
         virtual const Matrix& correlation(Size i) const;
         virtual Size numberOfRates() const = 0;
+        //! rank-reduced pseudo-roots of the correlation matrices
+        /*! The results are calculated on the first call for a given
+            number of factors and eigenvalue algorithm (in parallel
+            across times if OpenMP is enabled) and cached, so that
+            calibrations calling this repeatedly do not repeat the
+            decompositions.  The cache is discarded when the matrices
+            returned by correlations() change.
+
+            \warning the cache is not synchronized; the same instance
+                     must not be used concurrently from different
+                     threads.
+        */
+        const std::vector<Matrix>& pseudoRoots(
+                    Size numberOfFactors,
+                    SymmetricSchurDecomposition::Algorithm algorithm =
+                                    SymmetricSchurDecomposition::Jacobi) const;
+      private:
+        typedef std::pair<Size, SymmetricSchurDecomposition::Algorithm>
+                                                                    root_key;
+        mutable std::vector<Matrix> cachedCorrelations_;
+        mutable std::map<root_key, std::vector<Matrix> > pseudoRoots_;
     };
 
     inline const Matrix&
@@ -40,18 +40,77 @@ Real Gaussian1dModel::forwardRate(const Date &fixing,
         iborIdx->forwardingTermStructure(); // might be empty, then use
                                             // model curve
 
-    Date valueDate = iborIdx->valueDate(fixing);
-    Date endDate = iborIdx->fixingCalendar().advance(
-        valueDate, iborIdx->tenor(), iborIdx->businessDayConvention(),
-        iborIdx->endOfMonth());
-    // FIXME Here we should use the calculation date calendar ?
-    Real dcf = iborIdx->dayCounter().yearFraction(valueDate, endDate);
+    Date valueDate, endDate;
+    Real dcf;
+    forwardRatePeriod(fixing, iborIdx, valueDate, endDate, dcf);
 
     return (zerobond(valueDate, referenceDate, y, yts) -
             zerobond(endDate, referenceDate, y, yts)) /
            (dcf * zerobond(endDate, referenceDate, y, yts));
 }
 
+const Disposable<Array>
+Gaussian1dModel::forwardRate(const Date &fixing, const Date &referenceDate,
+                             const Array &y,
+                             boost::shared_ptr<IborIndex> iborIdx) const {
+
+    QL_REQUIRE(iborIdx != NULL, "no ibor index given");
+
+    calculate();
+
+    if (fixing <= (evaluationDate_ + (enforcesTodaysHistoricFixings_ ? 0 : -1))) {
+        Array result(y.size(), iborIdx->fixing(fixing));
+        return result;
+    }
+
+    Handle<YieldTermStructure> yts =
+        iborIdx->forwardingTermStructure(); // might be empty, then use
+                                            // model curve
+
+    Date valueDate, endDate;
+    Real dcf;
+    forwardRatePeriod(fixing, iborIdx, valueDate, endDate, dcf);
+
+    Array result = zerobond(valueDate, referenceDate, y, yts);
+    Array endDiscount = zerobond(endDate, referenceDate, y, yts);
+    for (Size j = 0; j < y.size(); j++)
+        result[j] = (result[j] - endDiscount[j]) / (dcf * endDiscount[j]);
+
+    return result;
+}
+
+void Gaussian1dModel::forwardRatePeriod(
+    const Date &fixing, const boost::shared_ptr<IborIndex> &iborIdx,
+    Date &valueDate, Date &endDate, Real &dcf) const {
+
+    valueDate = iborIdx->valueDate(fixing);
+    endDate = iborIdx->fixingCalendar().advance(
+        valueDate, iborIdx->tenor(), iborIdx->businessDayConvention(),
+        iborIdx->endOfMonth());
+    // FIXME Here we should use the calculation date calendar ?
+    dcf = iborIdx->dayCounter().yearFraction(valueDate, endDate);
+}
+
+const Disposable<Array>
+Gaussian1dModel::numeraireArrayImpl(const Time t, const Array &y,
+                                    const Handle<YieldTermStructure> &yts) const {
+
+    Array result(y.size());
+    for (Size j = 0; j < y.size(); j++)
+        result[j] = numeraireImpl(t, y[j], yts);
+    return result;
+}
+
+const Disposable<Array>
+Gaussian1dModel::zerobondArrayImpl(const Time T, const Time t, const Array &y,
+                                   const Handle<YieldTermStructure> &yts) const {
+
+    Array result(y.size());
+    for (Size j = 0; j < y.size(); j++)
+        result[j] = zerobondImpl(T, t, y[j], yts);
+    return result;
+}
+
 Real Gaussian1dModel::swapRate(const Date &fixing, const Period &tenor,
                                const Date &referenceDate, const Real y,
                                boost::shared_ptr<SwapIndex> swapIdx) const {
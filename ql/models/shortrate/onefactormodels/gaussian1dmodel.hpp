@@ -94,6 +94,35 @@ class Gaussian1dModel : public TermStructureConsistentModel, public LazyObject {
         const Real y = 0.0,
         const Handle<YieldTermStructure> &yts = Handle<YieldTermStructure>()) const;
 
+    /*! Array versions of the methods above, returning the values for
+        a whole grid of state variable values. Everything that depends
+        on the times only (e.g. the discount factors of the yield term
+        structure) is computed once per call. */
+
+    const Disposable<Array>
+    numeraire(const Time t, const Array &y,
+              const Handle<YieldTermStructure> &yts =
+                  Handle<YieldTermStructure>()) const;
+
+    const Disposable<Array>
+    zerobond(const Time T, const Time t, const Array &y,
+             const Handle<YieldTermStructure> &yts =
+                 Handle<YieldTermStructure>()) const;
+
+    const Disposable<Array>
+    numeraire(const Date &referenceDate, const Array &y,
+              const Handle<YieldTermStructure> &yts =
+                  Handle<YieldTermStructure>()) const;
+
+    const Disposable<Array>
+    zerobond(const Date &maturity, const Date &referenceDate, const Array &y,
+             const Handle<YieldTermStructure> &yts =
+                 Handle<YieldTermStructure>()) const;
+
+    const Disposable<Array>
+    forwardRate(const Date &fixing, const Date &referenceDate, const Array &y,
+                boost::shared_ptr<IborIndex> iborIdx) const;
+
     Real zerobondOption(
         const Option::Type &type, const Date &expiry, const Date &valueDate,
         const Date &maturity, const Rate strike,
@@ -181,6 +210,12 @@ class Gaussian1dModel : public TermStructureConsistentModel, public LazyObject {
 
     mutable CacheType swapCache_;
 
+    // value date, end date and accrual period of the forward rate
+    // with the given fixing date, shared by the forwardRate overloads
+    void forwardRatePeriod(const Date &fixing,
+                           const boost::shared_ptr<IborIndex> &iborIdx,
+                           Date &valueDate, Date &endDate, Real &dcf) const;
+
   protected:
     // we let derived classes register with the termstructure
     Gaussian1dModel(const Handle<YieldTermStructure> &yieldTermStructure)
@@ -197,6 +232,16 @@ class Gaussian1dModel : public TermStructureConsistentModel, public LazyObject {
     virtual Real zerobondImpl(const Time T, const Time t, const Real y,
                               const Handle<YieldTermStructure> &yts) const = 0;
 
+    // the default implementations call the scalar versions above for
+    // each state, derived classes should override them if possible
+    virtual const Disposable<Array>
+    numeraireArrayImpl(const Time t, const Array &y,
+                       const Handle<YieldTermStructure> &yts) const;
+
+    virtual const Disposable<Array>
+    zerobondArrayImpl(const Time T, const Time t, const Array &y,
+                      const Handle<YieldTermStructure> &yts) const;
+
     void performCalculations() const {
         evaluationDate_ = Settings::instance().evaluationDate();
         enforcesTodaysHistoricFixings_ =
@@ -250,6 +295,19 @@ Gaussian1dModel::zerobond(const Time T, const Time t, const Real y,
     return zerobondImpl(T, t, y, yts);
 }
 
+inline const Disposable<Array>
+Gaussian1dModel::numeraire(const Time t, const Array &y,
+                           const Handle<YieldTermStructure> &yts) const {
+
+    return numeraireArrayImpl(t, y, yts);
+}
+
+inline const Disposable<Array>
+Gaussian1dModel::zerobond(const Time T, const Time t, const Array &y,
+                          const Handle<YieldTermStructure> &yts) const {
+    return zerobondArrayImpl(T, t, y, yts);
+}
+
 inline Real
 Gaussian1dModel::numeraire(const Date &referenceDate, const Real y,
                            const Handle<YieldTermStructure> &yts) const {
@@ -267,6 +325,25 @@ Gaussian1dModel::zerobond(const Date &maturity, const Date &referenceDate,
                         : 0.0,
                     y, yts);
 }
+
+inline const Disposable<Array>
+Gaussian1dModel::numeraire(const Date &referenceDate, const Array &y,
+                           const Handle<YieldTermStructure> &yts) const {
+
+    return numeraire(termStructure()->timeFromReference(referenceDate), y, yts);
+}
+
+inline const Disposable<Array>
+Gaussian1dModel::zerobond(const Date &maturity, const Date &referenceDate,
+                          const Array &y,
+                          const Handle<YieldTermStructure> &yts) const {
+
+    return zerobond(termStructure()->timeFromReference(maturity),
+                    referenceDate != Null<Date>()
+                        ? termStructure()->timeFromReference(referenceDate)
+                        : 0.0,
+                    y, yts);
+}
 }
 
 #endif
@@ -216,4 +216,55 @@ Real Gsr::numeraireImpl(const Time t, const Real y,
                    : yts->discount(p->getForwardMeasureTime());
     return zerobond(p->getForwardMeasureTime(), t, y, yts);
 }
+
+const Disposable<Array>
+Gsr::zerobondArrayImpl(const Time T, const Time t, const Array &y,
+                       const Handle<YieldTermStructure> &yts) const {
+
+    calculate();
+
+    if (t == 0.0) {
+        Array result(y.size(), yts.empty()
+                                   ? this->termStructure()->discount(T, true)
+                                   : yts->discount(T, true));
+        return result;
+    }
+
+    boost::shared_ptr<GsrProcess> p =
+        boost::dynamic_pointer_cast<GsrProcess>(stateProcess_);
+
+    Real stdDev = stateProcess_->stdDeviation(0.0, 0.0, t);
+    Real mean = stateProcess_->expectation(0.0, 0.0, t);
+    Real gtT = p->G(t, T, 0.0);
+
+    Real d = yts.empty()
+                 ? termStructure()->discount(T, true) /
+                       termStructure()->discount(t, true)
+                 : yts->discount(T, true) / yts->discount(t, true);
+    Real c = d * exp(-0.5 * p->y(t) * gtT * gtT);
+
+    Array result(y.size());
+    for (Size j = 0; j < y.size(); j++)
+        result[j] = c * exp(-(y[j] * stdDev + mean) * gtT);
+    return result;
+}
+
+const Disposable<Array>
+Gsr::numeraireArrayImpl(const Time t, const Array &y,
+                        const Handle<YieldTermStructure> &yts) const {
+
+    calculate();
+
+    boost::shared_ptr<GsrProcess> p =
+        boost::dynamic_pointer_cast<GsrProcess>(stateProcess_);
+
+    if (t == 0) {
+        Array result(y.size(),
+                     yts.empty() ? this->termStructure()->discount(
+                                       p->getForwardMeasureTime(), true)
+                                 : yts->discount(p->getForwardMeasureTime()));
+        return result;
+    }
+    return zerobond(p->getForwardMeasureTime(), t, y, yts);
+}
 }
@@ -139,6 +139,14 @@ class Gsr : public Gaussian1dModel, public CalibratedModel {
     Real zerobondImpl(const Time T, const Time t, const Real y,
                       const Handle<YieldTermStructure> &yts) const;
 
+    const Disposable<Array>
+    numeraireArrayImpl(const Time t, const Array &y,
+                       const Handle<YieldTermStructure> &yts) const;
+
+    const Disposable<Array>
+    zerobondArrayImpl(const Time T, const Time t, const Array &y,
+                      const Handle<YieldTermStructure> &yts) const;
+
     void generateArguments() {
         boost::static_pointer_cast<GsrProcess>(stateProcess_)->flushCache();
         notifyObservers();
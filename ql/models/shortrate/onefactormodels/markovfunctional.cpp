@@ -27,6 +27,7 @@
 #include <ql/termstructures/volatility/kahalesmilesection.hpp>
 #include <ql/termstructures/volatility/atmadjustedsmilesection.hpp>
 #include <ql/termstructures/volatility/atmsmilesection.hpp>
+#include <functional>
 
 namespace QuantLib {
 
@@ -443,6 +444,66 @@ namespace QuantLib {
                     modelSettings_.digitalGap_);
             ++pointIndex;
         }
+
+        updateDigitalTables();
+    }
+
+    void MarkovFunctional::updateDigitalTables() const {
+
+        std::vector<CalibrationPoint *> points;
+        for (std::map<Date, CalibrationPoint>::iterator i =
+                 calibrationPoints_.begin();
+             i != calibrationPoints_.end(); ++i) {
+            i->second.digitalTableRates_.clear();
+            i->second.digitalTablePrices_.clear();
+            points.push_back(&i->second);
+        }
+
+        if ((modelSettings_.adjustments_ & ModelSettings::TabulateDigitals) ==
+            0)
+            return;
+
+        QL_MFMESSAGE(modelOutputs_, "updating digital tables");
+
+        // LazyObject::calculate() is not accessible from here, so the
+        // smile sections (and the lazy sections they may wrap) are
+        // evaluated through their public interface; this way no lazy
+        // calculation is triggered in the parallel loop below
+        for (Size i = 0; i < points.size(); i++)
+            points[i]->smileSection_->volatility(points[i]->atm_);
+
+        // the grid is denser at the lower end, where the relevant
+        // rates are usually located
+        const Size n = 200;
+
+#pragma omp parallel for
+        for (Size i = 0; i < points.size(); i++) {
+            CalibrationPoint &p = *points[i];
+            const Real a = modelSettings_.lowerRateBound_ -
+                           p.smileSection_->shift();
+            const Real b = modelSettings_.upperRateBound_;
+            std::vector<Real> rates(n + 1), prices(n + 1);
+            bool monotonic = true;
+            for (Size k = 0; k <= n && monotonic; k++) {
+                const Real u = static_cast<Real>(k) / n;
+                rates[k] = a + (b - a) * u * u * u;
+                try {
+                    prices[k] = p.smileSection_->digitalOptionPrice(
+                        rates[k], Option::Call, p.annuity_,
+                        modelSettings_.digitalGap_);
+                } catch (Error &) {
+                    // the smile section can not price this digital
+                    monotonic = false;
+                }
+                if (k > 0 && prices[k] > prices[k - 1])
+                    monotonic = false;
+            }
+            // no table, the swap rates are searched on the whole range
+            if (!monotonic)
+                continue;
+            p.digitalTableRates_.swap(rates);
+            p.digitalTablePrices_.swap(prices);
+        }
     }
 
     void MarkovFunctional::updateNumeraireTabulation() const {
@@ -550,14 +611,14 @@ namespace QuantLib {
 
                     if (digital >= i->second.minRateDigital_)
                         swapRate = modelSettings_.lowerRateBound_ -
-                                   i->second.rawSmileSection_->shift();
+                                   i->second.smileSection_->shift();
                     else {
                         if (digital <= i->second.maxRateDigital_)
                             swapRate = modelSettings_.upperRateBound_;
                         else {
                             swapRate = marketSwapRate(
                                 i->first, i->second, digital, swapRate0,
-                                i->second.rawSmileSection_->shift());
+                                i->second.smileSection_->shift());
                             if (j < (int)y_.size() - 1 &&
                                 swapRate > swapRate0) {
                                 QL_MFMESSAGE(
@@ -765,15 +826,21 @@ namespace QuantLib {
         Real stdDev_0_T = stateProcess_->stdDeviation(0.0, 0.0, T);
         Real stdDev_t_T = stateProcess_->stdDeviation(t, 0.0, T - t);
 
+        // the numeraire at T is looked up once for all
+        // integration points of all states
+        const Size n = modelSettings_.gaussHermitePoints_;
+        Array ya(y.size() * n);
         for (Size j = 0; j < y.size(); j++) {
-            Array ya(modelSettings_.gaussHermitePoints_);
-            for (Size i = 0; i < modelSettings_.gaussHermitePoints_; i++) {
-                ya[i] = (y[j] * stdDev_0_t + stdDev_t_T * normalIntegralX_[i]) /
-                        stdDev_0_T;
+            for (Size i = 0; i < n; i++) {
+                ya[j * n + i] =
+                    (y[j] * stdDev_0_t + stdDev_t_T * normalIntegralX_[i]) /
+                    stdDev_0_T;
             }
-            Array res = numeraireArray(T, ya);
-            for (Size i = 0; i < modelSettings_.gaussHermitePoints_; i++) {
-                result[j] += normalIntegralW_[i] / res[i];
+        }
+        Array res = numeraireArray(T, ya);
+        for (Size j = 0; j < y.size(); j++) {
+            for (Size i = 0; i < n; i++) {
+                result[j] += normalIntegralW_[i] / res[j * n + i];
             }
         }
 
@@ -811,6 +878,45 @@ namespace QuantLib {
                                      termStructure()->discount(T)));
     }
 
+    const Disposable<Array> MarkovFunctional::numeraireArrayImpl(
+        const Time t, const Array &y,
+        const Handle<YieldTermStructure> &yts) const {
+
+        if (t == 0) {
+            Array result(y.size(),
+                         yts.empty() ? this->termStructure()->discount(
+                                           numeraireTime(), true)
+                                     : yts->discount(numeraireTime()));
+            return result;
+        }
+
+        Array result = numeraireArray(t, y);
+        if (!yts.empty())
+            result *= yts->discount(numeraireTime()) / yts->discount(t) *
+                      termStructure()->discount(t) /
+                      termStructure()->discount(numeraireTime());
+        return result;
+    }
+
+    const Disposable<Array> MarkovFunctional::zerobondArrayImpl(
+        const Time T, const Time t, const Array &y,
+        const Handle<YieldTermStructure> &yts) const {
+
+        if (t == 0.0) {
+            Array result(y.size(), yts.empty()
+                                       ? this->termStructure()->discount(T, true)
+                                       : yts->discount(T, true));
+            return result;
+        }
+
+        Array result = zerobondArray(T, t, y);
+        if (!yts.empty())
+            result *= yts->discount(T) / yts->discount(t) *
+                      termStructure()->discount(t) /
+                      termStructure()->discount(T);
+        return result;
+    }
+
     Real MarkovFunctional::deflatedZerobond(Time T, Time t,
                                             Real y) const {
 
@@ -826,6 +932,29 @@ namespace QuantLib {
 
         ZeroHelper z(this, expiry, p, digitalPrice);
         Brent b;
+
+        if (!p.digitalTablePrices_.empty()) {
+            // tables are only kept if their prices are non-increasing
+            // in the rate, look for the first one not greater than the
+            // given price
+            const std::vector<Real> &r = p.digitalTableRates_;
+            const std::vector<Real> &d = p.digitalTablePrices_;
+            Size k = std::lower_bound(d.begin(), d.end(), digitalPrice,
+                                      std::greater<Real>()) -
+                     d.begin();
+            if (k > 0 && k < d.size()) {
+                if (d[k] == digitalPrice)
+                    return r[k];
+                Real tableGuess = r[k - 1] + (r[k] - r[k - 1]) *
+                                                 (d[k - 1] - digitalPrice) /
+                                                 (d[k - 1] - d[k]);
+                return b.solve(z, modelSettings_.marketRateAccuracy_,
+                               tableGuess, r[k - 1], r[k]);
+            }
+            // otherwise the price is outside the table and we fall
+            // back to the search on the whole range
+        }
+
         Real solution = b.solve(
             z, modelSettings_.marketRateAccuracy_,
             std::max(std::min(guess, modelSettings_.upperRateBound_ - 0.00001),
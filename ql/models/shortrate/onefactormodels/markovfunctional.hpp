@@ -92,6 +92,17 @@ namespace QuantLib {
       When using a shifted lognormal smile input the lower rate bound is adjusted
       by the shift so that a lower bound of 0.0 always corresponds to the lower
       bound of the shifted distribution.
+
+      TabulateDigitals tabulates the market digital prices of each calibration
+      point on a fixed rate grid whenever the smiles are updated (in parallel
+      over the calibration points if OpenMP is enabled). The numeraire
+      tabulation, which is repeated in each step of a calibration of the model
+      volatilities, then solves for the market swap rates only within the
+      bracketing grid interval instead of the whole range between the lower
+      and upper rate bound. The results agree with the untabulated version up
+      to the market rate accuracy. A calibration point whose tabulated digital
+      prices are not monotonic (or can not be computed) is not tabulated and
+      searched on the whole range as before.
 */
 
     class MarkovFunctional : public Gaussian1dModel, public CalibratedModel {
@@ -110,7 +121,8 @@ namespace QuantLib {
                 SmileExponentialExtrapolation = 1 << 5,
                 KahaleInterpolation = 1 << 6,
                 SmileDeleteArbitragePoints = 1 << 7,
-                SabrSmile = 1 << 8
+                SabrSmile = 1 << 8,
+                TabulateDigitals = 1 << 9
             };
 
             ModelSettings()
@@ -229,6 +241,8 @@ namespace QuantLib {
             boost::shared_ptr<SmileSection> rawSmileSection_;
             Real minRateDigital_;
             Real maxRateDigital_;
+            std::vector<Real> digitalTableRates_;
+            std::vector<Real> digitalTablePrices_;
         };
 
 // utility macro to write messages to the model outputs
@@ -331,6 +345,14 @@ namespace QuantLib {
         Real zerobondImpl(const Time T, const Time t, const Real y,
                           const Handle<YieldTermStructure> &yts) const;
 
+        const Disposable<Array>
+        numeraireArrayImpl(const Time t, const Array &y,
+                           const Handle<YieldTermStructure> &yts) const;
+
+        const Disposable<Array>
+        zerobondArrayImpl(const Time T, const Time t, const Array &y,
+                          const Handle<YieldTermStructure> &yts) const;
+
         void generateArguments() {
             // if calculate triggers performCalculations, updateNumeraireTabulations
             // is called twice. If we can not check the lazy object status this seem
@@ -361,6 +383,7 @@ namespace QuantLib {
         void updateTimes2() const;
 
         void updateSmiles() const;
+        void updateDigitalTables() const;
         void updateNumeraireTabulation() const;
 
         void makeSwaptionCalibrationPoint(const Date &expiry,
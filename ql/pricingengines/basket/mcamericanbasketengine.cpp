@@ -37,7 +37,8 @@ namespace QuantLib {
       scalingValue_(1.0),
       v_           (LsmBasisSystem::multiPathBasisSystem(assetNumber_,
                                                          polynomOrder,
-                                                         polynomType)) {
+                                                         polynomType)),
+      basis_       (assetNumber_, polynomOrder, polynomType) {
         QL_REQUIRE(   polynomType == LsmBasisSystem::Monomial
                    || polynomType == LsmBasisSystem::Laguerre
                    || polynomType == LsmBasisSystem::Hermite
@@ -90,4 +91,13 @@ namespace QuantLib {
         return v_;
     }
 
+    void AmericanBasketPathPricer::basisValues(
+                        const Array& state,
+                        const std::vector<boost::function1<Real, Array> >&,
+                        Array& values) const {
+        // the polynomials first, then the payoff as in basisSystem()
+        basis_.values(state, values.begin());
+        values[basis_.size()] = payoff(state);
+    }
+
 }
@@ -104,6 +104,9 @@ namespace QuantLib {
         Real operator()(const MultiPath& path, Size t) const;
 
         std::vector<boost::function1<Real, Array> > basisSystem() const;
+        void basisValues(const Array& state,
+                         const std::vector<boost::function1<Real, Array> >&,
+                         Array& values) const;
 
       protected:
         Real payoff(const Array& state) const;
@@ -113,6 +116,7 @@ namespace QuantLib {
 
         Real scalingValue_;
         std::vector<boost::function1<Real, Array> > v_;
+        LsmMultiPathBasis basis_;
     };
 
     template <class RNG> inline
@@ -44,136 +44,173 @@ namespace QuantLib {
         QL_REQUIRE(!probability_.empty(),
                    "no probability term structure set");
 
+        MidPointCdsCalculator(arguments_, recoveryRate_, **discountCurve_,
+                              includeSettlementDateFlows_)
+            .calculate(**probability_, results_);
+    }
+
+
+    MidPointCdsCalculator::MidPointCdsCalculator(
+                           const CreditDefaultSwap::arguments& arguments,
+                           Real recoveryRate,
+                           const YieldTermStructure& discountCurve,
+                           boost::optional<bool> includeSettlementDateFlows)
+    : side_(arguments.side), notional_(arguments.notional),
+      spread_(arguments.spread), upfront_(arguments.upfront),
+      settlesAccrual_(arguments.settlesAccrual),
+      protectionStart_(arguments.protectionStart),
+      paysUpfront_(false), upfrontAmount_(0.0), upfrontDiscount_(0.0) {
+
         Date today = Settings::instance().evaluationDate();
-        Date settlementDate = discountCurve_->referenceDate();
+        Date settlementDate = discountCurve.referenceDate();
 
         // Upfront Flow NPV. Either we are on-the-run (no flow)
         // or we are forward start
-        Real upfPVO1 = 0.0;
-        if (!arguments_.upfrontPayment->hasOccurred(
+        upfrontAmount_ = arguments.upfrontPayment->amount();
+        if (!arguments.upfrontPayment->hasOccurred(
                                                settlementDate,
-                                               includeSettlementDateFlows_)) {
-            // date determining the probability survival so we have to pay
-            //   the upfront (did not knock out)
-            Date effectiveUpfrontDate =
-                arguments_.protectionStart > probability_->referenceDate() ?
-                    arguments_.protectionStart : probability_->referenceDate();
-            upfPVO1 =
-                probability_->survivalProbability(effectiveUpfrontDate) *
-                discountCurve_->discount(arguments_.upfrontPayment->date());
+                                               includeSettlementDateFlows)) {
+            paysUpfront_ = true;
+            upfrontDiscount_ =
+                discountCurve.discount(arguments.upfrontPayment->date());
         }
-        results_.upfrontNPV = upfPVO1 * arguments_.upfrontPayment->amount();
 
-        results_.couponLegNPV  = 0.0;
-        results_.defaultLegNPV = 0.0;
-        for (Size i=0; i<arguments_.leg.size(); ++i) {
-            if (arguments_.leg[i]->hasOccurred(settlementDate,
-                                               includeSettlementDateFlows_))
+        const Size n = arguments.leg.size();
+        paymentDates_.reserve(n);
+        startDates_.reserve(n);
+        endDates_.reserve(n);
+        amounts_.reserve(n);
+        accruals_.reserve(n);
+        claims_.reserve(n);
+        paymentDiscounts_.reserve(n);
+        defaultDiscounts_.reserve(n);
+        for (Size i=0; i<n; ++i) {
+            if (arguments.leg[i]->hasOccurred(settlementDate,
+                                              includeSettlementDateFlows))
                 continue;
 
             boost::shared_ptr<FixedRateCoupon> coupon =
-                boost::dynamic_pointer_cast<FixedRateCoupon>(arguments_.leg[i]);
-
-            // In order to avoid a few switches, we calculate the NPV
-            // of both legs as a positive quantity. We'll give them
-            // the right sign at the end.
+                boost::dynamic_pointer_cast<FixedRateCoupon>(arguments.leg[i]);
+            QL_REQUIRE(coupon, "fixed-rate coupon required");
 
             Date paymentDate = coupon->date(),
                  startDate = coupon->accrualStartDate(),
                  endDate = coupon->accrualEndDate();
             // this is the only point where it might not coincide
             if (i==0)
-                startDate = arguments_.protectionStart;
+                startDate = arguments.protectionStart;
             Date effectiveStartDate =
                 (startDate <= today && today <= endDate) ? today : startDate;
             Date defaultDate = // mid-point
                 effectiveStartDate + (endDate-effectiveStartDate)/2;
 
-            Probability S = probability_->survivalProbability(paymentDate);
-            Probability P = probability_->defaultProbability(
-                                                effectiveStartDate,
-                                                endDate);
+            paymentDates_.push_back(paymentDate);
+            startDates_.push_back(effectiveStartDate);
+            endDates_.push_back(endDate);
+            amounts_.push_back(coupon->amount());
+            paymentDiscounts_.push_back(discountCurve.discount(paymentDate));
+            claims_.push_back(arguments.claim->amount(defaultDate,
+                                                      arguments.notional,
+                                                      recoveryRate));
+            if (arguments.paysAtDefaultTime) {
+                accruals_.push_back(coupon->accruedAmount(defaultDate));
+                defaultDiscounts_.push_back(
+                                        discountCurve.discount(defaultDate));
+            } else {
+                // pays at the end
+                accruals_.push_back(amounts_.back());
+                defaultDiscounts_.push_back(paymentDiscounts_.back());
+            }
+        }
+    }
+
+    void MidPointCdsCalculator::calculate(
+                           const DefaultProbabilityTermStructure& probability,
+                           CreditDefaultSwap::results& results) const {
+
+        Real upfPVO1 = 0.0;
+        if (paysUpfront_) {
+            // date determining the probability survival so we have to pay
+            //   the upfront (did not knock out)
+            Date effectiveUpfrontDate =
+                protectionStart_ > probability.referenceDate() ?
+                    protectionStart_ : probability.referenceDate();
+            upfPVO1 =
+                probability.survivalProbability(effectiveUpfrontDate) *
+                upfrontDiscount_;
+        }
+        results.upfrontNPV = upfPVO1 * upfrontAmount_;
+
+        // In order to avoid a few switches, we calculate the NPV
+        // of both legs as a positive quantity. We'll give them
+        // the right sign at the end.
+        results.couponLegNPV  = 0.0;
+        results.defaultLegNPV = 0.0;
+        for (Size i=0; i<paymentDates_.size(); ++i) {
+            Probability S = probability.survivalProbability(paymentDates_[i]);
+            Probability P = probability.defaultProbability(startDates_[i],
+                                                           endDates_[i]);
 
             // on one side, we add the fixed rate payments in case of
             // survival...
-            results_.couponLegNPV +=
-                S * coupon->amount() *
-                discountCurve_->discount(paymentDate);
+            results.couponLegNPV += S * amounts_[i] * paymentDiscounts_[i];
             // ...possibly including accrual in case of default.
-            if (arguments_.settlesAccrual) {
-                if (arguments_.paysAtDefaultTime) {
-                    results_.couponLegNPV +=
-                        P * coupon->accruedAmount(defaultDate) *
-                        discountCurve_->discount(defaultDate);
-                } else {
-                    // pays at the end
-                    results_.couponLegNPV +=
-                        P * coupon->amount() *
-                        discountCurve_->discount(paymentDate);
-                }
-            }
+            if (settlesAccrual_)
+                results.couponLegNPV +=
+                    P * accruals_[i] * defaultDiscounts_[i];
 
             // on the other side, we add the payment in case of default.
-            Real claim = arguments_.claim->amount(defaultDate,
-                                                  arguments_.notional,
-                                                  recoveryRate_);
-            if (arguments_.paysAtDefaultTime) {
-                results_.defaultLegNPV +=
-                    P * claim * discountCurve_->discount(defaultDate);
-            } else {
-                results_.defaultLegNPV +=
-                    P * claim * discountCurve_->discount(paymentDate);
-            }
+            results.defaultLegNPV += P * claims_[i] * defaultDiscounts_[i];
         }
 
         Real upfrontSign = 1.0;
-        switch (arguments_.side) {
+        switch (side_) {
           case Protection::Seller:
-            results_.defaultLegNPV *= -1.0;
+            results.defaultLegNPV *= -1.0;
             break;
           case Protection::Buyer:
-            results_.couponLegNPV *= -1.0;
-            results_.upfrontNPV   *= -1.0;
+            results.couponLegNPV *= -1.0;
+            results.upfrontNPV   *= -1.0;
             upfrontSign = -1.0;
             break;
           default:
             QL_FAIL("unknown protection side");
         }
 
-        results_.value =
-            results_.defaultLegNPV+results_.couponLegNPV+results_.upfrontNPV;
-        results_.errorEstimate = Null<Real>();
+        results.value =
+            results.defaultLegNPV+results.couponLegNPV+results.upfrontNPV;
+        results.errorEstimate = Null<Real>();
 
-        if (results_.couponLegNPV != 0.0) {
-            results_.fairSpread =
-                -results_.defaultLegNPV*arguments_.spread/results_.couponLegNPV;
+        if (results.couponLegNPV != 0.0) {
+            results.fairSpread =
+                -results.defaultLegNPV*spread_/results.couponLegNPV;
         } else {
-            results_.fairSpread = Null<Rate>();
+            results.fairSpread = Null<Rate>();
         }
 
-        Real upfrontSensitivity = upfPVO1 * arguments_.notional;
+        Real upfrontSensitivity = upfPVO1 * notional_;
         if (upfrontSensitivity != 0.0) {
-            results_.fairUpfront =
-                -upfrontSign*(results_.defaultLegNPV + results_.couponLegNPV)
+            results.fairUpfront =
+                -upfrontSign*(results.defaultLegNPV + results.couponLegNPV)
                 / upfrontSensitivity;
         } else {
-            results_.fairUpfront = Null<Rate>();
+            results.fairUpfront = Null<Rate>();
         }
 
         static const Rate basisPoint = 1.0e-4;
 
-        if (arguments_.spread != 0.0) {
-            results_.couponLegBPS =
-                results_.couponLegNPV*basisPoint/arguments_.spread;
+        if (spread_ != 0.0) {
+            results.couponLegBPS =
+                results.couponLegNPV*basisPoint/spread_;
         } else {
-            results_.couponLegBPS = Null<Rate>();
+            results.couponLegBPS = Null<Rate>();
         }
 
-        if (arguments_.upfront && *arguments_.upfront != 0.0) {
-            results_.upfrontBPS =
-                results_.upfrontNPV*basisPoint/(*arguments_.upfront);
+        if (upfront_ && *upfront_ != 0.0) {
+            results.upfrontBPS =
+                results.upfrontNPV*basisPoint/(*upfront_);
         } else {
-            results_.upfrontBPS = Null<Rate>();
+            results.upfrontBPS = Null<Rate>();
         }
     }
 
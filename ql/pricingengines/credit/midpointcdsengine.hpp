@@ -27,9 +27,49 @@
 #define quantlib_mid_point_cds_engine_hpp
 
 #include <ql/instruments/creditdefaultswap.hpp>
+#include <vector>
 
 namespace QuantLib {
 
+    //! Mid-point calculator for credit default swaps
+    /*! Everything in the mid-point formulas that doesn't depend on
+        the default-probability curve, i.e., the amounts, accruals and
+        claims of the coupons still to be paid and the discount
+        factors at the payment and default dates, is computed once at
+        construction; the swap can then be repriced cheaply on any
+        number of probability curves, as in the bootstrap of a default
+        curve.  The results are the same as those of the
+        MidPointCdsEngine, which uses this class.
+
+        The calculator doesn't change after construction; different
+        threads can use it on different probability curves.
+    */
+    class MidPointCdsCalculator {
+      public:
+        MidPointCdsCalculator(
+              const CreditDefaultSwap::arguments& arguments,
+              Real recoveryRate,
+              const YieldTermStructure& discountCurve,
+              boost::optional<bool> includeSettlementDateFlows = boost::none);
+        void calculate(const DefaultProbabilityTermStructure& probability,
+                       CreditDefaultSwap::results& results) const;
+      private:
+        Protection::Side side_;
+        Real notional_;
+        Rate spread_;
+        boost::optional<Rate> upfront_;
+        bool settlesAccrual_;
+        Date protectionStart_;
+        // upfront payment, if still to be paid
+        bool paysUpfront_;
+        Real upfrontAmount_;
+        DiscountFactor upfrontDiscount_;
+        // coupons still to be paid
+        std::vector<Date> paymentDates_, startDates_, endDates_;
+        std::vector<Real> amounts_, accruals_, claims_;
+        std::vector<DiscountFactor> paymentDiscounts_, defaultDiscounts_;
+    };
+
     class MidPointCdsEngine : public CreditDefaultSwap::engine {
       public:
         MidPointCdsEngine(
@@ -198,8 +198,101 @@ namespace QuantLib {
                                  arguments_.floatingResetDates.end(), expiry0 - 1) -
                 arguments_.floatingResetDates.begin();
 
-            // todo add openmp support later on (as in gaussian1dswaptionengine)
+            // the exercise values are computed on the whole grid at once
+            // using the array versions of the model methods, so that
+            // quantities depending on the times only are evaluated once
+            // per cashflow instead of once per cashflow and grid point
+            Array exerciseValue, numeraire;
+            Real discount0 = 0.0;
+            if (expiry0 > settlement) {
+                Array floatingLegNpv(z.size(), 0.0), fixedLegNpv(z.size(), 0.0);
+                for (Size l = k1; l < arguments_.floatingCoupons.size(); l++) {
+                    Real zSpreadDf =
+                        oas_.empty()
+                            ? 1.0
+                            : std::exp(
+                                  -oas_->value() *
+                                  (model_->termStructure()
+                                       ->dayCounter()
+                                       .yearFraction(
+                                            expiry0,
+                                            arguments_.floatingPayDates[l])));
+                    Array amount;
+                    if (arguments_.floatingIsRedemptionFlow[l])
+                        amount = Array(z.size(), arguments_.floatingCoupons[l]);
+                    else
+                        amount = arguments_.floatingNominal[l] *
+                                 arguments_.floatingAccrualTimes[l] *
+                                 (arguments_.floatingGearings[l] *
+                                      model_->forwardRate(
+                                          arguments_.floatingFixingDates[l],
+                                          expiry0, z,
+                                          arguments_.swap->iborIndex()) +
+                                  arguments_.floatingSpreads[l]);
+                    Array discount =
+                        model_->zerobond(arguments_.floatingPayDates[l],
+                                         expiry0, z, discountCurve_);
+                    for (Size k = 0; k < z.size(); k++)
+                        floatingLegNpv[k] +=
+                            amount[k] * discount[k] * zSpreadDf;
+                }
+                for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
+                    Real zSpreadDf =
+                        oas_.empty()
+                            ? 1.0
+                            : std::exp(-oas_->value() *
+                                       (model_->termStructure()
+                                            ->dayCounter()
+                                            .yearFraction(
+                                                 expiry0,
+                                                 arguments_.fixedPayDates[l])));
+                    Array discount =
+                        model_->zerobond(arguments_.fixedPayDates[l],
+                                         expiry0, z, discountCurve_);
+                    for (Size k = 0; k < z.size(); k++)
+                        fixedLegNpv[k] += arguments_.fixedCoupons[l] *
+                                          discount[k] * zSpreadDf;
+                }
+                Real rebate = 0.0;
+                Real zSpreadDf = 1.0;
+                Date rebateDate = expiry0;
+                if (rebatedExercise != NULL) {
+                    rebate = rebatedExercise->rebate(idx);
+                    rebateDate = rebatedExercise->rebatePaymentDate(idx);
+                    zSpreadDf =
+                        oas_.empty()
+                            ? 1.0
+                            : std::exp(
+                                  -oas_->value() *
+                                  (model_->termStructure()
+                                       ->dayCounter()
+                                       .yearFraction(expiry0, rebateDate)));
+                }
+                numeraire = model_->numeraire(expiry0Time, z, discountCurve_);
+                exerciseValue =
+                    ((type == Option::Call ? 1.0 : -1.0) *
+                         (floatingLegNpv - fixedLegNpv) +
+                     rebate * zSpreadDf *
+                         model_->zerobond(rebateDate, expiry0, z,
+                                          discountCurve_)) /
+                    numeraire;
+                discount0 = model_->zerobond(expiry0Time, 0.0, 0.0,
+                                             discountCurve_);
+            }
 
+            // a lazy object is not thread safe, neither is the caching
+            // in gsrprocess. therefore we trigger computations here such
+            // that neither lazy object recalculation nor write access
+            // during caching occurs in the parallized loop below.
+            // this is known to work for the gsr and markov functional
+            // model implementations of Gaussian1dModel
+#ifdef _OPENMP
+            if (expiry1Time != Null<Real>())
+                model_->yGrid(stddevs_, integrationPoints_, expiry1Time,
+                              expiry0Time, 0.0);
+#endif
+
+#pragma omp parallel for default(shared) firstprivate(p) if(expiry0>settlement)
             for (Size k = 0; k < (expiry0 > settlement ? npv0.size() : 1);
                  k++) {
 
@@ -360,79 +453,6 @@ namespace QuantLib {
                 // end probability computation
 
                 if (expiry0 > settlement) {
-                    Real floatingLegNpv = 0.0;
-                    for (Size l = k1; l < arguments_.floatingCoupons.size();
-                         l++) {
-                        Real zSpreadDf =
-                            oas_.empty()
-                                ? 1.0
-                                : std::exp(
-                                      -oas_->value() *
-                                      (model_->termStructure()
-                                           ->dayCounter()
-                                           .yearFraction(
-                                                expiry0,
-                                                arguments_
-                                                    .floatingPayDates[l])));
-                        Real amount;
-                        if (arguments_.floatingIsRedemptionFlow[l])
-                            amount = arguments_.floatingCoupons[l];
-                        else
-                            amount = arguments_.floatingNominal[l] *
-                                     arguments_.floatingAccrualTimes[l] *
-                                     (arguments_.floatingGearings[l] *
-                                          model_->forwardRate(
-                                              arguments_.floatingFixingDates[l],
-                                              expiry0, z[k],
-                                              arguments_.swap->iborIndex()) +
-                                      arguments_.floatingSpreads[l]);
-                        floatingLegNpv +=
-                            amount *
-                            model_->zerobond(arguments_.floatingPayDates[l],
-                                             expiry0, z[k], discountCurve_) *
-                            zSpreadDf;
-                    }
-                    Real fixedLegNpv = 0.0;
-                    for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
-                        Real zSpreadDf =
-                            oas_.empty()
-                                ? 1.0
-                                : std::exp(
-                                      -oas_->value() *
-                                      (model_->termStructure()
-                                           ->dayCounter()
-                                           .yearFraction(
-                                                expiry0,
-                                                arguments_.fixedPayDates[l])));
-                        fixedLegNpv +=
-                            arguments_.fixedCoupons[l] *
-                            model_->zerobond(arguments_.fixedPayDates[l],
-                                             expiry0, z[k], discountCurve_) *
-                            zSpreadDf;
-                    }
-                    Real rebate = 0.0;
-                    Real zSpreadDf = 1.0;
-                    Date rebateDate = expiry0;
-                    if (rebatedExercise != NULL) {
-                        rebate = rebatedExercise->rebate(idx);
-                        rebateDate = rebatedExercise->rebatePaymentDate(idx);
-                        zSpreadDf =
-                            oas_.empty()
-                                ? 1.0
-                                : std::exp(
-                                      -oas_->value() *
-                                      (model_->termStructure()
-                                           ->dayCounter()
-                                           .yearFraction(expiry0, rebateDate)));
-                    }
-                    Real exerciseValue =
-                        ((type == Option::Call ? 1.0 : -1.0) *
-                             (floatingLegNpv - fixedLegNpv) +
-                         rebate * model_->zerobond(rebateDate, expiry0, z[k],
-                                                   discountCurve_) *
-                             zSpreadDf) /
-                        model_->numeraire(expiry0Time, z[k], discountCurve_);
-
                     // for probability computation
                     if (probabilities_ != None) {
                         if (idx == static_cast<int>(
@@ -443,21 +463,12 @@ namespace QuantLib {
                             npvp0.back()[k] =
                                 probabilities_ == Naive
                                     ? 1.0
-                                    : 1.0 / (model_->zerobond(expiry0Time, 0.0,
-                                                              0.0,
-                                                              discountCurve_) *
-                                             model_->numeraire(expiry0, z[k],
-                                                               discountCurve_));
-                        if (exerciseValue >= npv0[k]) {
+                                    : 1.0 / (discount0 * numeraire[k]);
+                        if (exerciseValue[k] >= npv0[k]) {
                             npvp0[idx - minIdxAlive][k] =
                                 probabilities_ == Naive
                                     ? 1.0
-                                    : 1.0 /
-                                          (model_->zerobond(expiry0Time, 0.0,
-                                                            0.0,
-                                                            discountCurve_) *
-                                           model_->numeraire(expiry0Time, z[k],
-                                                             discountCurve_));
+                                    : 1.0 / (discount0 * numeraire[k]);
                             for (Size ii = idx - minIdxAlive + 1;
                                  ii < npvp0.size(); ii++)
                                 npvp0[ii][k] = 0.0;
@@ -465,7 +476,7 @@ namespace QuantLib {
                     }
                     // end probability computation
 
-                    npv0[k] = std::max(npv0[k], exerciseValue);
+                    npv0[k] = std::max(npv0[k], exerciseValue[k]);
                 }
             }
 
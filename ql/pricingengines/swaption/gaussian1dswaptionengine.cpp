@@ -88,6 +88,43 @@ namespace QuantLib {
                                  floatSchedule.dates().end(), expiry0 - 1) -
                 floatSchedule.dates().begin();
 
+            // the exercise values are computed on the whole grid at once
+            // using the array versions of the model methods, so that
+            // quantities depending on the times only are evaluated once
+            // per cashflow instead of once per cashflow and grid point
+            Array exerciseValue, numeraire;
+            Real discount0 = 0.0;
+            if (expiry0 > settlement) {
+                Array floatingLegNpv(z.size(), 0.0), fixedLegNpv(z.size(), 0.0);
+                for (Size l = k1; l < arguments_.floatingCoupons.size(); l++) {
+                    Array forward = model_->forwardRate(
+                        arguments_.floatingFixingDates[l], expiry0, z,
+                        arguments_.swap->iborIndex());
+                    Array discount =
+                        model_->zerobond(arguments_.floatingPayDates[l],
+                                         expiry0, z, discountCurve_);
+                    for (Size k = 0; k < z.size(); k++)
+                        floatingLegNpv[k] +=
+                            arguments_.nominal *
+                            arguments_.floatingAccrualTimes[l] *
+                            (arguments_.floatingSpreads[l] + forward[k]) *
+                            discount[k];
+                }
+                for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
+                    Array discount =
+                        model_->zerobond(arguments_.fixedPayDates[l],
+                                         expiry0, z, discountCurve_);
+                    for (Size k = 0; k < z.size(); k++)
+                        fixedLegNpv[k] +=
+                            arguments_.fixedCoupons[l] * discount[k];
+                }
+                numeraire = model_->numeraire(expiry0Time, z, discountCurve_);
+                exerciseValue = (type == Option::Call ? 1.0 : -1.0) *
+                                (floatingLegNpv - fixedLegNpv) / numeraire;
+                discount0 = model_->zerobond(expiry0Time, 0.0, 0.0,
+                                             discountCurve_);
+            }
+
             // a lazy object is not thread safe, neither is the caching
             // in gsrprocess. therefore we trigger computations here such
             // that neither lazy object recalculation nor write access
@@ -98,20 +135,6 @@ namespace QuantLib {
             if (expiry1Time != Null<Real>())
                 model_->yGrid(stddevs_, integrationPoints_, expiry1Time,
                               expiry0Time, 0.0);
-            if (expiry0 > settlement) {
-                for (Size l = k1; l < arguments_.floatingCoupons.size(); l++) {
-                    model_->forwardRate(arguments_.floatingFixingDates[l],
-                                        expiry0, 0.0,
-                                        arguments_.swap->iborIndex());
-                    model_->zerobond(arguments_.floatingPayDates[l], expiry0,
-                                     0.0, discountCurve_);
-                }
-                for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
-                    model_->zerobond(arguments_.fixedPayDates[l], expiry0, 0.0,
-                                     discountCurve_);
-                }
-                model_->numeraire(expiry0Time, 0.0, discountCurve_);
-            }
 #endif
 
 #pragma omp parallel for default(shared) firstprivate(p) if(expiry0>settlement)
@@ -253,31 +276,6 @@ namespace QuantLib {
                 // end probability computation
 
                 if (expiry0 > settlement) {
-                    Real floatingLegNpv = 0.0;
-                    for (Size l = k1; l < arguments_.floatingCoupons.size();
-                         l++) {
-                        floatingLegNpv +=
-                            arguments_.nominal *
-                            arguments_.floatingAccrualTimes[l] *
-                            (arguments_.floatingSpreads[l] +
-                             model_->forwardRate(
-                                 arguments_.floatingFixingDates[l], expiry0,
-                                 z[k], arguments_.swap->iborIndex())) *
-                            model_->zerobond(arguments_.floatingPayDates[l],
-                                             expiry0, z[k], discountCurve_);
-                    }
-                    Real fixedLegNpv = 0.0;
-                    for (Size l = j1; l < arguments_.fixedCoupons.size(); l++) {
-                        fixedLegNpv +=
-                            arguments_.fixedCoupons[l] *
-                            model_->zerobond(arguments_.fixedPayDates[l],
-                                             expiry0, z[k], discountCurve_);
-                    }
-                    Real exerciseValue =
-                        (type == Option::Call ? 1.0 : -1.0) *
-                        (floatingLegNpv - fixedLegNpv) /
-                        model_->numeraire(expiry0Time, z[k], discountCurve_);
-
                     // for probability computation
                     if (probabilities_ != None) {
                         if (idx == static_cast<int>(
@@ -288,21 +286,12 @@ namespace QuantLib {
                             npvp0.back()[k] =
                                 probabilities_ == Naive
                                     ? 1.0
-                                    : 1.0 / (model_->zerobond(expiry0Time, 0.0,
-                                                              0.0,
-                                                              discountCurve_) *
-                                             model_->numeraire(expiry0, z[k],
-                                                               discountCurve_));
-                        if (exerciseValue >= npv0[k]) {
+                                    : 1.0 / (discount0 * numeraire[k]);
+                        if (exerciseValue[k] >= npv0[k]) {
                             npvp0[idx - minIdxAlive][k] =
                                 probabilities_ == Naive
                                     ? 1.0
-                                    : 1.0 /
-                                          (model_->zerobond(expiry0Time, 0.0,
-                                                            0.0,
-                                                            discountCurve_) *
-                                           model_->numeraire(expiry0Time, z[k],
-                                                             discountCurve_));
+                                    : 1.0 / (discount0 * numeraire[k]);
                             for (Size ii = idx - minIdxAlive + 1;
                                  ii < npvp0.size(); ii++)
                                 npvp0[ii][k] = 0.0;
@@ -310,7 +299,7 @@ namespace QuantLib {
                     }
                     // end probability computation
 
-                    npv0[k] = std::max(npv0[k], exerciseValue);
+                    npv0[k] = std::max(npv0[k], exerciseValue[k]);
                 }
             }
 
@@ -36,6 +36,7 @@
 #include <ql/pricingengines/vanilla/fdstepconditionengine.hpp>
 #include <ql/pricingengines/vanilla/fdvanillaengine.hpp>
 #include <ql/pricingengines/vanilla/fdconditions.hpp>
+#include <ql/pricingengines/vanilla/fourierengine.hpp>
 #include <ql/pricingengines/vanilla/mcamericanengine.hpp>
 #include <ql/pricingengines/vanilla/mcdigitalengine.hpp>
 #include <ql/pricingengines/vanilla/mceuropeanengine.hpp>
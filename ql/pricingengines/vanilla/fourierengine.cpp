@@ -0,0 +1,193 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/pricingengines/vanilla/fourierengine.hpp>
+#include <ql/math/interpolations/cubicinterpolation.hpp>
+#include <ql/exercise.hpp>
+
+namespace QuantLib {
+
+    FourierEngine::FourierEngine(
+                const boost::shared_ptr<CharacteristicFunctionModel>& model)
+    : GenericModelEngine<CharacteristicFunctionModel,
+                         VanillaOption::arguments,
+                         VanillaOption::results>(model) {}
+
+    void FourierEngine::calculate() const {
+        QL_REQUIRE(arguments_.exercise->type() == Exercise::European,
+                   "not an European option");
+
+        boost::shared_ptr<PlainVanillaPayoff> payoff =
+            boost::dynamic_pointer_cast<PlainVanillaPayoff>(arguments_.payoff);
+        QL_REQUIRE(payoff, "non plain vanilla payoff given");
+
+        results_.value = values(payoff->optionType(),
+                                std::vector<Real>(1, payoff->strike()),
+                                arguments_.exercise->lastDate())[0];
+    }
+
+    Disposable<Array> FourierEngine::values(Option::Type type,
+                                            const std::vector<Real>& strikes,
+                                            const Date& maturity) const {
+        const Handle<YieldTermStructure>& riskFreeRate =
+            model_->riskFreeRate();
+        const Time t = riskFreeRate->timeFromReference(maturity);
+        QL_REQUIRE(t > 0.0, "expired option");
+
+        const DiscountFactor df = riskFreeRate->discount(maturity);
+        const Real spot = model_->s0();
+        QL_REQUIRE(spot > 0.0, "negative or null underlying given");
+        const Real forward =
+            spot*model_->dividendYield()->discount(maturity)/df;
+
+        Array y(strikes.size());
+        for (Size i=0; i<strikes.size(); ++i) {
+            QL_REQUIRE(strikes[i] > 0.0,
+                       "strike (" << strikes[i] << ") must be positive");
+            y[i] = std::log(strikes[i]/forward);
+        }
+
+        Array v = normalizedCallValues(y, t);
+        for (Size i=0; i<v.size(); ++i) {
+            switch (type) {
+              case Option::Call:
+                break;
+              case Option::Put:
+                v[i] -= 1.0 - std::exp(y[i]);
+                break;
+              default:
+                QL_FAIL("unknown option type");
+            }
+            v[i] *= df*forward;
+        }
+        return v;
+    }
+
+
+    COSEngine::COSEngine(
+                const boost::shared_ptr<CharacteristicFunctionModel>& model,
+                Size n, Real truncation)
+    : FourierEngine(model), n_(n), truncation_(truncation) {
+        QL_REQUIRE(n_ > 1, "at least two terms required");
+        QL_REQUIRE(truncation_ > 0.0, "positive truncation range required");
+    }
+
+    Disposable<Array> COSEngine::normalizedCallValues(const Array& y,
+                                                      Time t) const {
+        // cumulants from finite differences of the cumulant-generating
+        // function K(s) = ln E[exp(s X)] = ln phi(-is)
+        const Real h = 0.01;
+        Real k[5];
+        for (Integer j=-2; j<=2; ++j)
+            k[j+2] = std::log(std::real(model_->characteristicFunction(
+                                      std::complex<Real>(0.0, -j*h), t)));
+        const Real c1 = (k[3] - k[1])/(2.0*h);
+        const Real c2 = (k[3] - 2.0*k[2] + k[1])/(h*h);
+        const Real c4 = (k[4] - 4.0*k[3] + 6.0*k[2] - 4.0*k[1] + k[0])
+                      / (h*h*h*h);
+        QL_REQUIRE(c2 > 0.0, "could not determine the truncation range");
+
+        const Real width =
+            truncation_*std::sqrt(c2 + std::sqrt(std::max(c4, 0.0)));
+        const Real a = c1 - width, b = c1 + width;
+
+        // Re[phi(w_j) exp(-i w_j a)], shared by all strikes
+        std::vector<Real> re(n_);
+        for (Size j=0; j<n_; ++j) {
+            const Real w = j*M_PI/(b - a);
+            re[j] = std::real(model_->characteristicFunction(w, t)
+                              * std::exp(std::complex<Real>(0.0, -w*a)));
+        }
+
+        Array v(y.size());
+        for (Size i=0; i<y.size(); ++i) {
+            // put payoff: 2/(b-a) int_a^d (e^y - e^x) cos(w_j(x-a)) dx
+            const Real d = std::min(y[i], b);
+            Real put = 0.0;
+            if (d > a) {
+                const Real ey = std::exp(y[i]), ea = std::exp(a);
+                const Real ed = std::exp(d);
+                const std::complex<Real> z =
+                    std::exp(std::complex<Real>(0.0, M_PI*(d-a)/(b-a)));
+                std::complex<Real> zj = 1.0;
+
+                put = 0.5*re[0]*(ey*(d - a) - (ed - ea));
+                for (Size j=1; j<n_; ++j) {
+                    zj *= z;
+                    const Real w = j*M_PI/(b - a);
+                    const Real c = zj.real(), s = zj.imag();
+                    const Real psi = s/w;
+                    const Real chi =
+                        (ed*(c + w*s) - ea)/(1.0 + w*w);
+                    put += re[j]*(ey*psi - chi);
+                }
+                put *= 2.0/(b - a);
+            }
+            v[i] = std::max(put, 0.0) + 1.0 - std::exp(y[i]);
+        }
+        return v;
+    }
+
+
+    CarrMadanFFTEngine::CarrMadanFFTEngine(
+                const boost::shared_ptr<CharacteristicFunctionModel>& model,
+                Size n, Real eta, Real alpha)
+    : FourierEngine(model), plan_(n), eta_(eta), alpha_(alpha) {
+        QL_REQUIRE(n > 1, "at least two grid points required");
+        QL_REQUIRE(eta_ > 0.0, "positive grid spacing required");
+        QL_REQUIRE(alpha_ > 0.0, "positive damping factor required");
+    }
+
+    Disposable<Array> CarrMadanFFTEngine::normalizedCallValues(
+                                              const Array& y, Time t) const {
+        const Size n = plan_.size();
+        const Real lambda = 2.0*M_PI/(n*eta_);
+        const Real b = 0.5*n*lambda;
+        const std::complex<Real> i1(0.0, 1.0);
+
+        std::vector<std::complex<Real> > in(n), out(n);
+        for (Size j=0; j<n; ++j) {
+            const Real v = eta_*j;
+            // Simpson weights
+            const Real sw =
+                eta_*(3.0 + ((j % 2) == 0 ? -1.0 : 1.0) - (j == 0 ? 1.0 : 0.0))
+                / 3.0;
+            const std::complex<Real> psi =
+                model_->characteristicFunction(v - (alpha_ + 1.0)*i1, t)
+                / (alpha_*alpha_ + alpha_ - v*v + i1*(2.0*alpha_ + 1.0)*v);
+            in[j] = std::exp(i1*b*v)*sw*psi;
+        }
+        plan_.execute(&in[0], &out[0], false);
+
+        std::vector<Real> k(n), c(n);
+        for (Size j=0; j<n; ++j) {
+            k[j] = -b + lambda*j;
+            c[j] = std::exp(-alpha_*k[j])/M_PI*out[j].real();
+        }
+        CubicNaturalSpline interpolation(k.begin(), k.end(), c.begin());
+
+        Array v(y.size());
+        for (Size i=0; i<y.size(); ++i) {
+            QL_REQUIRE(y[i] > -b && y[i] < b,
+                       "log-moneyness (" << y[i]
+                       << ") outside of the FFT grid");
+            v[i] = interpolation(y[i]);
+        }
+        return v;
+    }
+
+}
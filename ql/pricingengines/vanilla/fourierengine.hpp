@@ -0,0 +1,146 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file fourierengine.hpp
+    \brief Fourier engines for European options on whole strike slices
+*/
+
+#ifndef quantlib_fourier_engine_hpp
+#define quantlib_fourier_engine_hpp
+
+#include <ql/instruments/vanillaoption.hpp>
+#include <ql/pricingengines/genericmodelengine.hpp>
+#include <ql/models/equity/characteristicfunctionmodel.hpp>
+#include <ql/math/array.hpp>
+#include <ql/math/fftplan.hpp>
+
+namespace QuantLib {
+
+    //! base class for Fourier engines for European options
+    /*! The engine only needs the characteristic function of the
+        model; it works with any CharacteristicFunctionModel, e.g.,
+        HestonModel, the Bates models, PiecewiseTimeDependentHestonModel
+        and VarianceGammaModel.
+
+        Derived classes price a whole slice of strikes with the same
+        maturity at once: the characteristic function, which is the
+        expensive part, is evaluated once for all of them.  Calibration
+        routines and smile builders should call values() rather than
+        pricing options one by one through calculate().
+
+        \ingroup vanillaengines
+    */
+    class FourierEngine
+        : public GenericModelEngine<CharacteristicFunctionModel,
+                                    VanillaOption::arguments,
+                                    VanillaOption::results> {
+      public:
+        void calculate() const;
+        //! values of European options with the same type and maturity
+        Disposable<Array> values(Option::Type type,
+                                 const std::vector<Real>& strikes,
+                                 const Date& maturity) const;
+      protected:
+        FourierEngine(
+                const boost::shared_ptr<CharacteristicFunctionModel>& model);
+        /*! returns \f$ E[(e^{X_t} - e^{y})^+] \f$ for the given
+            log-moneyness values \f$ y = \ln(K/F_t) \f$, where
+            \f$ X_t \f$ is the log-forward moneyness whose
+            characteristic function is given by the model.
+        */
+        virtual Disposable<Array> normalizedCallValues(const Array& y,
+                                                       Time t) const = 0;
+    };
+
+
+    //! Fourier-cosine engine for European options
+    /*! The density of the log-forward moneyness is expanded on a
+        cosine series over a truncation range given by its cumulants,
+        which are obtained from the characteristic function.  The
+        coefficients of the payoff are known in closed form, so that,
+        once the characteristic function is evaluated at the given
+        number of points, each strike only costs a sum over them.
+        Puts are summed and calls are obtained by put-call parity,
+        which keeps the series well-conditioned.
+
+        References:
+        F. Fang and C.W. Oosterlee, A Novel Pricing Method for
+        European Options Based on Fourier-Cosine Series Expansions,
+        SIAM J. Sci. Comput. 31(2), 826-848 (2008).
+
+        \ingroup vanillaengines
+
+        \test the values are checked against the analytic engines for
+              the Heston, Bates, piecewise time-dependent Heston and
+              variance gamma models.
+    */
+    class COSEngine : public FourierEngine {
+      public:
+        /*! \param n          number of terms of the cosine series.
+            \param truncation width of the truncation range, in units
+                              of \f$ \sqrt{c_2 + \sqrt{c_4}} \f$ around
+                              the mean.
+        */
+        COSEngine(const boost::shared_ptr<CharacteristicFunctionModel>& model,
+                  Size n = 256, Real truncation = 12.0);
+      protected:
+        Disposable<Array> normalizedCallValues(const Array& y, Time t) const;
+      private:
+        Size n_;
+        Real truncation_;
+    };
+
+
+    //! Carr-Madan FFT engine for European options
+    /*! The damped call price is obtained on an equally spaced grid
+        of log-strikes by a single fast Fourier transform; the values
+        for the given strikes are interpolated on the grid with a
+        cubic spline.  The log-strike spacing of the grid is
+        \f$ 2\pi/(n\eta) \f$.
+
+        References:
+        P. Carr and D. B. Madan, Option Valuation using the fast
+        Fourier transform, Journal of Computational Finance, 2,
+        61-73 (1998).
+
+        \ingroup vanillaengines
+
+        \test the values are checked against the analytic engines for
+              the Heston, Bates, piecewise time-dependent Heston and
+              variance gamma models.
+    */
+    class CarrMadanFFTEngine : public FourierEngine {
+      public:
+        /*! \param n     number of grid points; any number is allowed,
+                         but those with no prime factors other than
+                         2, 3 and 5 give the fastest transforms.
+            \param eta   spacing of the integration grid.
+            \param alpha damping factor of the call price.
+        */
+        CarrMadanFFTEngine(
+                const boost::shared_ptr<CharacteristicFunctionModel>& model,
+                Size n = 4096, Real eta = 0.25, Real alpha = 1.5);
+      protected:
+        Disposable<Array> normalizedCallValues(const Array& y, Time t) const;
+      private:
+        FFTPlan plan_;
+        Real eta_, alpha_;
+    };
+
+}
+
+#endif
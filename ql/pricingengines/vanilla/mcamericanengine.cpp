@@ -38,7 +38,8 @@ namespace QuantLib {
     : scalingValue_(1.0),
       payoff_      (payoff),
       v_           (LsmBasisSystem::pathBasisSystem(polynomOrder,
-                                                    polynomType)) {
+                                                    polynomType)),
+      basis_       (polynomOrder, polynomType) {
 
         QL_REQUIRE(   polynomType == LsmBasisSystem::Monomial
                    || polynomType == LsmBasisSystem::Laguerre
@@ -78,4 +79,13 @@ namespace QuantLib {
         return v_;
     }
 
+    void AmericanPathPricer::basisValues(
+                         Real state,
+                         const std::vector<boost::function1<Real, Real> >&,
+                         Array& values) const {
+        // the polynomials first, then the payoff as in basisSystem()
+        basis_.values(state, values.begin());
+        values[basis_.size()] = payoff(state);
+    }
+
 }
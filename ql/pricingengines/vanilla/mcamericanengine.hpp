@@ -92,6 +92,9 @@ namespace QuantLib {
         Real operator()(const Path& path, Size t) const;
 
         std::vector<boost::function1<Real, Real> > basisSystem() const;
+        void basisValues(Real state,
+                         const std::vector<boost::function1<Real, Real> >&,
+                         Array& values) const;
 
       protected:
         Real payoff(Real state) const;
@@ -99,6 +102,7 @@ namespace QuantLib {
         Real scalingValue_;
         const boost::shared_ptr<Payoff> payoff_;
         std::vector<boost::function1<Real, Real> > v_;
+        LsmPathBasis basis_;
     };
 
 
@@ -47,6 +47,25 @@ namespace QuantLib {
         registerWith(blackVolatility_);
     }
 
+    GeneralizedBlackScholesProcess::GeneralizedBlackScholesProcess(
+             const Handle<Quote>& x0,
+             const Handle<YieldTermStructure>& dividendTS,
+             const Handle<YieldTermStructure>& riskFreeTS,
+             const Handle<BlackVolTermStructure>& blackVolTS,
+             const Handle<LocalVolTermStructure>& localVolTS,
+             const boost::shared_ptr<discretization>& disc)
+    : StochasticProcess1D(disc), x0_(x0), riskFreeRate_(riskFreeTS),
+      dividendYield_(dividendTS), blackVolatility_(blackVolTS),
+      externalLocalVolatility_(localVolTS), updated_(false) {
+        QL_REQUIRE(!externalLocalVolatility_.empty(),
+                   "empty local volatility handle given");
+        registerWith(x0_);
+        registerWith(riskFreeRate_);
+        registerWith(dividendYield_);
+        registerWith(blackVolatility_);
+        registerWith(externalLocalVolatility_);
+    }
+
     Real GeneralizedBlackScholesProcess::x0() const {
         return x0_->value();
     }
@@ -158,6 +177,11 @@ namespace QuantLib {
 
     const Handle<LocalVolTermStructure>&
     GeneralizedBlackScholesProcess::localVolatility() const {
+        if (!externalLocalVolatility_.empty()) {
+            isStrikeIndependent_ = false;
+            return externalLocalVolatility_;
+        }
+
         if (!updated_) {
             isStrikeIndependent_=true;
 
@@ -84,13 +84,31 @@ namespace QuantLib {
         probability_.linkTo(
             boost::shared_ptr<DefaultProbabilityTermStructure>(ts, no_deletion),
             false);
+    }
 
-        resetEngine();
+    const MidPointCdsCalculator& CdsHelper::calculator() const {
+        if (!calculator_) {
+            QL_REQUIRE(!discountCurve_.empty(),
+                       "no discount term structure set");
+            // the cash flows are selected as the engine would
+            SavedSettings backup;
+            if (includeSettlementDateFlows_)
+                Settings::instance().includeTodaysCashFlows() =
+                    *includeSettlementDateFlows_;
+            CreditDefaultSwap::arguments arguments;
+            swap_->setupArguments(&arguments);
+            calculator_ = boost::shared_ptr<MidPointCdsCalculator>(
+                     new MidPointCdsCalculator(arguments, recoveryRate_,
+                                               **discountCurve_,
+                                               includeSettlementDateFlows_));
+        }
+        return *calculator_;
     }
 
     void CdsHelper::update() {
         RelativeDateDefaultProbabilityHelper::update();
         resetEngine();
+        calculator_.reset();
     }
 
     void CdsHelper::initializeDates() {
@@ -130,7 +148,9 @@ namespace QuantLib {
     : CdsHelper(runningSpread, tenor, settlementDays, calendar,
                 frequency, paymentConvention, rule, dayCounter,
                 recoveryRate, discountCurve, settlesAccrual,
-                paysAtDefaultTime) {}
+                paysAtDefaultTime) {
+        resetEngine();
+    }
 
     SpreadCdsHelper::SpreadCdsHelper(
                               Rate runningSpread,
@@ -148,11 +168,17 @@ namespace QuantLib {
     : CdsHelper(runningSpread, tenor, settlementDays, calendar,
                 frequency, paymentConvention, rule, dayCounter,
                 recoveryRate, discountCurve, settlesAccrual,
-                paysAtDefaultTime) {}
+                paysAtDefaultTime) {
+        resetEngine();
+    }
 
     Real SpreadCdsHelper::impliedQuote() const {
-        swap_->recalculate();
-        return swap_->fairSpread();
+        QL_REQUIRE(termStructure_ != 0, "term structure not set");
+        CreditDefaultSwap::results results;
+        calculator().calculate(*termStructure_, results);
+        QL_REQUIRE(results.fairSpread != Null<Rate>(),
+                   "fair spread not available");
+        return results.fairSpread;
     }
 
     void SpreadCdsHelper::resetEngine() {
@@ -191,7 +217,9 @@ namespace QuantLib {
                 paysAtDefaultTime),
       upfrontSettlementDays_(upfrontSettlementDays),
       runningSpread_(runningSpread) {
+        includeSettlementDateFlows_ = true;
         initializeDates();
+        resetEngine();
     }
 
     UpfrontCdsHelper::UpfrontCdsHelper(
@@ -215,7 +243,9 @@ namespace QuantLib {
                 paysAtDefaultTime),
       upfrontSettlementDays_(upfrontSettlementDays),
       runningSpread_(runningSpread) {
+        includeSettlementDateFlows_ = true;
         initializeDates();
+        resetEngine();
     }
 
     void UpfrontCdsHelper::initializeDates() {
@@ -226,10 +256,12 @@ namespace QuantLib {
     }
 
     Real UpfrontCdsHelper::impliedQuote() const {
-        SavedSettings backup;
-        Settings::instance().includeTodaysCashFlows() = true;
-        swap_->recalculate();
-        return swap_->fairUpfront();
+        QL_REQUIRE(termStructure_ != 0, "term structure not set");
+        CreditDefaultSwap::results results;
+        calculator().calculate(*termStructure_, results);
+        QL_REQUIRE(results.fairUpfront != Null<Rate>(),
+                   "fair upfront not available");
+        return results.fairUpfront;
     }
 
     void UpfrontCdsHelper::resetEngine() {
@@ -35,6 +35,7 @@ namespace QuantLib {
 
     class YieldTermStructure;
     class CreditDefaultSwap;
+    class MidPointCdsCalculator;
 
     //! alias for default-probability bootstrap helpers
     typedef BootstrapHelper<DefaultProbabilityTermStructure>
@@ -50,6 +51,11 @@ namespace QuantLib {
         @param paymentConvention The payment convention applied to
                                  coupons schedules, settlement dates
                                  and protection period calculations.
+
+        The implied quote is obtained from a MidPointCdsCalculator,
+        which is built once and reused on every trial curve of the
+        bootstrap; it is rebuilt only when the helper is notified of
+        a change.
     */
     class CdsHelper : public RelativeDateDefaultProbabilityHelper {
       public:
@@ -78,6 +84,12 @@ namespace QuantLib {
                   bool settlesAccrual = true,
                   bool paysAtDefaultTime = true);
         void setTermStructure(DefaultProbabilityTermStructure*);
+        //! calculator for the underlying swap
+        /*! It is built on first use; this reads the discount curve,
+            which must therefore be calculated when different threads
+            bootstrap curves on helpers sharing it.
+        */
+        const MidPointCdsCalculator& calculator() const;
       protected:
         void update();
         void initializeDates();
@@ -99,6 +111,9 @@ namespace QuantLib {
         RelinkableHandle<DefaultProbabilityTermStructure> probability_;
         //! protection effective date.
         Date protectionStart_;
+        boost::optional<bool> includeSettlementDateFlows_;
+      private:
+        mutable boost::shared_ptr<MidPointCdsCalculator> calculator_;
     };
 
     //! Spread-quoted CDS hazard rate bootstrap helper.
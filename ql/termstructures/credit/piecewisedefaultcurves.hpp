@@ -0,0 +1,107 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file piecewisedefaultcurves.hpp
+    \brief bootstrap of the default curves of several issuers
+*/
+
+#ifndef quantlib_piecewise_default_curves_hpp
+#define quantlib_piecewise_default_curves_hpp
+
+#include <ql/termstructures/credit/piecewisedefaultcurve.hpp>
+#include <ql/termstructures/credit/defaultprobabilityhelpers.hpp>
+#include <ql/utilities/dataformatters.hpp>
+#include <sstream>
+#include <string>
+
+namespace QuantLib {
+
+    //! bootstrap of the default curves of several issuers
+    /*! Returns one PiecewiseDefaultCurve for each set of helpers,
+        with the given reference date, already bootstrapped.  The
+        curves are independent of each other; if OpenMP is enabled,
+        they are bootstrapped in parallel.
+
+        The curves are built one after the other, since registering
+        as an observer is not thread safe; the calculators of the CDS
+        helpers are built at the same time, which also calculates
+        the discount curves they share.  During the bootstrap, each
+        thread only works on a curve and on its helpers.  A helper
+        must not be used for more than one issuer, and helpers other
+        than CdsHelper instances must not modify shared objects when
+        their implied quote is calculated.
+
+        If any of the bootstraps fail, an exception is raised after
+        all of them are done; the message reports the failures.
+
+        \test the curves are checked against the ones built
+              separately.
+    */
+    template <class Traits, class Interpolator>
+    std::vector<boost::shared_ptr<PiecewiseDefaultCurve<Traits,
+                                                        Interpolator> > >
+    bootstrapDefaultCurves(
+        const Date& referenceDate,
+        const std::vector<std::vector<
+                 boost::shared_ptr<typename Traits::helper> > >& instruments,
+        const DayCounter& dayCounter,
+        Real accuracy = 1.0e-12,
+        const Interpolator& i = Interpolator()) {
+
+        typedef PiecewiseDefaultCurve<Traits,Interpolator> curve_type;
+
+        const Size n = instruments.size();
+        std::vector<boost::shared_ptr<curve_type> > curves(n);
+        for (Size k=0; k<n; ++k) {
+            curves[k] = boost::shared_ptr<curve_type>(
+                        new curve_type(referenceDate, instruments[k],
+                                       dayCounter, accuracy, i));
+            for (Size j=0; j<instruments[k].size(); ++j) {
+                boost::shared_ptr<CdsHelper> helper =
+                    boost::dynamic_pointer_cast<CdsHelper>(
+                                                       instruments[k][j]);
+                if (helper)
+                    helper->calculator();
+            }
+        }
+
+        std::vector<std::string> messages(n);
+
+        #pragma omp parallel for
+        for (Size k=0; k<n; ++k) {
+            try {
+                curves[k]->dates();
+            } catch (std::exception& e) {
+                messages[k] = e.what();
+            }
+        }
+
+        std::ostringstream errors;
+        for (Size k=0; k<n; ++k) {
+            if (!messages[k].empty())
+                errors << "\n  " << io::ordinal(k+1)
+                       << " curve: " << messages[k];
+        }
+        QL_REQUIRE(errors.str().empty(),
+                   "failed to bootstrap default curves:" << errors.str());
+
+        return curves;
+    }
+
+}
+
+#endif
@@ -0,0 +1,132 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/termstructures/volatility/equityfx/blackvariancesurfacebuilder.hpp>
+#include <ql/pricingengines/blackformula.hpp>
+
+namespace QuantLib {
+
+    BlackVarianceSurfaceBuilder::BlackVarianceSurfaceBuilder(
+                           const Date& referenceDate,
+                           const Calendar& cal,
+                           const std::vector<Date>& dates,
+                           const std::vector<Real>& strikes,
+                           const Matrix& optionPrices,
+                           Option::Type optionType,
+                           const Handle<Quote>& spot,
+                           const Handle<YieldTermStructure>& dividendTS,
+                           const Handle<YieldTermStructure>& riskFreeTS,
+                           const DayCounter& dayCounter,
+                           Real accuracy,
+                           Natural maxIterations)
+    : referenceDate_(referenceDate), calendar_(cal), dates_(dates),
+      strikes_(strikes), dayCounter_(dayCounter),
+      forwards_(dates.size()), vols_(strikes.size(), dates.size()) {
+
+        QL_REQUIRE(!dates_.empty(), "no dates given");
+        QL_REQUIRE(!strikes_.empty(), "no strikes given");
+        QL_REQUIRE(dates_.size()==optionPrices.columns(),
+                   "mismatch between date vector and price matrix columns");
+        QL_REQUIRE(strikes_.size()==optionPrices.rows(),
+                   "mismatch between strike vector and price matrix rows");
+        QL_REQUIRE(dates_[0]>referenceDate_,
+                   "cannot have dates[0] <= referenceDate");
+
+        // the term structures are not thread safe, therefore everything
+        // depending on them is computed before entering the loop below
+        const Real s0 = spot->value();
+        std::vector<DiscountFactor> discounts(dates_.size());
+        std::vector<Real> sqrtTimes(dates_.size());
+        for (Size j=0; j<dates_.size(); ++j) {
+            QL_REQUIRE(j==0 || dates_[j]>dates_[j-1],
+                       "dates must be sorted unique!");
+            discounts[j] = riskFreeTS->discount(dates_[j]);
+            forwards_[j] = s0*dividendTS->discount(dates_[j])/discounts[j];
+            sqrtTimes[j] = std::sqrt(
+                         dayCounter_.yearFraction(referenceDate_, dates_[j]));
+        }
+
+        std::vector<std::string> messages(strikes_.size()*dates_.size());
+
+        #pragma omp parallel for
+        for (Size j=0; j<dates_.size(); ++j) {
+            Real guess = Null<Real>();
+            for (Size i=0; i<strikes_.size(); ++i) {
+                try {
+                    const Real stdDev = blackFormulaImpliedStdDev(
+                        optionType, strikes_[i], forwards_[j],
+                        optionPrices[i][j], discounts[j], 0.0,
+                        guess, accuracy, maxIterations);
+                    vols_[i][j] = stdDev/sqrtTimes[j];
+                    guess = stdDev;
+                } catch (std::exception& e) {
+                    vols_[i][j] = Null<Real>();
+                    messages[i*dates_.size()+j] = e.what();
+                }
+            }
+        }
+
+        for (Size i=0; i<strikes_.size(); ++i) {
+            for (Size j=0; j<dates_.size(); ++j) {
+                if (vols_[i][j] == Null<Real>()) {
+                    failures_.push_back(std::make_pair(i, j));
+                    errors_.push_back(messages[i*dates_.size()+j]);
+                }
+            }
+        }
+    }
+
+    boost::shared_ptr<BlackVarianceSurface>
+    BlackVarianceSurfaceBuilder::surface(
+                BlackVarianceSurface::Extrapolation lowerExtrapolation,
+                BlackVarianceSurface::Extrapolation upperExtrapolation) const {
+
+        Matrix vols = vols_;
+        for (Size j=0; j<dates_.size(); ++j) {
+            std::vector<Size> valid;
+            for (Size i=0; i<strikes_.size(); ++i)
+                if (vols[i][j] != Null<Real>())
+                    valid.push_back(i);
+            QL_REQUIRE(!valid.empty(),
+                       "no implied volatility found for " << dates_[j]);
+
+            Size k = 0;
+            for (Size i=0; i<strikes_.size(); ++i) {
+                if (vols[i][j] != Null<Real>())
+                    continue;
+                while (k < valid.size() && valid[k] < i)
+                    ++k;
+                if (k == 0) {
+                    vols[i][j] = vols_[valid.front()][j];
+                } else if (k == valid.size()) {
+                    vols[i][j] = vols_[valid.back()][j];
+                } else {
+                    const Size l = valid[k-1], u = valid[k];
+                    vols[i][j] = vols_[l][j] + (vols_[u][j] - vols_[l][j])
+                        * (strikes_[i] - strikes_[l])
+                        / (strikes_[u] - strikes_[l]);
+                }
+            }
+        }
+
+        return boost::shared_ptr<BlackVarianceSurface>(
+            new BlackVarianceSurface(referenceDate_, calendar_, dates_,
+                                     strikes_, vols, dayCounter_,
+                                     lowerExtrapolation, upperExtrapolation));
+    }
+
+}
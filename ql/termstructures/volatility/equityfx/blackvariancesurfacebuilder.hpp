@@ -0,0 +1,104 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file blackvariancesurfacebuilder.hpp
+    \brief Black variance surface implied from a grid of option prices
+*/
+
+#ifndef quantlib_black_variance_surface_builder_hpp
+#define quantlib_black_variance_surface_builder_hpp
+
+#include <ql/termstructures/volatility/equityfx/blackvariancesurface.hpp>
+#include <ql/termstructures/yieldtermstructure.hpp>
+#include <ql/quote.hpp>
+#include <ql/option.hpp>
+#include <utility>
+#include <string>
+
+namespace QuantLib {
+
+    //! Black variance surface implied from a grid of option prices
+    /*! The class takes a matrix of European option prices (present
+        values) on a grid of strikes (rows) and expiry dates
+        (columns), in the same layout as the volatility matrix of
+        BlackVarianceSurface, and inverts the Black formula for all
+        of them at once.
+
+        Forwards, discount factors and times are computed once per
+        expiry from the given curves; the inversion then works on
+        plain numbers, starting each strike from the solution of the
+        previous one in the same expiry. If OpenMP is enabled, the
+        expiries are processed in parallel.
+
+        Points for which no implied volatility can be found (e.g.,
+        arbitrageable prices) do not abort the calculation; they are
+        reported by failures() and, when building the surface, are
+        replaced by linear interpolation in strike between the
+        neighbouring points of the same expiry (flat beyond the
+        outermost ones).
+
+        \warning calculations are performed in the constructor and
+                 not repeated when the curves or the spot change.
+    */
+    class BlackVarianceSurfaceBuilder {
+      public:
+        BlackVarianceSurfaceBuilder(
+                           const Date& referenceDate,
+                           const Calendar& cal,
+                           const std::vector<Date>& dates,
+                           const std::vector<Real>& strikes,
+                           const Matrix& optionPrices,
+                           Option::Type optionType,
+                           const Handle<Quote>& spot,
+                           const Handle<YieldTermStructure>& dividendTS,
+                           const Handle<YieldTermStructure>& riskFreeTS,
+                           const DayCounter& dayCounter,
+                           Real accuracy = 1.0e-6,
+                           Natural maxIterations = 100);
+        //! \name Inspectors
+        //@{
+        const std::vector<Real>& forwards() const { return forwards_; }
+        //! implied volatilities; failed points are set to Null<Real>()
+        const Matrix& impliedVolatilities() const { return vols_; }
+        //! (strike, date) indices of the failed points
+        const std::vector<std::pair<Size, Size> >& failures() const {
+            return failures_;
+        }
+        //! error messages of the failed points
+        const std::vector<std::string>& errors() const { return errors_; }
+        //@}
+        //! builds the surface, filling the failed points
+        boost::shared_ptr<BlackVarianceSurface> surface(
+            BlackVarianceSurface::Extrapolation lowerExtrapolation =
+                BlackVarianceSurface::InterpolatorDefaultExtrapolation,
+            BlackVarianceSurface::Extrapolation upperExtrapolation =
+                BlackVarianceSurface::InterpolatorDefaultExtrapolation) const;
+      private:
+        Date referenceDate_;
+        Calendar calendar_;
+        std::vector<Date> dates_;
+        std::vector<Real> strikes_;
+        DayCounter dayCounter_;
+        std::vector<Real> forwards_;
+        Matrix vols_;
+        std::vector<std::pair<Size, Size> > failures_;
+        std::vector<std::string> errors_;
+    };
+
+}
+
+#endif
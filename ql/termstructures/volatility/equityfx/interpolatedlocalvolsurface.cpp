@@ -0,0 +1,159 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include <ql/termstructures/volatility/equityfx/interpolatedlocalvolsurface.hpp>
+#include <algorithm>
+
+namespace QuantLib {
+
+    InterpolatedLocalVolSurface::InterpolatedLocalVolSurface(
+                     const Handle<LocalVolTermStructure>& localVol,
+                     const std::vector<Time>& times,
+                     const std::vector<Real>& logStrikes,
+                     Real illegalLocalVolOverwrite)
+    : LocalVolTermStructure(localVol->businessDayConvention(),
+                            localVol->dayCounter()),
+      localVol_(localVol), times_(times), logStrikes_(logStrikes),
+      illegalLocalVolOverwrite_(illegalLocalVolOverwrite) {
+
+        QL_REQUIRE(times_.size() >= 1, "at least one time required");
+        QL_REQUIRE(logStrikes_.size() >= 2,
+                   "at least two log-strikes required");
+        for (Size i=1; i<times_.size(); ++i)
+            QL_REQUIRE(times_[i] > times_[i-1],
+                       "times must be sorted and unique");
+        for (Size j=1; j<logStrikes_.size(); ++j)
+            QL_REQUIRE(logStrikes_[j] > logStrikes_[j-1],
+                       "log-strikes must be sorted and unique");
+
+        registerWith(localVol_);
+    }
+
+    const Date& InterpolatedLocalVolSurface::referenceDate() const {
+        return localVol_->referenceDate();
+    }
+
+    DayCounter InterpolatedLocalVolSurface::dayCounter() const {
+        return localVol_->dayCounter();
+    }
+
+    Date InterpolatedLocalVolSurface::maxDate() const {
+        return localVol_->maxDate();
+    }
+
+    Real InterpolatedLocalVolSurface::minStrike() const {
+        return localVol_->minStrike();
+    }
+
+    Real InterpolatedLocalVolSurface::maxStrike() const {
+        return localVol_->maxStrike();
+    }
+
+    void InterpolatedLocalVolSurface::performCalculations() const {
+        localVolMatrix_ = Matrix(times_.size(), logStrikes_.size());
+        for (Size i=0; i<times_.size(); ++i) {
+            for (Size j=0; j<logStrikes_.size(); ++j) {
+                const Real strike = std::exp(logStrikes_[j]);
+                if (illegalLocalVolOverwrite_ < 0.0) {
+                    localVolMatrix_[i][j] =
+                        localVol_->localVol(times_[i], strike, true);
+                } else {
+                    try {
+                        localVolMatrix_[i][j] =
+                            localVol_->localVol(times_[i], strike, true);
+                    } catch (Error&) {
+                        localVolMatrix_[i][j] = illegalLocalVolOverwrite_;
+                    }
+                }
+            }
+        }
+    }
+
+    void InterpolatedLocalVolSurface::timeWeights(Time t, Size& i,
+                                                  Real& w) const {
+        // returns the lower row and the weight of the upper one
+        if (times_.size() == 1 || t <= times_.front()) {
+            i = 0;
+            w = 0.0;
+        } else if (t >= times_.back()) {
+            i = times_.size() - 2;
+            w = 1.0;
+        } else {
+            i = std::upper_bound(times_.begin(), times_.end(), t)
+                - times_.begin() - 1;
+            w = (t - times_[i]) / (times_[i+1] - times_[i]);
+        }
+    }
+
+    Volatility InterpolatedLocalVolSurface::localVolImpl(Time t,
+                                                         Real strike) const {
+        Array k(1, std::log(strike));
+        return localVols(t, k)[0];
+    }
+
+    Disposable<Array> InterpolatedLocalVolSurface::localVols(
+                                  Time t, const Array& logStrikes) const {
+        calculate();
+
+        // interpolate in time once for the whole slice
+        Size i;
+        Real w;
+        timeWeights(t, i, w);
+        const Size n = logStrikes_.size();
+        std::vector<Real> slice(localVolMatrix_.row_begin(i),
+                                localVolMatrix_.row_end(i));
+        if (w > 0.0) {
+            Matrix::const_row_iterator upper = localVolMatrix_.row_begin(i+1);
+            for (Size j=0; j<n; ++j)
+                slice[j] += w*(upper[j] - slice[j]);
+        }
+
+        // interpolate in log-strike; the segment is tracked with a
+        // cursor and only searched for when the input is not sorted
+        Array result(logStrikes.size());
+        Size j = 0;
+        for (Size l=0; l<logStrikes.size(); ++l) {
+            const Real k = logStrikes[l];
+            if (k <= logStrikes_.front()) {
+                result[l] = slice.front();
+            } else if (k >= logStrikes_.back()) {
+                result[l] = slice.back();
+            } else {
+                if (k < logStrikes_[j])
+                    j = std::upper_bound(logStrikes_.begin(),
+                                         logStrikes_.end(), k)
+                        - logStrikes_.begin() - 1;
+                while (k >= logStrikes_[j+1])
+                    ++j;
+                result[l] = slice[j] + (slice[j+1] - slice[j])
+                    * (k - logStrikes_[j])
+                    / (logStrikes_[j+1] - logStrikes_[j]);
+            }
+        }
+        return result;
+    }
+
+    void InterpolatedLocalVolSurface::accept(AcyclicVisitor& v) {
+        Visitor<InterpolatedLocalVolSurface>* v1 =
+            dynamic_cast<Visitor<InterpolatedLocalVolSurface>*>(&v);
+        if (v1 != 0)
+            v1->visit(*this);
+        else
+            LocalVolTermStructure::accept(v);
+    }
+
+}
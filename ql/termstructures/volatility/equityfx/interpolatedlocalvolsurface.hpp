@@ -0,0 +1,124 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+/*! \file interpolatedlocalvolsurface.hpp
+    \brief Local volatility surface tabulated on a time/log-strike grid
+*/
+
+#ifndef quantlib_interpolated_local_vol_surface_hpp
+#define quantlib_interpolated_local_vol_surface_hpp
+
+#include <ql/termstructures/volatility/equityfx/localvoltermstructure.hpp>
+#include <ql/patterns/lazyobject.hpp>
+#include <ql/math/matrix.hpp>
+#include <vector>
+
+namespace QuantLib {
+
+    //! Local volatility surface tabulated on a time/log-strike grid
+    /*! The local volatility of the given term structure (e.g., the
+        Dupire volatility of a LocalVolSurface) is evaluated once on
+        the given grid of times and log-strikes and interpolated
+        bilinearly afterwards; outside the grid the values are
+        extrapolated flat. The grid is recalculated lazily whenever
+        the underlying term structure notifies a change.
+
+        Besides the usual interface, the class provides the local
+        volatilities for a whole set of log-strikes at a given time
+        (e.g., the nodes of a finite-difference mesh) without
+        repeating the time interpolation for each of them.
+
+        If a non-negative illegalLocalVolOverwrite is given, it
+        replaces the local volatility at grid nodes where the
+        underlying term structure fails to provide one.
+    */
+    class InterpolatedLocalVolSurface : public LocalVolTermStructure,
+                                        public LazyObject {
+      public:
+        InterpolatedLocalVolSurface(
+                     const Handle<LocalVolTermStructure>& localVol,
+                     const std::vector<Time>& times,
+                     const std::vector<Real>& logStrikes,
+                     Real illegalLocalVolOverwrite = -Null<Real>());
+        //! \name TermStructure interface
+        //@{
+        const Date& referenceDate() const;
+        DayCounter dayCounter() const;
+        Date maxDate() const;
+        //@}
+        //! \name VolatilityTermStructure interface
+        //@{
+        Real minStrike() const;
+        Real maxStrike() const;
+        //@}
+        //! \name Observer interface
+        //@{
+        void update();
+        //@}
+        //! \name Inspectors
+        //@{
+        const std::vector<Time>& times() const;
+        const std::vector<Real>& logStrikes() const;
+        const Matrix& localVolMatrix() const;
+        //@}
+        //! local volatilities at time t for the given log-strikes
+        /*! Sorted log-strikes are located with a moving cursor; the
+            result is the same as for unsorted ones.
+        */
+        Disposable<Array> localVols(Time t, const Array& logStrikes) const;
+        //! \name Visitability
+        //@{
+        virtual void accept(AcyclicVisitor&);
+        //@}
+      protected:
+        Volatility localVolImpl(Time t, Real strike) const;
+        void performCalculations() const;
+      private:
+        void timeWeights(Time t, Size& i, Real& w) const;
+        Handle<LocalVolTermStructure> localVol_;
+        std::vector<Time> times_;
+        std::vector<Real> logStrikes_;
+        Real illegalLocalVolOverwrite_;
+        mutable Matrix localVolMatrix_;
+    };
+
+
+    // inline definitions
+
+    inline void InterpolatedLocalVolSurface::update() {
+        TermStructure::update();
+        LazyObject::update();
+    }
+
+    inline const std::vector<Time>&
+    InterpolatedLocalVolSurface::times() const {
+        return times_;
+    }
+
+    inline const std::vector<Real>&
+    InterpolatedLocalVolSurface::logStrikes() const {
+        return logStrikes_;
+    }
+
+    inline const Matrix& InterpolatedLocalVolSurface::localVolMatrix() const {
+        calculate();
+        return localVolMatrix_;
+    }
+
+}
+
+#endif
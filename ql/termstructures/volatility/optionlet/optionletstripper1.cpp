@@ -25,11 +25,8 @@
 #include <ql/termstructures/volatility/optionlet/optionletstripper1.hpp>
 #include <ql/instruments/makecapfloor.hpp>
 #include <ql/pricingengines/capfloor/blackcapfloorengine.hpp>
-#include <ql/pricingengine.hpp>
-#include <ql/pricingengines/capfloor/bacheliercapfloorengine.hpp>
 #include <ql/pricingengines/blackformula.hpp>
 #include <ql/indexes/iborindex.hpp>
-#include <ql/quotes/simplequote.hpp>
 #include <ql/utilities/dataformatters.hpp>
 
 using boost::shared_ptr;
@@ -42,12 +39,16 @@ OptionletStripper1::OptionletStripper1(
     Natural maxIter, const Handle< YieldTermStructure > &discount,
     const VolatilityType type, const Real displacement, bool dontThrow)
     : OptionletStripper(termVolSurface, index, discount, type, displacement),
-      volQuotes_(nOptionletTenors_,
-                 std::vector< shared_ptr< SimpleQuote > >(nStrikes_)),
+      capletOffsets_(nOptionletTenors_ + 1, 0),
+      optionletAnnuities_(nOptionletTenors_),
       floatingSwitchStrike_(switchStrike == Null< Rate >() ? true : false),
-      capFlooMatrixNotInitialized_(true), switchStrike_(switchStrike),
+      stripped_(false), switchStrike_(switchStrike),
       accuracy_(accuracy), maxIter_(maxIter), dontThrow_(dontThrow) {
 
+        QL_REQUIRE(volatilityType_ == ShiftedLognormal ||
+                       volatilityType_ == Normal,
+                   "unknown volatility type: " << volatilityType_);
+
         capFloorPrices_ = Matrix(nOptionletTenors_, nStrikes_);
         optionletPrices_ = Matrix(nOptionletTenors_, nStrikes_);
         capletVols_ = Matrix(nOptionletTenors_, nStrikes_);
@@ -55,9 +56,6 @@ OptionletStripper1::OptionletStripper1(
 
         Real firstGuess = 0.14; // guess is only used for shifted lognormal vols
         optionletStDevs_ = Matrix(nOptionletTenors_, nStrikes_, firstGuess);
-
-        capFloors_ = CapFloorMatrix(nOptionletTenors_);
-        capFloorEngines_ = std::vector<std::vector<boost::shared_ptr<PricingEngine> > >(nOptionletTenors_);
     }
 
     void OptionletStripper1::performCalculations() const {
@@ -65,6 +63,24 @@ OptionletStripper1::OptionletStripper1(
         // update dates
         const Date& referenceDate = termVolSurface_->referenceDate();
         const DayCounter& dc = termVolSurface_->dayCounter();
+
+        const Handle<YieldTermStructure>& discountCurve =
+            discount_.empty() ?
+                iborIndex_->forwardingTermStructure() :
+                discount_;
+
+        // the caplet data below are all what is needed to price the
+        // caps/floors; they do not depend on the strike, so that they
+        // are extracted once from a dummy cap for each length
+        Date today = Settings::instance().evaluationDate();
+        Date settlement = discountCurve->referenceDate();
+        std::vector<Size> offsets(1, 0);
+        std::vector<Rate> forwards, spreads;
+        std::vector<Real> gearings, annuities, sqrtTimes;
+        std::vector<Date> optionletDates(nOptionletTenors_);
+        std::vector<Time> optionletTimes(nOptionletTenors_);
+        std::vector<Rate> atmOptionletRates(nOptionletTenors_);
+        std::vector<Real> optionletAnnuities(nOptionletTenors_);
         shared_ptr<BlackCapFloorEngine> dummy(new
                     BlackCapFloorEngine(// discounting does not matter here
                                         iborIndex_->forwardingTermStructure(),
@@ -78,116 +94,162 @@ OptionletStripper1::OptionletStripper1(
                 .withPricingEngine(dummy);
             shared_ptr<FloatingRateCoupon> lFRC =
                                                 temp.lastFloatingRateCoupon();
-            optionletDates_[i] = lFRC->fixingDate();
+            optionletDates[i] = lFRC->fixingDate();
             optionletPaymentDates_[i] = lFRC->date();
             optionletAccrualPeriods_[i] = lFRC->accrualPeriod();
-            optionletTimes_[i] = dc.yearFraction(referenceDate,
-                                                 optionletDates_[i]);
-            atmOptionletRate_[i] = lFRC->indexFixing();
+            optionletTimes[i] = dc.yearFraction(referenceDate,
+                                                optionletDates[i]);
+            atmOptionletRates[i] = lFRC->indexFixing();
+            optionletAnnuities[i] =
+                optionletAccrualPeriods_[i] *
+                discountCurve->discount(optionletPaymentDates_[i]);
+
+            CapFloor::arguments arguments;
+            temp.setupArguments(&arguments);
+            for (Size k=0; k<arguments.endDates.size(); ++k) {
+                // expired caplets are discarded, as done by the engines
+                if (arguments.endDates[k] <= settlement)
+                    continue;
+                forwards.push_back(arguments.forwards[k]);
+                spreads.push_back(arguments.spreads[k]);
+                gearings.push_back(arguments.gearings[k]);
+                annuities.push_back(
+                    arguments.nominals[k] * arguments.gearings[k] *
+                    discountCurve->discount(arguments.endDates[k]) *
+                    arguments.accrualTimes[k]);
+                const Date& fixingDate = arguments.fixingDates[k];
+                sqrtTimes.push_back(fixingDate > today ?
+                    std::sqrt(dc.yearFraction(today, fixingDate)) : 0.0);
+            }
+            offsets.push_back(forwards.size());
         }
 
+        Rate switchStrike = switchStrike_;
         if (floatingSwitchStrike_) {
             Rate averageAtmOptionletRate = 0.0;
             for (Size i=0; i<nOptionletTenors_; ++i) {
-                averageAtmOptionletRate += atmOptionletRate_[i];
+                averageAtmOptionletRate += atmOptionletRates[i];
             }
-            switchStrike_ = averageAtmOptionletRate / nOptionletTenors_;
+            switchStrike = averageAtmOptionletRate / nOptionletTenors_;
         }
 
-        const Handle<YieldTermStructure>& discountCurve =
-            discount_.empty() ?
-                iborIndex_->forwardingTermStructure() :
-                discount_;
+        // if anything but the term volatilities changed,
+        // all the strikes have to be stripped again
+        bool fullStrip = !stripped_ ||
+            switchStrike != switchStrike_ ||
+            optionletDates != optionletDates_ ||
+            optionletTimes != optionletTimes_ ||
+            atmOptionletRates != atmOptionletRate_ ||
+            optionletAnnuities != optionletAnnuities_ ||
+            offsets != capletOffsets_ ||
+            forwards != capletForwards_ ||
+            spreads != capletSpreads_ ||
+            gearings != capletGearings_ ||
+            annuities != capletAnnuities_ ||
+            sqrtTimes != capletSqrtTimes_;
 
-        const std::vector<Rate>& strikes = termVolSurface_->strikes();
-        // initialize CapFloorMatrix
-        if (capFlooMatrixNotInitialized_) {
-            for (Size i = 0; i < nOptionletTenors_; ++i) {
-                capFloors_[i].resize(nStrikes_);
-                capFloorEngines_[i].resize(nStrikes_);
-            }
-            // construction might go here
-            for (Size j=0; j<nStrikes_; ++j) {
-                for (Size i=0; i<nOptionletTenors_; ++i) {
-                    volQuotes_[i][j] = shared_ptr<SimpleQuote>(new
-                                                                SimpleQuote());
-                    if (volatilityType_ == ShiftedLognormal) {
-                        capFloorEngines_[i][j]=boost::shared_ptr<BlackCapFloorEngine>(
-                          new BlackCapFloorEngine(
-                              discountCurve, Handle<Quote>(volQuotes_[i][j]),
-                              dc, displacement_));
-                    } else if (volatilityType_ == Normal) {
-                        capFloorEngines_[i][j]=boost::shared_ptr<BachelierCapFloorEngine>(
-                          new BachelierCapFloorEngine(
-                              discountCurve, Handle<Quote>(volQuotes_[i][j]),
-                              dc));
-                    } else {
-                      QL_FAIL("unknown volatility type: " << volatilityType_);
-                    }
-                }
-            }
-            capFlooMatrixNotInitialized_ = false;
+        if (fullStrip) {
+            switchStrike_ = switchStrike;
+            optionletDates_.swap(optionletDates);
+            optionletTimes_.swap(optionletTimes);
+            atmOptionletRate_.swap(atmOptionletRates);
+            optionletAnnuities_.swap(optionletAnnuities);
+            capletOffsets_.swap(offsets);
+            capletForwards_.swap(forwards);
+            capletSpreads_.swap(spreads);
+            capletGearings_.swap(gearings);
+            capletAnnuities_.swap(annuities);
+            capletSqrtTimes_.swap(sqrtTimes);
         }
 
+        // if stripping fails, the stored volatilities no longer match
+        // the stripped results; the next calculation must start over
+        stripped_ = false;
+        const std::vector<Rate>& strikes = termVolSurface_->strikes();
         for (Size j=0; j<nStrikes_; ++j) {
-            // using out-of-the-money options
-            CapFloor::Type capFloorType =
-                strikes[j] < switchStrike_ ? CapFloor::Floor : CapFloor::Cap;
-            Option::Type optionletType =
-                strikes[j] < switchStrike_ ? Option::Put : Option::Call;
-
-            Real previousCapFloorPrice = 0.0;
+            bool changed = fullStrip;
             for (Size i=0; i<nOptionletTenors_; ++i) {
-
-                capFloorVols_[i][j] = termVolSurface_->volatility(
+                Volatility v = termVolSurface_->volatility(
                     capFloorLengths_[i], strikes[j], true);
-                volQuotes_[i][j]->setValue(capFloorVols_[i][j]);
-                capFloors_[i][j] =
-                    MakeCapFloor(capFloorType, capFloorLengths_[i],
-                                 iborIndex_, strikes[j], -0 * Days)
-                        .withPricingEngine(capFloorEngines_[i][j]);
-                capFloorPrices_[i][j] = capFloors_[i][j]->NPV();
-                optionletPrices_[i][j] = capFloorPrices_[i][j] -
-                                                        previousCapFloorPrice;
-                previousCapFloorPrice = capFloorPrices_[i][j];
-                DiscountFactor d =
-                    discountCurve->discount(optionletPaymentDates_[i]);
-                DiscountFactor optionletAnnuity=optionletAccrualPeriods_[i]*d;
-                try {
-                  if (volatilityType_ == ShiftedLognormal) {
-                    optionletStDevs_[i][j] = blackFormulaImpliedStdDev(
-                        optionletType, strikes[j], atmOptionletRate_[i],
-                        optionletPrices_[i][j], optionletAnnuity, displacement_,
-                        optionletStDevs_[i][j], accuracy_, maxIter_);
-                  } else if (volatilityType_ == Normal) {
-                    optionletStDevs_[i][j] =
-                        std::sqrt(optionletTimes_[i]) *
-                        bachelierBlackFormulaImpliedVol(
-                            optionletType, strikes[j], atmOptionletRate_[i],
-                            optionletTimes_[i], optionletPrices_[i][j],
-                            optionletAnnuity);
-                  } else {
-                    QL_FAIL("Unknown volatility type: " << volatilityType_);
-                  }
+                if (v != capFloorVols_[i][j]) {
+                    capFloorVols_[i][j] = v;
+                    changed = true;
                 }
-                catch (std::exception &e) {
-                    if(dontThrow_)
-                        optionletStDevs_[i][j]=0.0;
-                    else
-                        QL_FAIL("could not bootstrap optionlet:"
-                            "\n type:    " << optionletType <<
-                            "\n strike:  " << io::rate(strikes[j]) <<
-                            "\n atm:     " << io::rate(atmOptionletRate_[i]) <<
-                            "\n price:   " << optionletPrices_[i][j] <<
-                            "\n annuity: " << optionletAnnuity <<
-                            "\n expiry:  " << optionletDates_[i] <<
-                            "\n error:   " << e.what());
-                }
-                optionletVolatilities_[i][j] = optionletStDevs_[i][j] /
-                                                std::sqrt(optionletTimes_[i]);
             }
+            if (changed)
+                stripStrike(j);
+        }
+        stripped_ = true;
+    }
+
+    Real OptionletStripper1::capFloorPrice(Size i, Rate strike,
+                                           Volatility vol,
+                                           Option::Type type) const {
+        Real price = 0.0;
+        for (Size k=capletOffsets_[i]; k<capletOffsets_[i+1]; ++k) {
+            Rate effectiveStrike =
+                (strike - capletSpreads_[k]) / capletGearings_[k];
+            Real stdDev = vol * capletSqrtTimes_[k];
+            if (volatilityType_ == ShiftedLognormal)
+                price += blackFormula(type, effectiveStrike,
+                                      capletForwards_[k], stdDev,
+                                      capletAnnuities_[k], displacement_);
+            else
+                price += bachelierBlackFormula(type, effectiveStrike,
+                                               capletForwards_[k], stdDev,
+                                               capletAnnuities_[k]);
         }
+        return price;
+    }
+
+    void OptionletStripper1::stripStrike(Size j) const {
+
+        Rate strike = termVolSurface_->strikes()[j];
+        // using out-of-the-money options
+        Option::Type optionletType =
+            strike < switchStrike_ ? Option::Put : Option::Call;
+
+        Real previousCapFloorPrice = 0.0;
+        for (Size i=0; i<nOptionletTenors_; ++i) {
 
+            capFloorPrices_[i][j] = capFloorPrice(i, strike,
+                                                  capFloorVols_[i][j],
+                                                  optionletType);
+            optionletPrices_[i][j] = capFloorPrices_[i][j] -
+                                                    previousCapFloorPrice;
+            previousCapFloorPrice = capFloorPrices_[i][j];
+            DiscountFactor optionletAnnuity = optionletAnnuities_[i];
+            try {
+              if (volatilityType_ == ShiftedLognormal) {
+                optionletStDevs_[i][j] = blackFormulaImpliedStdDev(
+                    optionletType, strike, atmOptionletRate_[i],
+                    optionletPrices_[i][j], optionletAnnuity, displacement_,
+                    optionletStDevs_[i][j], accuracy_, maxIter_);
+              } else {
+                optionletStDevs_[i][j] =
+                    std::sqrt(optionletTimes_[i]) *
+                    bachelierBlackFormulaImpliedVol(
+                        optionletType, strike, atmOptionletRate_[i],
+                        optionletTimes_[i], optionletPrices_[i][j],
+                        optionletAnnuity);
+              }
+            }
+            catch (std::exception &e) {
+                if(dontThrow_)
+                    optionletStDevs_[i][j]=0.0;
+                else
+                    QL_FAIL("could not bootstrap optionlet:"
+                        "\n type:    " << optionletType <<
+                        "\n strike:  " << io::rate(strike) <<
+                        "\n atm:     " << io::rate(atmOptionletRate_[i]) <<
+                        "\n price:   " << optionletPrices_[i][j] <<
+                        "\n annuity: " << optionletAnnuity <<
+                        "\n expiry:  " << optionletDates_[i] <<
+                        "\n error:   " << e.what());
+            }
+            optionletVolatilities_[i][j] = optionletStDevs_[i][j] /
+                                            std::sqrt(optionletTimes_[i]);
+        }
     }
 
     const Matrix &OptionletStripper1::capletVols() const {
@@ -30,6 +30,7 @@
 #define quantlib_optionletstripper1_hpp
 
 #include <ql/termstructures/volatility/optionlet/optionletstripper.hpp>
+#include <ql/option.hpp>
 
 namespace QuantLib {
 
@@ -42,6 +43,14 @@ namespace QuantLib {
     /*! Helper class to strip optionlet (i.e. caplet/floorlet) volatilities
         (a.k.a. forward-forward volatilities) from the (cap/floor) term
         volatilities of a CapFloorTermVolSurface.
+
+        The cap/floor prices are computed directly from the caplet
+        forwards, annuities and fixing times, which are extracted once
+        per calculation from the cap/floor legs; no instrument or
+        pricing engine is built for each strike and maturity. If only
+        term volatilities change between two calculations, just the
+        strike columns with changed volatilities are stripped again,
+        using the previous solution as a first guess.
     */
     class OptionletStripper1 : public OptionletStripper {
       public:
@@ -66,15 +75,22 @@ namespace QuantLib {
         void performCalculations() const;
         //@}
       private:
+        Real capFloorPrice(Size i, Rate strike, Volatility vol,
+                           Option::Type type) const;
+        void stripStrike(Size j) const;
         mutable Matrix capFloorPrices_, optionletPrices_;
         mutable Matrix capFloorVols_;
         mutable Matrix optionletStDevs_, capletVols_;
 
-        mutable CapFloorMatrix capFloors_;
-        mutable std::vector<std::vector<boost::shared_ptr<SimpleQuote> > > volQuotes_;
-        mutable std::vector<std::vector<boost::shared_ptr<PricingEngine> > > capFloorEngines_;
+        // data of the caplets belonging to the i-th cap/floor are
+        // stored in [capletOffsets_[i], capletOffsets_[i+1])
+        mutable std::vector<Size> capletOffsets_;
+        mutable std::vector<Rate> capletForwards_, capletSpreads_;
+        mutable std::vector<Real> capletGearings_, capletAnnuities_;
+        mutable std::vector<Real> capletSqrtTimes_;
+        mutable std::vector<Real> optionletAnnuities_;
         bool floatingSwitchStrike_;
-        mutable bool capFlooMatrixNotInitialized_;
+        mutable bool stripped_;
         mutable Rate switchStrike_;
         Real accuracy_;
         Natural maxIter_;
@@ -91,4 +91,11 @@
 //#    define QL_ENABLE_PARALLEL_UNIT_TEST_RUNNER
 #endif
 
+/* Define this to use the system BLAS and LAPACK libraries for matrix
+   products and decompositions; they must then be linked together
+   with QuantLib. */
+#ifndef QL_ENABLE_LAPACK
+//#    define QL_ENABLE_LAPACK
+#endif
+
 #endif
@@ -21,10 +21,14 @@
 #include "utilities.hpp"
 #include <ql/methods/montecarlo/brownianbridge.hpp>
 #include <ql/methods/montecarlo/pathgenerator.hpp>
+#include <ql/methods/montecarlo/multipathgenerator.hpp>
+#include <ql/models/marketmodels/browniangenerators/sobolbrowniangenerator.hpp>
+#include <ql/math/randomnumbers/rngtraits.hpp>
 #include <ql/math/randomnumbers/sobolrsg.hpp>
 #include <ql/math/randomnumbers/inversecumulativersg.hpp>
 #include <ql/math/statistics/sequencestatistics.hpp>
 #include <ql/processes/blackscholesprocess.hpp>
+#include <ql/processes/stochasticprocessarray.hpp>
 #include <ql/termstructures/yield/flatforward.hpp>
 #include <ql/termstructures/volatility/equityfx/blackconstantvol.hpp>
 #include <ql/time/calendars/nullcalendar.hpp>
@@ -268,10 +272,213 @@ void BrownianBridgeTest::testPathGeneration() {
     }
 }
 
+void BrownianBridgeTest::testBlockTransform() {
+    BOOST_TEST_MESSAGE("Testing Brownian-bridge transform of path blocks...");
+
+    std::vector<Time> times;
+    times.push_back(0.1);
+    times.push_back(0.2);
+    times.push_back(0.5);
+    times.push_back(1.0);
+    times.push_back(1.5);
+    times.push_back(2.0);
+    times.push_back(5.0);
+    times.push_back(7.0);
+    times.push_back(10.0);
+
+    Size N = times.size(), paths = 13;
+    BrownianBridge bridge(times);
+
+    PseudoRandom::rsg_type rsg =
+        PseudoRandom::make_sequence_generator(N*paths, 42);
+    const std::vector<Real>& input = rsg.nextSequence().value;
+    std::vector<Real> output(N*paths);
+    bridge.transformPaths(paths, &input[0], &output[0]);
+
+    std::vector<Real> variates(N), expected(N);
+    for (Size p=0; p<paths; ++p) {
+        for (Size i=0; i<N; ++i)
+            variates[i] = input[i*paths+p];
+        bridge.transform(variates.begin(), variates.end(),
+                         expected.begin());
+        for (Size i=0; i<N; ++i) {
+            if (output[i*paths+p] != expected[i])
+                BOOST_FAIL("block transform differs from single path"
+                           << "\n    path:       " << p
+                           << "\n    step:       " << i
+                           << "\n    calculated: " << output[i*paths+p]
+                           << "\n    expected:   " << expected[i]);
+        }
+    }
+
+    // the same holds for the Sobol generator drawing blocks of paths
+    Size factors = 3, steps = 8, samples = 40;
+    SobolBrownianGenerator generator1(factors, steps,
+                                      SobolBrownianGenerator::Diagonal, 42);
+    SobolBrownianGenerator generator2(factors, steps,
+                                      SobolBrownianGenerator::Diagonal, 42);
+    std::vector<Real> block(samples*factors*steps), step(factors);
+    generator2.nextPaths(samples, &block[0]);
+    for (Size p=0; p<samples; ++p) {
+        generator1.nextPath();
+        for (Size i=0; i<steps; ++i) {
+            generator1.nextStep(step);
+            for (Size f=0; f<factors; ++f) {
+                Real x = block[(p*steps+i)*factors+f];
+                if (x != step[f])
+                    BOOST_FAIL("block of Sobol paths differs from "
+                               "single paths"
+                               << "\n    path:       " << p
+                               << "\n    step:       " << i
+                               << "\n    factor:     " << f
+                               << "\n    calculated: " << x
+                               << "\n    expected:   " << step[f]);
+            }
+        }
+    }
+}
+
+void BrownianBridgeTest::testSobolSkipping() {
+    BOOST_TEST_MESSAGE("Testing skipping of Sobol Brownian paths...");
+
+    Size factors = 3, steps = 8;
+    Size drawn[] = { 0, 1, 5 };
+    Size skipped[] = { 10, 64, 65, 100 };
+
+    SobolBrownianGenerator reference(factors, steps,
+                                     SobolBrownianGenerator::Diagonal, 42);
+    Size maxPaths = 5 + 100 + 1;
+    std::vector<std::vector<Real> > expected(maxPaths,
+                                             std::vector<Real>(factors*steps));
+    std::vector<Real> step(factors);
+    for (Size p=0; p<maxPaths; ++p) {
+        reference.nextPath();
+        for (Size i=0; i<steps; ++i) {
+            reference.nextStep(step);
+            std::copy(step.begin(), step.end(),
+                      expected[p].begin()+i*factors);
+        }
+    }
+
+    for (Size j=0; j<LENGTH(drawn); ++j) {
+        for (Size k=0; k<LENGTH(skipped); ++k) {
+            SobolBrownianGenerator generator(
+                              factors, steps,
+                              SobolBrownianGenerator::Diagonal, 42);
+            for (Size p=0; p<drawn[j]; ++p) {
+                generator.nextPath();
+                for (Size i=0; i<steps; ++i)
+                    generator.nextStep(step);
+            }
+            generator.skipPaths(skipped[k]);
+
+            Size p = drawn[j] + skipped[k];
+            generator.nextPath();
+            for (Size i=0; i<steps; ++i) {
+                generator.nextStep(step);
+                for (Size f=0; f<factors; ++f) {
+                    if (step[f] != expected[p][i*factors+f])
+                        BOOST_FAIL("skipped Sobol paths differ from "
+                                   "drawn ones"
+                                   << "\n    paths drawn:   " << drawn[j]
+                                   << "\n    paths skipped: " << skipped[k]
+                                   << "\n    step:          " << i
+                                   << "\n    factor:        " << f
+                                   << "\n    calculated:    " << step[f]
+                                   << "\n    expected:      "
+                                   << expected[p][i*factors+f]);
+                }
+            }
+        }
+    }
+}
+
+void BrownianBridgeTest::testMultiPathGeneration() {
+    BOOST_TEST_MESSAGE("Testing Brownian-bridge multi-path generation...");
+
+    std::vector<Time> times;
+    times.push_back(0.25);
+    times.push_back(0.5);
+    times.push_back(1.0);
+    times.push_back(2.0);
+    times.push_back(3.0);
+    times.push_back(5.0);
+
+    TimeGrid grid(times.begin(), times.end());
+
+    Size N = times.size(), factors = 2;
+
+    Date today = Settings::instance().evaluationDate();
+    Handle<Quote> x0(boost::shared_ptr<Quote>(new SimpleQuote(100.0)));
+    Handle<YieldTermStructure> r(boost::shared_ptr<YieldTermStructure>(
+                               new FlatForward(today,0.06,Actual365Fixed())));
+    Handle<YieldTermStructure> q(boost::shared_ptr<YieldTermStructure>(
+                               new FlatForward(today,0.03,Actual365Fixed())));
+    Handle<BlackVolTermStructure> sigma(
+                   boost::shared_ptr<BlackVolTermStructure>(
+                          new BlackConstantVol(today, NullCalendar(), 0.20,Actual365Fixed())));
+
+    std::vector<boost::shared_ptr<StochasticProcess1D> > processes(
+        factors, boost::shared_ptr<StochasticProcess1D>(
+                              new BlackScholesMertonProcess(x0, q, r, sigma)));
+    Matrix correlation(factors, factors, 0.3);
+    for (Size f=0; f<factors; ++f)
+        correlation[f][f] = 1.0;
+    boost::shared_ptr<StochasticProcess> process(
+                    new StochasticProcessArray(processes, correlation));
+
+    typedef PseudoRandom::rsg_type rsg_type;
+    rsg_type rsg1 = PseudoRandom::make_sequence_generator(N*factors, 42);
+    rsg_type rsg2 = PseudoRandom::make_sequence_generator(N*factors, 42);
+    MultiPathGenerator<rsg_type> generator(process, grid, rsg1, true);
+
+    // the variates of each factor are bridged separately, taking
+    // them by step and then by factor
+    BrownianBridge bridge(grid);
+    std::vector<std::vector<Real> > variates(factors, std::vector<Real>(N)),
+                                    bridged(factors, std::vector<Real>(N));
+    Array dw(factors);
+
+    for (Size i=0; i<10; ++i) {
+        const std::vector<Real>& sequence = rsg2.nextSequence().value;
+        for (Size f=0; f<factors; ++f) {
+            for (Size j=0; j<N; ++j)
+                variates[f][j] = sequence[j*factors+f];
+            bridge.transform(variates[f].begin(), variates[f].end(),
+                             bridged[f].begin());
+        }
+
+        for (Integer sign=1; sign>=-1; sign-=2) {
+            const MultiPath& path = (sign > 0) ?
+                generator.next().value : generator.antithetic().value;
+            Array asset = process->initialValues();
+            for (Size j=1; j<=N; ++j) {
+                for (Size f=0; f<factors; ++f)
+                    dw[f] = sign*bridged[f][j-1];
+                asset = process->evolve(grid[j-1], asset, grid.dt(j-1), dw);
+                for (Size k=0; k<factors; ++k) {
+                    if (std::fabs(path[k][j] - asset[k]) > 1.0e-12)
+                        BOOST_FAIL("failed to reproduce bridged multi-path"
+                                   << "\n    sample:     " << i
+                                   << "\n    antithetic: " << (sign < 0)
+                                   << "\n    asset:      " << k
+                                   << "\n    step:       " << j
+                                   << "\n    calculated: " << path[k][j]
+                                   << "\n    expected:   " << asset[k]);
+                }
+            }
+        }
+    }
+}
+
 test_suite* BrownianBridgeTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("Brownian bridge tests");
     suite->add(QUANTLIB_TEST_CASE(&BrownianBridgeTest::testVariates));
     suite->add(QUANTLIB_TEST_CASE(&BrownianBridgeTest::testPathGeneration));
+    suite->add(QUANTLIB_TEST_CASE(&BrownianBridgeTest::testBlockTransform));
+    suite->add(QUANTLIB_TEST_CASE(&BrownianBridgeTest::testSobolSkipping));
+    suite->add(QUANTLIB_TEST_CASE(
+                         &BrownianBridgeTest::testMultiPathGeneration));
     return suite;
 }
 
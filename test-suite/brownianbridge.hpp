@@ -29,6 +29,9 @@ class BrownianBridgeTest {
   public:
     static void testVariates();
     static void testPathGeneration();
+    static void testBlockTransform();
+    static void testSobolSkipping();
+    static void testMultiPathGeneration();
     static boost::unit_test_framework::test_suite* suite();
 };
 
@@ -28,8 +28,11 @@
 #include <ql/experimental/credit/homogeneouspooldef.hpp>
 
 #include <ql/experimental/credit/gaussianlhplossmodel.hpp>
+#include <ql/experimental/credit/recursivelossmodel.hpp>
 #include <ql/termstructures/yield/flatforward.hpp>
 #include <ql/termstructures/credit/flathazardrate.hpp>
+#include <ql/math/randomnumbers/mt19937uniformrng.hpp>
+#include <ql/math/randomnumbers/randomsequencegenerator.hpp>
 #include <ql/time/calendars/target.hpp>
 #include <ql/time/daycounters/actual360.hpp>
 #include <ql/time/daycounters/actualactual.hpp>
@@ -88,6 +91,162 @@ namespace {
                              << found << " vs. " << expected);
     }
 
+    typedef RandomSequenceGenerator<MersenneTwisterUniformRng> MTSequence;
+
+    // gives the tests access to the simulations of the model, which are
+    // split in the given number of blocks.
+    template <class USNG>
+    class InspectedRandomDefaultLM
+        : public RandomDefaultLM<GaussianCopulaPolicy, USNG> {
+      public:
+        InspectedRandomDefaultLM(
+                const boost::shared_ptr<GaussianConstantLossLM>& latentModel,
+                Size nSims, Size nBlocks)
+        : RandomDefaultLM<GaussianCopulaPolicy, USNG>(latentModel, nSims),
+          nBlocks_(nBlocks) {}
+        // name index and day of each default in the given simulation
+        std::vector<std::pair<Size, Size> > events(Size iSim) const {
+            this->calculate();
+            typedef typename
+                RandomDefaultLM<GaussianCopulaPolicy, USNG>::SimEvents
+                    SimEvents;
+            const SimEvents sim = this->getSim(iSim);
+            std::vector<std::pair<Size, Size> > result;
+            for (Size i=0; i<sim.size(); ++i)
+                result.push_back(std::pair<Size, Size>(
+                                       sim[i].nameIdx, sim[i].dayFromRef));
+            return result;
+        }
+        Size tabulatedDefaultDay(Size iName, Probability p) const {
+            this->calculate();
+            return this->defaultDay(iName, p);
+        }
+      private:
+        void performCalculations() const {
+            this->initDates();
+            this->performSimulations(nBlocks_);
+        }
+        Size nBlocks_;
+    };
+
+    struct SimulationData {
+        Date today;
+        boost::shared_ptr<Pool> pool;
+        std::vector<std::string> names;
+        std::vector<Handle<DefaultProbabilityTermStructure> > curves;
+        boost::shared_ptr<GaussianConstantLossLM> latentModel;
+    };
+
+    // a small pool of names with different default intensities, whose
+    // curves start some days before the evaluation date.
+    SimulationData simulationData() {
+        SimulationData data;
+        data.today = Date(31, August, 2006);
+        Settings::instance().evaluationDate() = data.today;
+
+        const Size poolSize = 10;
+        data.pool = boost::shared_ptr<Pool>(new Pool());
+        for (Size i=0; i<poolSize; ++i) {
+            ostringstream o;
+            o << "issuer-" << i;
+            data.names.push_back(o.str());
+            data.curves.push_back(Handle<DefaultProbabilityTermStructure>(
+                boost::shared_ptr<DefaultProbabilityTermStructure>(
+                    new FlatHazardRate(data.today - 10, 0.01*(i+1),
+                                       ActualActual()))));
+            NorthAmericaCorpDefaultKey key(EURCurrency(), SeniorSec,
+                                           Period(), 1.);
+            vector<pair<DefaultProbKey,
+                Handle<DefaultProbabilityTermStructure> > > probabilities;
+            probabilities.push_back(std::make_pair(key, data.curves.back()));
+            data.pool->add(data.names.back(), Issuer(probabilities), key);
+        }
+
+        data.latentModel = boost::shared_ptr<GaussianConstantLossLM>(
+            new GaussianConstantLossLM(
+                Handle<Quote>(boost::shared_ptr<Quote>(new SimpleQuote(0.3))),
+                std::vector<Real>(poolSize, 0.4),
+                LatentModelIntegrationType::GaussianQuadrature, poolSize,
+                GaussianCopulaPolicy::initTraits()));
+        return data;
+    }
+
+    template <class USNG>
+    void checkSimulationBlocks(const std::string& generatorName) {
+        SimulationData data = simulationData();
+        const Size nSims = 1000;
+        const Size nBlocks[] = { 3, 7 };
+        const Date horizon = data.today + 5*Years;
+
+        boost::shared_ptr<Basket> basket(new Basket(data.today, data.names,
+            std::vector<Real>(data.names.size(), 100.0), data.pool,
+            0.0, 0.1));
+        boost::shared_ptr<InspectedRandomDefaultLM<USNG> > model(
+            new InspectedRandomDefaultLM<USNG>(data.latentModel, nSims, 1));
+        basket->setLossModel(model);
+        const Real expectedLoss = basket->expectedTrancheLoss(horizon);
+        const Probability twoDefaults =
+            basket->probAtLeastNEvents(2, horizon);
+
+        for (Size k=0; k<LENGTH(nBlocks); ++k) {
+            boost::shared_ptr<Basket> otherBasket(new Basket(data.today,
+                data.names, std::vector<Real>(data.names.size(), 100.0),
+                data.pool, 0.0, 0.1));
+            boost::shared_ptr<InspectedRandomDefaultLM<USNG> > otherModel(
+                new InspectedRandomDefaultLM<USNG>(data.latentModel, nSims,
+                                                   nBlocks[k]));
+            otherBasket->setLossModel(otherModel);
+
+            Real calculated = otherBasket->expectedTrancheLoss(horizon);
+            for (Size iSim=0; iSim<nSims; ++iSim) {
+                if (model->events(iSim) != otherModel->events(iSim))
+                    BOOST_FAIL("simulation " << iSim << " with "
+                               << generatorName << " differs between 1 and "
+                               << nBlocks[k] << " blocks");
+            }
+            if (calculated != expectedLoss)
+                BOOST_ERROR("expected tranche loss with " << generatorName
+                            << " differs between 1 and " << nBlocks[k]
+                            << " blocks:"
+                            << QL_FIXED << std::setprecision(12)
+                            << "\n    1 block:  " << expectedLoss
+                            << "\n    " << nBlocks[k] << " blocks: "
+                            << calculated);
+            calculated = otherBasket->probAtLeastNEvents(2, horizon);
+            if (calculated != twoDefaults)
+                BOOST_ERROR("probability of two defaults with "
+                            << generatorName << " differs between 1 and "
+                            << nBlocks[k] << " blocks:"
+                            << QL_FIXED << std::setprecision(12)
+                            << "\n    1 block:  " << twoDefaults
+                            << "\n    " << nBlocks[k] << " blocks: "
+                            << calculated);
+        }
+    }
+
+    template <class USNG>
+    void checkFactorSamplerSkip(const std::string& generatorName) {
+        typedef LatentModel<GaussianCopulaPolicy>::FactorSampler<USNG>
+            sampler_type;
+        const GaussianCopulaPolicy copula(std::vector<std::vector<Real> >(
+                                       3, std::vector<Real>(1, std::sqrt(0.3))));
+        const BigNatural seed = 42;
+        const Size skips[] = { 0, 1, 2, 5, 17, 100, 1023 };
+
+        for (Size k=0; k<LENGTH(skips); ++k) {
+            sampler_type skipping(copula, seed), drawing(copula, seed);
+            skipping.skip(skips[k]);
+            for (Size i=0; i<skips[k]; ++i)
+                drawing.nextSequence();
+            const std::vector<Real> skipped = skipping.nextSequence().value;
+            const std::vector<Real> drawn = drawing.nextSequence().value;
+            if (skipped != drawn)
+                BOOST_ERROR("skipping " << skips[k] << " samples with "
+                            << generatorName << " does not match "
+                            << skips[k] << " sequential draws");
+        }
+    }
+
 }
 
 void CdoTest::testHW(unsigned dataSet) {
@@ -215,7 +374,13 @@ void CdoTest::testHW(unsigned dataSet) {
         relativeTolerancePeriod.push_back(0.5);
         // Binomial...
         // Saddle point...
-        // Recursive ...
+        // Recursive
+        modelNames.push_back("Recursive gaussian");
+        basketModels.push_back(boost::shared_ptr<DefaultLossModel>(new
+            RecursiveGaussLossModel(gaussKtLossLM)));
+        absoluteTolerance.push_back(1.);
+        relativeToleranceMidp.push_back(0.04);
+        relativeTolerancePeriod.push_back(0.04);
     }
     else if (hwData7[i].nm > 0 && hwData7[i].nz > 0) {
         TCopulaPolicy::initTraits initTG;
@@ -362,10 +527,88 @@ void CdoTest::testHW(unsigned dataSet) {
 }
 
 
+void CdoTest::testSimulationBlocks() {
+
+    BOOST_TEST_MESSAGE("Testing independence of default simulations "
+                       "from their split in blocks...");
+
+    SavedSettings backup;
+
+    checkSimulationBlocks<SobolRsg>("Sobol sequences");
+    checkSimulationBlocks<MTSequence>("Mersenne-twister sequences");
+}
+
+
+void CdoTest::testFactorSamplerSkip() {
+
+    BOOST_TEST_MESSAGE("Testing skipping of latent model factor samples...");
+
+    checkFactorSamplerSkip<SobolRsg>("Sobol sequences");
+    checkFactorSamplerSkip<MTSequence>("Mersenne-twister sequences");
+}
+
+
+void CdoTest::testDefaultDayTabulation() {
+
+    BOOST_TEST_MESSAGE("Testing tabulated default days against "
+                       "default curve inversion...");
+
+    SavedSettings backup;
+
+    SimulationData data = simulationData();
+    boost::shared_ptr<Basket> basket(new Basket(data.today, data.names,
+        std::vector<Real>(data.names.size(), 100.0), data.pool));
+    boost::shared_ptr<InspectedRandomDefaultLM<SobolRsg> > model(
+        new InspectedRandomDefaultLM<SobolRsg>(data.latentModel, 10, 1));
+    basket->setLossModel(model);
+    // the model is handed the basket when the latter is first calculated
+    basket->expectedTrancheLoss(data.today + 1*Years);
+
+    // days are counted from the evaluation date, which is after the
+    //   reference date of the curves
+    const Size lastDay = 4000;
+    for (Size iName=0; iName<data.curves.size(); ++iName) {
+        const Handle<DefaultProbabilityTermStructure>& curve =
+            data.curves[iName];
+        const Probability pToday =
+            curve->defaultProbability(data.today, true);
+        const Probability pLast =
+            curve->defaultProbability(data.today + lastDay, true);
+        for (Size k=1; k<=200; ++k) {
+            const Probability p = pToday + (pLast - pToday) * k / 200.0;
+            const Size day = model->tabulatedDefaultDay(iName, p);
+            const Probability before =
+                curve->defaultProbability(data.today + day, true);
+            const Probability after =
+                curve->defaultProbability(data.today + (day+1), true);
+            if (!(before < p && p <= after))
+                BOOST_ERROR("default probability not reached "
+                            "on the tabulated default day:"
+                            << "\n    name:                  " << iName
+                            << QL_SCIENTIFIC << std::setprecision(10)
+                            << "\n    probability:           " << p
+                            << "\n    default day:           " << day
+                            << "\n    probability on day:    " << before
+                            << "\n    probability next day:  " << after);
+        }
+        // defaults before the evaluation date are assigned to its day
+        const Size day =
+            model->tabulatedDefaultDay(iName, pToday * 0.5);
+        if (day != 0)
+            BOOST_ERROR("probability reached before the evaluation date "
+                        "assigned to default day " << day
+                        << " for name " << iName);
+    }
+}
+
+
 test_suite* CdoTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("CDO tests");
     for (unsigned i=0; i < LENGTH(hwData7); ++i)
         suite->add(QUANTLIB_TEST_CASE(
             boost::bind(&CdoTest::testHW, i)));
+    suite->add(QUANTLIB_TEST_CASE(&CdoTest::testSimulationBlocks));
+    suite->add(QUANTLIB_TEST_CASE(&CdoTest::testFactorSamplerSkip));
+    suite->add(QUANTLIB_TEST_CASE(&CdoTest::testDefaultDayTabulation));
     return suite;
 }
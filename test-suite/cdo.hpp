@@ -28,6 +28,9 @@
 class CdoTest {
   public:
     static void testHW(unsigned dataSet);
+    static void testSimulationBlocks();
+    static void testFactorSamplerSkip();
+    static void testDefaultDayTabulation();
     static boost::unit_test_framework::test_suite* suite();
 };
 
@@ -21,6 +21,7 @@
 #include "defaultprobabilitycurves.hpp"
 #include "utilities.hpp"
 #include <ql/termstructures/credit/piecewisedefaultcurve.hpp>
+#include <ql/termstructures/credit/piecewisedefaultcurves.hpp>
 #include <ql/termstructures/credit/defaultprobabilityhelpers.hpp>
 #include <ql/termstructures/credit/flathazardrate.hpp>
 #include <ql/termstructures/yield/flatforward.hpp>
@@ -386,6 +387,111 @@ void DefaultProbabilityCurveTest::testUpfrontBootstrap() {
         BOOST_ERROR("Cash-flow settings improperly modified");
 }
 
+void DefaultProbabilityCurveTest::testMultiCurveBootstrap() {
+    BOOST_TEST_MESSAGE("Testing bootstrap of several default curves...");
+
+    Calendar calendar = TARGET();
+
+    Date today = Settings::instance().evaluationDate();
+
+    Integer settlementDays = 1;
+
+    Integer n[] = { 1, 2, 3, 5, 7 };
+    Rate baseQuote[] = { 0.005, 0.006, 0.007, 0.009, 0.010 };
+
+    Frequency frequency = Quarterly;
+    BusinessDayConvention convention = Following;
+    DateGeneration::Rule rule = DateGeneration::TwentiethIMM;
+    DayCounter dayCounter = Thirty360();
+    Real recoveryRate = 0.4;
+
+    RelinkableHandle<YieldTermStructure> discountCurve;
+    discountCurve.linkTo(boost::shared_ptr<YieldTermStructure>(
+                                    new FlatForward(today,0.06,Actual360())));
+
+    const Size issuers = 8;
+    std::vector<std::vector<boost::shared_ptr<DefaultProbabilityHelper> > >
+                                                           helpers(issuers);
+    std::vector<std::vector<boost::shared_ptr<DefaultProbabilityHelper> > >
+                                                         reference(issuers);
+    for (Size k=0; k<issuers; ++k) {
+        for (Size i=0; i<LENGTH(n); ++i) {
+            Rate quote = baseQuote[i]*(1.0 + 0.5*k);
+            helpers[k].push_back(
+                boost::shared_ptr<DefaultProbabilityHelper>(
+                    new SpreadCdsHelper(quote, Period(n[i], Years),
+                                        settlementDays, calendar,
+                                        frequency, convention, rule,
+                                        dayCounter, recoveryRate,
+                                        discountCurve)));
+            reference[k].push_back(
+                boost::shared_ptr<DefaultProbabilityHelper>(
+                    new SpreadCdsHelper(quote, Period(n[i], Years),
+                                        settlementDays, calendar,
+                                        frequency, convention, rule,
+                                        dayCounter, recoveryRate,
+                                        discountCurve)));
+        }
+    }
+
+    std::vector<boost::shared_ptr<
+        PiecewiseDefaultCurve<HazardRate,BackwardFlat> > > curves =
+        bootstrapDefaultCurves<HazardRate,BackwardFlat>(today, helpers,
+                                                        Thirty360());
+
+    Real tolerance = 1.0e-14;
+
+    for (Size k=0; k<issuers; ++k) {
+        PiecewiseDefaultCurve<HazardRate,BackwardFlat> expected(
+                                          today, reference[k], Thirty360());
+        const std::vector<Date>& dates = expected.dates();
+        const std::vector<Real>& rates = expected.data();
+        if (curves[k]->dates() != dates)
+            BOOST_FAIL("Failed to reproduce the nodes of the "
+                       << io::ordinal(k+1) << " curve");
+        for (Size j=0; j<dates.size(); ++j) {
+            Real computed = curves[k]->data()[j];
+            if (std::fabs(computed - rates[j]) > tolerance)
+                BOOST_ERROR(
+                    "\nFailed to reproduce the " << io::ordinal(k+1)
+                    << " curve at " << dates[j] << "\n"
+                    << std::setprecision(12)
+                    << "    computed hazard rate: " << computed << "\n"
+                    << "    expected hazard rate: " << rates[j]);
+        }
+    }
+
+    // the curves reprice the quoted swaps
+    Handle<DefaultProbabilityTermStructure> probability(curves.back());
+    SavedSettings backup;
+    Settings::instance().includeTodaysCashFlows() = true;
+    for (Size i=0; i<LENGTH(n); ++i) {
+        Date protectionStart = today + settlementDays;
+        Date startDate = calendar.adjust(protectionStart, convention);
+        Date endDate = today + n[i]*Years;
+
+        Schedule schedule(startDate, endDate, Period(frequency), calendar,
+                          convention, Unadjusted, rule, false);
+
+        Rate quote = baseQuote[i]*(1.0 + 0.5*(issuers-1));
+        CreditDefaultSwap cds(Protection::Buyer, 1.0, quote,
+                              schedule, convention, dayCounter,
+                              true, true, protectionStart);
+        cds.setPricingEngine(boost::shared_ptr<PricingEngine>(
+                           new MidPointCdsEngine(probability, recoveryRate,
+                                                 discountCurve)));
+
+        Rate computed = cds.fairSpread();
+        if (std::fabs(computed - quote) > 1.0e-6)
+            BOOST_ERROR(
+                "\nFailed to reproduce fair spread for " << n[i] <<
+                "Y credit-default swaps\n"
+                << std::setprecision(10)
+                << "    computed rate: " << io::rate(computed) << "\n"
+                << "    input rate:    " << io::rate(quote));
+    }
+}
+
 
 test_suite* DefaultProbabilityCurveTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("Default-probability curve tests");
@@ -405,5 +511,7 @@ test_suite* DefaultProbabilityCurveTest::suite() {
                 &DefaultProbabilityCurveTest::testSingleInstrumentBootstrap));
     suite->add(QUANTLIB_TEST_CASE(
                          &DefaultProbabilityCurveTest::testUpfrontBootstrap));
+    suite->add(QUANTLIB_TEST_CASE(
+                      &DefaultProbabilityCurveTest::testMultiCurveBootstrap));
     return suite;
 }
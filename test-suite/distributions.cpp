@@ -28,6 +28,7 @@
 #include <ql/math/distributions/poissondistribution.hpp>
 #include <ql/math/comparison.hpp>
 #include <ql/math/functional.hpp>
+#include <boost/math/special_functions/erf.hpp>
 
 using namespace QuantLib;
 using namespace boost::unit_test_framework;
@@ -320,6 +321,120 @@ void DistributionTest::testBivariate() {
                                                         "West 2004", 1.0e-8);
 }
 
+void DistributionTest::testBatchValues() {
+
+    BOOST_TEST_MESSAGE("Testing array evaluation of normal distributions...");
+
+    CumulativeNormalDistribution cum(average,sigma);
+    InverseCumulativeNormal invCum(average,sigma);
+
+    Size N = 20001;
+    Real xMin = average - 38.0*sigma, xMax = average + 9.0*sigma;
+    std::vector<Real> x(N), y(N);
+    for (Size i=0; i<N; i++)
+        x[i] = xMin + (xMax-xMin)*i/(N-1);
+
+    cum.values(&x[0], &x[0]+N, &y[0]);
+    for (Size i=0; i<N; i++) {
+        Real z = (x[i]-average)/sigma;
+        Real expected = 0.5*boost::math::erfc(-z*M_SQRT1_2);
+        if (std::fabs(z) < 3.5 && y[i] != cum(x[i]))
+            BOOST_ERROR("failed to reproduce cumulative normal:"
+                        << QL_SCIENTIFIC
+                        << "\n    x:          " << x[i]
+                        << "\n    array:      " << y[i]
+                        << "\n    expected:   " << cum(x[i]));
+        if (std::fabs(y[i]-expected) > 4.0e-16
+            || (z < 0.0 && z > -37.0
+                && std::fabs(y[i]-expected) > 2.0e-13*expected))
+            BOOST_ERROR("inaccurate cumulative normal:"
+                        << QL_SCIENTIFIC
+                        << "\n    x:          " << x[i]
+                        << "\n    array:      " << y[i]
+                        << "\n    expected:   " << expected);
+    }
+
+    std::vector<Real> u(N), z(N);
+    for (Size i=0; i<N; i++)
+        u[i] = (i+0.5)/N;
+    invCum.values(&u[0], &u[0]+N, &z[0]);
+    // overwriting the input
+    invCum.values(&u[0], &u[0]+N, &u[0]);
+    for (Size i=0; i<N; i++) {
+        Real expected = invCum((i+0.5)/N);
+        if (z[i] != expected || u[i] != expected)
+            BOOST_ERROR("failed to reproduce inverse cumulative normal:"
+                        << QL_SCIENTIFIC
+                        << "\n    x:          " << (i+0.5)/N
+                        << "\n    array:      " << z[i]
+                        << "\n    in place:   " << u[i]
+                        << "\n    expected:   " << expected);
+    }
+
+    // one pair of correlations for each branch of the West algorithm:
+    // |rho| < 0.3, < 0.75, < 0.925 and above
+    Real rho[] = { -0.2, 0.1, -0.6, 0.5, -0.8, 0.9, -0.95, 0.99 };
+    Real xa[] = { -2.5, -0.7, 0.3, 1.8 };
+    Real xb[] = { -1.2, 2.2 };
+    // values given by the implementation preceding the tabulation of
+    // the quadrature nodes, for each correlation and each (xa, xb)
+    Real expected[][LENGTH(xa)*LENGTH(xb)] = {
+        { 0.00022422547929263107, 0.0059124810231936968, 0.016766002092800388,
+          0.23607729462758398, 0.055790756729231526, 0.60685295354406676,
+          0.10718653719478691, 0.95029562104962784 },
+        { 0.0011070652511547844, 0.0061704138270412727, 0.034159441982645145,
+          0.23961865227869406, 0.078370072094663748, 0.61070984075174528,
+          0.1123053052198834, 0.95100535570292899 },
+        { 1.1779586514672289e-06, 0.0045474937105495217, 0.0022691628948741036,
+          0.23023096729665746, 0.022780049776918873, 0.60418388232080766,
+          0.095117281016332725, 0.95016654011372947 },
+        { 0.0036922675332641645, 0.0062095504206368668, 0.064783986161933038,
+          0.24179321785731617, 0.10364661613573981, 0.61605058285300363,
+          0.11490699791787458, 0.95399581836242975 },
+        { 8.3595780796773267e-11, 0.00291140983613689, 9.6076406326587455e-05,
+          0.22830828231073758, 0.0067396338185724824, 0.60400939177526891,
+          0.08634061034448301, 0.95016623337855344 },
+        { 0.0061935291948033138, 0.0062096653257761592, 0.10753703761972055,
+          0.24196365222217939, 0.11505268204885739, 0.61791123628873545,
+          0.1150696702214624, 0.96173389961150735 },
+        { 5.49580553903641e-34, 0.00070612829224899832, 1.8345377701182992e-11,
+          0.22806021363652015, 6.2327977035765093e-05, 0.60400797467545408,
+          0.079589568493637769, 0.95016623337357564 },
+        { 0.0062096653257761592, 0.0062096653257761592, 0.11506784665210226,
+          0.24196365222307303, 0.11506967022170828, 0.61791142218895267,
+          0.11506967022170828, 0.96406443437928757 }
+    };
+    std::vector<Real> a, b;
+    for (Size i=0; i<LENGTH(xa); i++) {
+        for (Size j=0; j<LENGTH(xb); j++) {
+            a.push_back(xa[i]);
+            b.push_back(xb[j]);
+        }
+    }
+    std::vector<Real> c(a.size());
+    // a few ulps, as the compiler might contract the operations
+    // differently
+    const Real tolerance = 4.0*QL_EPSILON;
+    for (Size k=0; k<LENGTH(rho); k++) {
+        BivariateCumulativeNormalDistributionWe04DP bivCum(rho[k]);
+        bivCum.values(&a[0], &a[0]+a.size(), &b[0], &c[0]);
+        for (Size i=0; i<a.size(); i++) {
+            Real value = bivCum(a[i], b[i]);
+            Real tol = tolerance*expected[k][i];
+            if (std::fabs(c[i]-expected[k][i]) > tol
+                || std::fabs(value-expected[k][i]) > tol)
+                BOOST_ERROR("failed to reproduce bivariate cumulative normal:"
+                            << QL_SCIENTIFIC << std::setprecision(17)
+                            << "\n    rho:        " << rho[k]
+                            << "\n    x:          " << a[i]
+                            << "\n    y:          " << b[i]
+                            << "\n    array:      " << c[i]
+                            << "\n    scalar:     " << value
+                            << "\n    expected:   " << expected[k][i]);
+        }
+    }
+}
+
 
 void DistributionTest::testPoisson() {
 
@@ -628,6 +743,7 @@ test_suite* DistributionTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("Distribution tests");
     suite->add(QUANTLIB_TEST_CASE(&DistributionTest::testNormal));
     suite->add(QUANTLIB_TEST_CASE(&DistributionTest::testBivariate));
+    suite->add(QUANTLIB_TEST_CASE(&DistributionTest::testBatchValues));
     suite->add(QUANTLIB_TEST_CASE(&DistributionTest::testPoisson));
     suite->add(QUANTLIB_TEST_CASE(&DistributionTest::testCumulativePoisson));
     suite->add(QUANTLIB_TEST_CASE(
@@ -30,6 +30,7 @@ class DistributionTest {
   public:
     static void testNormal();
     static void testBivariate();
+    static void testBatchValues();
     static void testPoisson();
     static void testCumulativePoisson();
     static void testInverseCumulativePoisson();
@@ -38,6 +38,9 @@
 #include <ql/termstructures/yield/zerocurve.hpp>
 #include <ql/termstructures/volatility/equityfx/blackconstantvol.hpp>
 #include <ql/termstructures/volatility/equityfx/blackvariancesurface.hpp>
+#include <ql/termstructures/volatility/equityfx/blackvariancesurfacebuilder.hpp>
+#include <ql/termstructures/volatility/equityfx/localvolsurface.hpp>
+#include <ql/termstructures/volatility/equityfx/interpolatedlocalvolsurface.hpp>
 #include <ql/utilities/dataformatters.hpp>
 #include <boost/progress.hpp>
 #include <map>
@@ -969,6 +972,90 @@ void EuropeanOptionTest::testImpliedVolContainment() {
 
 }
 
+void EuropeanOptionTest::testImpliedVolSurfaceBuilder() {
+
+    BOOST_TEST_MESSAGE("Testing implied volatility surface "
+                       "from a grid of option prices...");
+
+    SavedSettings backup;
+
+    DayCounter dc = Actual365Fixed();
+    Calendar calendar = TARGET();
+    Date today = Date(22, March, 2013);
+    Settings::instance().evaluationDate() = today;
+
+    Handle<Quote> spot(boost::shared_ptr<Quote>(new SimpleQuote(100.0)));
+    Handle<YieldTermStructure> qTS(flatRate(today, 0.02, dc));
+    Handle<YieldTermStructure> rTS(flatRate(today, 0.05, dc));
+
+    std::vector<Date> dates;
+    dates.push_back(today + 1*Months);
+    dates.push_back(today + 6*Months);
+    dates.push_back(today + 1*Years);
+    dates.push_back(today + 3*Years);
+
+    std::vector<Real> strikes;
+    for (Real k = 80.0; k <= 120.0; k += 5.0)
+        strikes.push_back(k);
+
+    Matrix vols(strikes.size(), dates.size());
+    for (Size i=0; i < strikes.size(); ++i)
+        for (Size j=0; j < dates.size(); ++j)
+            vols[i][j] = 0.2 + 0.1*std::fabs(strikes[i]/100.0-1.0)/(j+1.0);
+
+    // the nodes of the input surface are reproduced exactly
+    Handle<BlackVolTermStructure> volTS(boost::shared_ptr<BlackVolTermStructure>(
+        new BlackVarianceSurface(today, calendar, dates,
+                                 strikes, vols, dc)));
+    boost::shared_ptr<GeneralizedBlackScholesProcess> process(
+                  new BlackScholesMertonProcess(spot, qTS, rTS, volTS));
+    boost::shared_ptr<PricingEngine> engine(
+                                        new AnalyticEuropeanEngine(process));
+
+    Matrix prices(strikes.size(), dates.size());
+    for (Size i=0; i < strikes.size(); ++i) {
+        for (Size j=0; j < dates.size(); ++j) {
+            EuropeanOption option(
+                boost::shared_ptr<StrikedTypePayoff>(
+                    new PlainVanillaPayoff(Option::Call, strikes[i])),
+                boost::shared_ptr<Exercise>(new EuropeanExercise(dates[j])));
+            option.setPricingEngine(engine);
+            prices[i][j] = option.NPV();
+        }
+    }
+    // a price below the intrinsic value has no implied volatility
+    const Size badStrike = 2, badDate = 1;
+    prices[badStrike][badDate] = 0.0;
+
+    const BlackVarianceSurfaceBuilder builder(today, calendar, dates,
+                                              strikes, prices, Option::Call,
+                                              spot, qTS, rTS, dc, 1.0e-10);
+
+    if (builder.failures().size() != 1
+        || builder.failures()[0].first != badStrike
+        || builder.failures()[0].second != badDate)
+        BOOST_FAIL("failed to report the arbitrageable price"
+                   << "\n    number of failures: "
+                   << builder.failures().size());
+
+    const Real tolerance = 1.0e-8;
+    const boost::shared_ptr<BlackVarianceSurface> surface = builder.surface();
+    for (Size i=0; i < strikes.size(); ++i) {
+        for (Size j=0; j < dates.size(); ++j) {
+            const Real expected = (i == badStrike && j == badDate)
+                ? 0.5*(vols[i-1][j] + vols[i+1][j]) : vols[i][j];
+            const Real calculated = surface->blackVol(dates[j], strikes[i]);
+            if (std::fabs(calculated - expected) > tolerance)
+                BOOST_FAIL("failed to reproduce implied volatility"
+                           << "\n    strike:     " << strikes[i]
+                           << "\n    date:       " << dates[j]
+                           << std::setprecision(10)
+                           << "\n    calculated: " << calculated
+                           << "\n    expected:   " << expected);
+        }
+    }
+}
+
 
 // different engines
 
@@ -1513,6 +1600,133 @@ void EuropeanOptionTest::testLocalVolatility() {
     }
 }
 
+void EuropeanOptionTest::testInterpolatedLocalVolatility() {
+    BOOST_TEST_MESSAGE("Testing finite-differences with interpolated "
+                       "local volatility...");
+
+    SavedSettings backup;
+
+    const Date settlementDate(5, July, 2002);
+    Settings::instance().evaluationDate() = settlementDate;
+
+    const DayCounter dayCounter = Actual365Fixed();
+    const Calendar calendar = TARGET();
+
+    const boost::shared_ptr<YieldTermStructure> rTS(
+                                   flatRate(settlementDate, 0.04, dayCounter));
+    const boost::shared_ptr<YieldTermStructure> qTS(
+                                   flatRate(settlementDate, 0.01, dayCounter));
+    const boost::shared_ptr<SimpleQuote> s0(new SimpleQuote(100.0));
+
+    std::vector<Date> dates;
+    dates.push_back(settlementDate + 91);
+    dates.push_back(settlementDate + 182);
+    dates.push_back(settlementDate + 365);
+    dates.push_back(settlementDate + 730);
+
+    std::vector<Real> strikes;
+    for (Real k = 40.0; k <= 250.0; k += 10.0)
+        strikes.push_back(k);
+
+    // a smile flattening out with maturity
+    Matrix blackVolMatrix(strikes.size(), dates.size());
+    for (Size i=0; i < strikes.size(); ++i)
+        for (Size j=0; j < dates.size(); ++j) {
+            const Real m = std::log(strikes[i]/100.0);
+            blackVolMatrix[i][j] = 0.25 + (-0.05*m + 0.1*m*m)/(j+1.0);
+        }
+
+    const boost::shared_ptr<BlackVarianceSurface> volTS(
+        new BlackVarianceSurface(settlementDate, calendar, dates,
+                                 strikes, blackVolMatrix, dayCounter));
+    volTS->setInterpolation<Bicubic>();
+
+    const Handle<LocalVolTermStructure> localVol(
+        boost::shared_ptr<LocalVolTermStructure>(new LocalVolSurface(
+            Handle<BlackVolTermStructure>(volTS),
+            Handle<YieldTermStructure>(rTS),
+            Handle<YieldTermStructure>(qTS),
+            Handle<Quote>(s0))));
+
+    std::vector<Time> times;
+    for (Size i=1; i <= 100; ++i)
+        times.push_back(0.02*i);
+    std::vector<Real> logStrikes;
+    for (Size i=0; i <= 200; ++i)
+        logStrikes.push_back(std::log(20.0) + i*std::log(25.0)/200);
+
+    const boost::shared_ptr<InterpolatedLocalVolSurface> interpolatedLocalVol(
+        new InterpolatedLocalVolSurface(localVol, times, logStrikes, 0.25));
+
+    // on the grid nodes inside the strike range of the volatility
+    // surface the original local volatility is reproduced, also
+    // after a change of the underlying surface
+    const Real nodeTol = 1e-10;
+    for (Size n=0; n < 2; ++n) {
+        for (Size i=0; i < times.size(); ++i) {
+            for (Size j=0; j < logStrikes.size(); ++j) {
+                const Real strike = std::exp(logStrikes[j]);
+                if (strike < volTS->minStrike() || strike > volTS->maxStrike())
+                    continue;
+                const Real expected = localVol->localVol(times[i], strike);
+                const Real calculated =
+                    interpolatedLocalVol->localVol(times[i], strike);
+                if (std::fabs(expected - calculated) > nodeTol) {
+                    BOOST_FAIL("Failed to reproduce local vol on grid node "
+                               << "\n    time:       " << times[i]
+                               << "\n    strike:     " << strike
+                               << "\n    spot:       " << s0->value()
+                               << "\n    calculated: " << calculated
+                               << "\n    expected:   " << expected);
+                }
+            }
+        }
+        s0->setValue(105.0);
+    }
+    s0->setValue(100.0);
+
+    const boost::shared_ptr<GeneralizedBlackScholesProcess> process =
+                                              makeProcess(s0, qTS, rTS, volTS);
+    const boost::shared_ptr<GeneralizedBlackScholesProcess>
+        interpolatedProcess(new GeneralizedBlackScholesProcess(
+            Handle<Quote>(s0),
+            Handle<YieldTermStructure>(qTS),
+            Handle<YieldTermStructure>(rTS),
+            Handle<BlackVolTermStructure>(volTS),
+            Handle<LocalVolTermStructure>(interpolatedLocalVol)));
+
+    for (Size i=0; i < dates.size(); ++i) {
+        for (Real strike = 80.0; strike <= 125.0; strike += 15.0) {
+            const boost::shared_ptr<StrikedTypePayoff> payoff(new
+                                 PlainVanillaPayoff(Option::Call, strike));
+            const boost::shared_ptr<Exercise> exercise(
+                                              new EuropeanExercise(dates[i]));
+            EuropeanOption option(payoff, exercise);
+
+            option.setPricingEngine(boost::shared_ptr<PricingEngine>(
+                    new FdBlackScholesVanillaEngine(process, 50, 200, 0,
+                                                    FdmSchemeDesc::Douglas(),
+                                                    true, 0.25)));
+            const Real expectedNPV = option.NPV();
+
+            option.setPricingEngine(boost::shared_ptr<PricingEngine>(
+                    new FdBlackScholesVanillaEngine(interpolatedProcess,
+                                                    50, 200, 0,
+                                                    FdmSchemeDesc::Douglas(),
+                                                    true)));
+            const Real calculatedNPV = option.NPV();
+
+            const Real tol = 1e-3;
+            if (std::fabs(expectedNPV - calculatedNPV) > tol*expectedNPV) {
+                BOOST_FAIL("Failed to reproduce local vol option price for "
+                           << "\n    strike:     " << payoff->strike()
+                           << "\n    maturity:   " << dates[i]
+                           << "\n    calculated: " << calculatedNPV
+                           << "\n    expected:   " << expectedNPV);
+            }
+        }
+    }
+}
 
 test_suite* EuropeanOptionTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("European option tests");
@@ -1522,6 +1736,8 @@ test_suite* EuropeanOptionTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testImpliedVol));
     suite->add(QUANTLIB_TEST_CASE(
                            &EuropeanOptionTest::testImpliedVolContainment));
+    suite->add(QUANTLIB_TEST_CASE(
+                           &EuropeanOptionTest::testImpliedVolSurfaceBuilder));
     suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testJRBinomialEngines));
     suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testCRRBinomialEngines));
     suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testEQPBinomialEngines));
@@ -1541,6 +1757,8 @@ test_suite* EuropeanOptionTest::suite() {
     // FLOATING_POINT_EXCEPTION
     suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testPriceCurve));
     suite->add(QUANTLIB_TEST_CASE(&EuropeanOptionTest::testLocalVolatility));
+    suite->add(QUANTLIB_TEST_CASE(
+                       &EuropeanOptionTest::testInterpolatedLocalVolatility));
 
     return suite;
 }
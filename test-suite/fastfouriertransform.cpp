@@ -21,6 +21,7 @@
 #include "fastfouriertransform.hpp"
 #include "utilities.hpp"
 #include <ql/math/fastfouriertransform.hpp>
+#include <ql/math/fftplan.hpp>
 #include <ql/math/array.hpp>
 #include <complex>
 #include <vector>
@@ -103,11 +104,147 @@ void FastFourierTransformTest::testInverse() {
 }
 
 
+namespace {
+
+    typedef std::complex<Real> cx;
+
+    std::vector<cx> testSequence(Size n) {
+        std::vector<cx> x(n);
+        for (Size j=0; j<n; ++j)
+            x[j] = cx(std::sin(1.0 + 0.7*j*j), std::cos(0.3*j + 0.1*j*j));
+        return x;
+    }
+
+    std::vector<cx> directTransform(const std::vector<cx>& x) {
+        const Size n = x.size();
+        std::vector<cx> y(n);
+        for (Size k=0; k<n; ++k) {
+            for (Size j=0; j<n; ++j) {
+                const Real angle = -2.0*M_PI*Real((j*k) % n)/n;
+                y[k] += x[j]*cx(std::cos(angle), std::sin(angle));
+            }
+        }
+        return y;
+    }
+
+    Real maxDistance(const std::vector<cx>& x, const std::vector<cx>& y) {
+        Real d = 0.0;
+        for (Size i=0; i<x.size(); ++i)
+            d = std::max(d, std::abs(x[i] - y[i]));
+        return d;
+    }
+
+}
+
+void FastFourierTransformTest::testMixedRadix() {
+    BOOST_TEST_MESSAGE("Testing mixed-radix FFT plans...");
+
+    // powers of 2, 3, 5, other small primes and their products,
+    // and lengths with large prime factors (Bluestein)
+    Size sizes[] = { 1, 2, 3, 4, 5, 6, 7, 8, 9, 12, 16, 25, 30, 31,
+                     37, 49, 60, 64, 97, 210, 256, 343, 1000, 1009 };
+
+    for (Size i=0; i<LENGTH(sizes); ++i) {
+        const Size n = sizes[i];
+        FFTPlan plan(n);
+        const std::vector<cx> x = testSequence(n);
+        const Real tolerance = 1.0e-13*n;
+
+        std::vector<cx> y(n);
+        plan.transform(x.begin(), x.end(), y.begin());
+        Real error = maxDistance(y, directTransform(x));
+        if (error > tolerance)
+            BOOST_ERROR("failed to reproduce direct transform"
+                        << "\n    size:  " << n
+                        << QL_SCIENTIFIC
+                        << "\n    error: " << error);
+
+        std::vector<cx> z(n);
+        plan.inverse_transform(y.begin(), y.end(), z.begin());
+        for (Size j=0; j<n; ++j)
+            z[j] /= Real(n);
+        error = maxDistance(z, x);
+        if (error > tolerance)
+            BOOST_ERROR("failed to invert transform"
+                        << "\n    size:  " << n
+                        << QL_SCIENTIFIC
+                        << "\n    error: " << error);
+    }
+
+    // batches
+    const Size n = 60, howMany = 5;
+    FFTPlan plan(n);
+    const std::vector<cx> x = testSequence(n*howMany);
+    std::vector<cx> y(n*howMany);
+    plan.batch_transform(&x[0], &y[0], howMany);
+    for (Size i=0; i<howMany; ++i) {
+        std::vector<cx> xi(x.begin()+i*n, x.begin()+(i+1)*n),
+                        yi(y.begin()+i*n, y.begin()+(i+1)*n), expected(n);
+        plan.transform(xi.begin(), xi.end(), expected.begin());
+        if (maxDistance(yi, expected) > 1.0e-15)
+            BOOST_ERROR("batch transform differs from single transform"
+                        << "\n    sequence: " << i);
+    }
+
+    // comparison with FastFourierTransform
+    const Size order = 8;
+    FastFourierTransform fft(order);
+    FFTPlan plan2(fft.output_size());
+    const std::vector<cx> x2 = testSequence(fft.output_size());
+    std::vector<cx> expected(x2.size()), calculated(x2.size());
+    fft.transform(x2.begin(), x2.end(), expected.begin());
+    plan2.transform(x2.begin(), x2.end(), calculated.begin());
+    Real error = maxDistance(calculated, expected);
+    if (error > 1.0e-10)
+        BOOST_ERROR("failed to reproduce FastFourierTransform"
+                    << QL_SCIENTIFIC
+                    << "\n    error: " << error);
+}
+
+void FastFourierTransformTest::testRealInput() {
+    BOOST_TEST_MESSAGE("Testing real-input FFT plans...");
+
+    Size sizes[] = { 1, 2, 3, 4, 6, 9, 10, 15, 16, 74, 97, 194, 1000 };
+
+    for (Size i=0; i<LENGTH(sizes); ++i) {
+        const Size n = sizes[i];
+        RealFFTPlan plan(n);
+        std::vector<Real> x(n);
+        for (Size j=0; j<n; ++j)
+            x[j] = std::sin(1.0 + 0.7*j*j) + 0.1*j;
+        const Real tolerance = 1.0e-13*n;
+
+        std::vector<cx> y(plan.output_size()), expected(n);
+        plan.transform(x.begin(), x.end(), y.begin());
+        FFTPlan(n).transform(x.begin(), x.end(), expected.begin());
+        expected.resize(plan.output_size());
+        Real error = maxDistance(y, expected);
+        if (error > tolerance)
+            BOOST_ERROR("failed to reproduce complex transform"
+                        << "\n    size:  " << n
+                        << QL_SCIENTIFIC
+                        << "\n    error: " << error);
+
+        std::vector<Real> z(n);
+        plan.inverse_transform(y.begin(), y.end(), z.begin());
+        error = 0.0;
+        for (Size j=0; j<n; ++j)
+            error = std::max(error, std::fabs(z[j]/n - x[j]));
+        if (error > tolerance)
+            BOOST_ERROR("failed to invert transform"
+                        << "\n    size:  " << n
+                        << QL_SCIENTIFIC
+                        << "\n    error: " << error);
+    }
+}
+
 
 test_suite* FastFourierTransformTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("fast fourier transform tests");
     suite->add(QUANTLIB_TEST_CASE(&FastFourierTransformTest::testSimple));
     suite->add(QUANTLIB_TEST_CASE(&FastFourierTransformTest::testInverse));
+    suite->add(QUANTLIB_TEST_CASE(&FastFourierTransformTest::testMixedRadix));
+    suite->add(QUANTLIB_TEST_CASE(&FastFourierTransformTest::testRealInput));
     return suite;
 }
 
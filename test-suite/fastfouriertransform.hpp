@@ -30,6 +30,8 @@ class FastFourierTransformTest {
   public:
     static void testSimple();
     static void testInverse();
+    static void testMixedRadix();
+    static void testRealInput();
     static boost::unit_test_framework::test_suite* suite();
 };
 
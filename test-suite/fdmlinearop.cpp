@@ -41,6 +41,7 @@
 #include <ql/pricingengines/vanilla/mchestonhullwhiteengine.hpp>
 #include <ql/methods/finitedifferences/finitedifferencemodel.hpp>
 #include <ql/math/matrixutilities/bicgstab.hpp>
+#include <ql/math/matrixutilities/gmres.hpp>
 #include <ql/methods/finitedifferences/schemes/douglasscheme.hpp>
 #include <ql/methods/finitedifferences/schemes/hundsdorferscheme.hpp>
 #include <ql/methods/finitedifferences/schemes/impliciteulerscheme.hpp>
@@ -70,6 +71,7 @@
 #include <ql/methods/finitedifferences/operators/secondderivativeop.hpp>
 #include <ql/methods/finitedifferences/operators/secondordermixedderivativeop.hpp>
 #include <ql/math/matrixutilities/sparseilupreconditioner.hpp>
+#include <ql/math/matrixutilities/sparsepreconditioners.hpp>
 #if defined(__GNUC__) && (((__GNUC__ == 4) && (__GNUC_MINOR__ >= 8)) || (__GNUC__ > 4))
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-local-typedefs"
@@ -216,6 +218,41 @@ void FdmLinearOpTest::testFdmLinearOpLayout() {
             }
         }
     }
+
+    for (Size d=0; d < dim.size(); ++d) {
+        const Size lines = layout.lines(d);
+        if (lines*dim[d] != layout.size()) {
+            BOOST_FAIL("number of lines along direction " << d
+                       << " is " << lines << " but should be "
+                       << layout.size()/dim[d]);
+        }
+
+        // every point must be visited once, with the right coordinate
+        std::vector<Size> visited(layout.size(), 0);
+        for (Size l=0; l < lines; ++l) {
+            const Size start = layout.lineStart(d, l);
+            for (Size k=0; k < dim[d]; ++k)
+                ++visited[start + k*layout.spacing()[d]];
+        }
+        const FdmLinearOpIterator endIter = layout.end();
+        for (iter = layout.begin(); iter != endIter; ++iter) {
+            if (visited[iter.index()] != 1) {
+                BOOST_FAIL("point " << iter.index() << " visited "
+                           << visited[iter.index()]
+                           << " times by the lines along direction " << d);
+            }
+            const Size start =
+                iter.index() - iter.coordinates()[d]*layout.spacing()[d];
+            bool found = false;
+            for (Size l=0; l < lines && !found; ++l)
+                found = (layout.lineStart(d, l) == start);
+            if (!found) {
+                BOOST_FAIL("point " << iter.index() << " is not on a line "
+                           "starting at coordinate zero along direction "
+                           << d);
+            }
+        }
+    }
 }
 
 void FdmLinearOpTest::testUniformGridMesher() {
@@ -1310,6 +1347,128 @@ void FdmLinearOpTest::testBiCGstab() {
 #endif
 }
 
+void FdmLinearOpTest::testGMRES() {
+#if !defined(QL_NO_UBLAS_SUPPORT)
+    BOOST_TEST_MESSAGE("Testing GMRES and sparse preconditioners "
+                       "with Heston operator...");
+
+    SavedSettings backup;
+
+    Size dims[] = {41, 21};
+    const std::vector<Size> dim(dims, dims+LENGTH(dims));
+
+    boost::shared_ptr<FdmLinearOpLayout> index(new FdmLinearOpLayout(dim));
+
+    std::vector<std::pair<Real, Real> > boundaries;
+    boundaries.push_back(std::pair<Real, Real>(3.8, std::log(220.0)));
+    boundaries.push_back(std::pair<Real, Real>(0.000, 1.0));
+
+    boost::shared_ptr<FdmMesher> mesher(
+                            new UniformGridMesher(index, boundaries));
+
+    Handle<Quote> s0(boost::shared_ptr<Quote>(new SimpleQuote(100.0)));
+    Handle<YieldTermStructure> rTS(flatRate(0.05, Actual365Fixed()));
+    Handle<YieldTermStructure> qTS(flatRate(0.0 , Actual365Fixed()));
+
+    boost::shared_ptr<HestonProcess> hestonProcess(
+        new HestonProcess(rTS, qTS, s0, 0.04, 2.5, 0.04, 0.66, -0.8));
+
+    const boost::shared_ptr<FdmLinearOpComposite> op(
+        new FdmHestonOp(mesher, hestonProcess));
+
+    // system matrix of an implicit Euler step
+    const Time dt = 0.05;
+    op->setTime(0.0, dt);
+    SparseMatrix a = -dt*op->toMatrix();
+    for (Size i=0; i < a.size1(); ++i)
+        a(i,i) += 1.0;
+
+    const boost::function<Disposable<Array>(const Array&)> matmult(
+        boost::bind(&prod, boost::cref(a), _1));
+
+    Array b(a.size1());
+    MersenneTwisterUniformRng rng(1234);
+    for (Size i=0; i < b.size(); ++i) {
+        b[i] = rng.next().value;
+    }
+
+    const Real tol = 1e-10;
+
+    const Array expected = BiCGstab(matmult, b.size(), tol).solve(b).x;
+
+    const SparseILU0Preconditioner ilu(a);
+    const SparseJacobiPreconditioner jacobi(a);
+    const boost::function<Disposable<Array>(const Array&)> preconditioners[] = {
+        boost::function<Disposable<Array>(const Array&)>(),
+        boost::bind(&SparseILU0Preconditioner::apply, &ilu, _1),
+        boost::bind(&SparseJacobiPreconditioner::apply, &jacobi, _1)
+    };
+    const std::string names[] = { "none", "ILU(0)", "Jacobi" };
+    const Size restarts[] = { b.size(), 10 };
+
+    for (Size i=0; i < LENGTH(names); ++i) {
+        for (Size j=0; j < LENGTH(restarts); ++j) {
+            const GMRESResult result =
+                GMRES(matmult, 10*b.size(), tol, preconditioners[i])
+                .solveWithRestart(restarts[j], b);
+            const Array r = b - prod(a, result.x);
+            const Real error = std::sqrt(DotProduct(r, r)/DotProduct(b, b));
+            const Array d = result.x - expected;
+            const Real diff = std::sqrt(DotProduct(d, d)
+                                        /DotProduct(expected, expected));
+
+            if (error > tol || diff > 1e3*tol) {
+                BOOST_FAIL("Error calculating the inverse using GMRES" <<
+                        "\n preconditioner: " << names[i] <<
+                        "\n restart:        " << restarts[j] <<
+                        "\n tolerance:      " << tol <<
+                        "\n error:          " << error <<
+                        "\n difference:     " << diff);
+            }
+        }
+    }
+
+    // ILU(0) is exact for tridiagonal matrices
+    const Size n = 50;
+    SparseMatrix t(n, n);
+    for (Size i=0; i < n; ++i) {
+        t(i,i) = 2.0 + 0.01*i;
+        if (i > 0)
+            t(i,i-1) = -1.0;
+        if (i < n-1)
+            t(i,i+1) = -0.9;
+    }
+    const Array y(n, 1.0);
+    const Array x = SparseILU0Preconditioner(t).apply(y);
+    const Array r = y - prod(t, x);
+    const Real error = std::sqrt(DotProduct(r, r)/n);
+    if (error > 1e-12) {
+        BOOST_FAIL("ILU(0) factorization of a tridiagonal matrix "
+                   "is not exact" <<
+                   "\n error: " << error);
+    }
+
+    // implicit Euler step with either solver
+    Array bicgstabStep(b), gmresStep(b);
+    ImplicitEulerScheme bicgstabScheme(op);
+    bicgstabScheme.setStep(dt);
+    bicgstabScheme.step(bicgstabStep, dt);
+    ImplicitEulerScheme gmresScheme(op, ImplicitEulerScheme::bc_set(), 1e-8,
+                                    ImplicitEulerScheme::GMRES);
+    gmresScheme.setStep(dt);
+    gmresScheme.step(gmresStep, dt);
+
+    const Array d = gmresStep - bicgstabStep;
+    const Real diff = std::sqrt(DotProduct(d, d)
+                                /DotProduct(bicgstabStep, bicgstabStep));
+    if (diff > 1e-6) {
+        BOOST_FAIL("Implicit Euler steps with GMRES and BiCGstab "
+                   "do not agree" <<
+                   "\n difference: " << diff);
+    }
+#endif
+}
+
 void FdmLinearOpTest::testCrankNicolsonWithDamping() {
 
     BOOST_TEST_MESSAGE("Testing Crank-Nicolson with initial implicit damping steps "
@@ -1561,6 +1720,7 @@ test_suite* FdmLinearOpTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testFdmHestonExpress));
     suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testFdmHestonHullWhiteOp));
     suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testBiCGstab));
+    suite->add(QUANTLIB_TEST_CASE(&FdmLinearOpTest::testGMRES));
     suite->add(
         QUANTLIB_TEST_CASE(&FdmLinearOpTest::testCrankNicolsonWithDamping));
     suite->add(
@@ -229,6 +229,38 @@ void GsrTest::testGsrModel() {
         w += 5.0;
     } while (w <= 50.0);
 
+    // test the array versions of zerobond and numeraire against the
+    // scalar ones, with the model and with an external curve
+
+    Handle<YieldTermStructure> yts2(boost::shared_ptr<YieldTermStructure>(
+        new FlatForward(0, TARGET(), 0.02, Actual365Fixed())));
+    Array y(21);
+    for (Size i = 0; i < y.size(); i++)
+        y[i] = -5.0 + 0.5 * i;
+
+    for (w = 0.0; w <= 40.0; w += 10.0) {
+        for (t = w + 0.5; t <= 50.0; t += 9.5) {
+            Array zb = model->zerobond(t, w, y);
+            Array zb2 = model->zerobond(t, w, y, yts2);
+            Array nm = model->numeraire(w, y, yts2);
+            for (Size i = 0; i < y.size(); i++) {
+                Real zbVal = model->zerobond(t, w, y[i]);
+                Real zb2Val = model->zerobond(t, w, y[i], yts2);
+                Real nmVal = model->numeraire(w, y[i], yts2);
+                if (fabs(zb[i] - zbVal) > 1E-12 * zbVal ||
+                    fabs(zb2[i] - zb2Val) > 1E-12 * zb2Val ||
+                    fabs(nm[i] - nmVal) > 1E-12 * nmVal)
+                    BOOST_ERROR("Array version of zerobond P("
+                                << w << "," << t << " | y=" << y[i]
+                                << ") = " << zb[i] << " / " << zb2[i]
+                                << " or numeraire = " << nm[i]
+                                << " differs from scalar version ("
+                                << zbVal << " / " << zb2Val << " / " << nmVal
+                                << ")");
+            }
+        }
+    }
+
     // test standard, nonstandard and jamshidian engine against existing Hull
     // White Jamshidian engine
 
@@ -33,6 +33,8 @@
 #include <ql/pricingengines/vanilla/fddividendeuropeanengine.hpp>
 #include <ql/pricingengines/vanilla/fdeuropeanengine.hpp>
 #include <ql/pricingengines/vanilla/analyticptdhestonengine.hpp>
+#include <ql/pricingengines/vanilla/batesengine.hpp>
+#include <ql/pricingengines/vanilla/fourierengine.hpp>
 #include <ql/pricingengines/barrier/fdhestonbarrierengine.hpp>
 #include <ql/pricingengines/barrier/fdblackscholesbarrierengine.hpp>
 #include <ql/pricingengines/vanilla/fdblackscholesvanillaengine.hpp>
@@ -1505,6 +1507,142 @@ void HestonModelTest::testExpansionOnFordeReference() {
     }
 }
 
+void HestonModelTest::testFourierEngines() {
+    BOOST_TEST_MESSAGE("Testing COS and Carr-Madan engines...");
+
+    SavedSettings backup;
+
+    const Date settlementDate(5, July, 2002);
+    Settings::instance().evaluationDate() = settlementDate;
+
+    const Date maturityDate(5, July, 2003);
+    const boost::shared_ptr<Exercise> exercise(
+        new EuropeanExercise(maturityDate));
+
+    const DayCounter dayCounter = Actual365Fixed();
+    const Handle<YieldTermStructure> riskFreeTS(flatRate(0.01, dayCounter));
+    const Handle<YieldTermStructure> dividendTS(flatRate(0.02, dayCounter));
+
+    const Handle<Quote> s0(boost::shared_ptr<Quote>(new SimpleQuote(100.0)));
+
+    const Real v0 = 0.04, kappa = 4.0, theta = 0.25, sigma = 1.0, rho = -0.5;
+
+    const Real strikes[] = { 80, 90, 100, 110, 120 };
+    const std::vector<Real> strikeSlice(strikes, strikes+LENGTH(strikes));
+    const Option::Type types[] = { Option::Put, Option::Call };
+
+    // Alan Lewis reference prices, see testAlanLewisReferencePrices
+    const Real expectedResults[][2] = {
+        { 7.958878113256768285213263077598987193482161301733,
+          26.774758743998854221382195325726949201687074848341 },
+        { 12.017966707346304987709573290236471654992071308187,
+          20.933349000596710388139445766564068085476194042256 },
+        { 17.055270961270109413522653999411000974895436309183,
+          16.070154917028834278213466703938231827658768230714 },
+        { 23.017825898442800538908781834822560777763225722188,
+          12.132211516709844867860534767549426052805766831181 },
+        { 29.811026202682471843340682293165857439167301370697,
+          9.024913483457835636553375454092357136489051667150  }
+    };
+
+    const boost::shared_ptr<HestonModel> hestonModel(new HestonModel(
+        boost::shared_ptr<HestonProcess>(new HestonProcess(
+            riskFreeTS, dividendTS, s0, v0, kappa, theta, sigma, rho))));
+
+    const boost::shared_ptr<BatesModel> batesModel(new BatesModel(
+        boost::shared_ptr<BatesProcess>(new BatesProcess(
+            riskFreeTS, dividendTS, s0, v0, kappa, theta, sigma, rho,
+            0.5, -0.1, 0.2))));
+
+    const boost::shared_ptr<BatesDoubleExpModel> doubleExpModel(
+        new BatesDoubleExpModel(
+            boost::shared_ptr<HestonProcess>(new HestonProcess(
+                riskFreeTS, dividendTS, s0, v0, kappa, theta, sigma, rho)),
+            0.3, 0.1, 0.15, 0.4));
+
+    const TimeGrid timeGrid(3.0, 4);
+    const std::vector<Time> times(timeGrid.begin()+1, timeGrid.end()-1);
+    PiecewiseConstantParameter ptdTheta(times, PositiveConstraint());
+    PiecewiseConstantParameter ptdKappa(times, PositiveConstraint());
+    PiecewiseConstantParameter ptdSigma(times, PositiveConstraint());
+    PiecewiseConstantParameter ptdRho(times, BoundaryConstraint(-1.0, 1.0));
+    for (Size i=0; i < times.size()+1; ++i) {
+        ptdTheta.setParam(i, 0.04 + 0.01*i);
+        ptdKappa.setParam(i, 1.0 + i);
+        ptdSigma.setParam(i, 0.3 + 0.1*i);
+        ptdRho.setParam(i, -0.7 + 0.1*i);
+    }
+    const boost::shared_ptr<PiecewiseTimeDependentHestonModel> ptdModel(
+        new PiecewiseTimeDependentHestonModel(riskFreeTS, dividendTS, s0,
+                                              v0, ptdTheta, ptdKappa,
+                                              ptdSigma, ptdRho, timeGrid));
+
+    const boost::shared_ptr<CharacteristicFunctionModel> models[] = {
+        hestonModel, batesModel, doubleExpModel, ptdModel
+    };
+    const boost::shared_ptr<PricingEngine> analyticEngines[] = {
+        boost::shared_ptr<PricingEngine>(
+                                 new AnalyticHestonEngine(hestonModel, 192)),
+        boost::shared_ptr<PricingEngine>(new BatesEngine(batesModel, 192)),
+        boost::shared_ptr<PricingEngine>(
+                             new BatesDoubleExpEngine(doubleExpModel, 192)),
+        boost::shared_ptr<PricingEngine>(
+                                 new AnalyticPTDHestonEngine(ptdModel, 192))
+    };
+
+    for (Size m=0; m < LENGTH(models); ++m) {
+        const boost::shared_ptr<FourierEngine> engines[] = {
+            boost::shared_ptr<FourierEngine>(new COSEngine(models[m])),
+            boost::shared_ptr<FourierEngine>(
+                                       new CarrMadanFFTEngine(models[m]))
+        };
+        const Real tol[] = { 1e-10, 1e-5 };
+
+        for (Size j=0; j < LENGTH(types); ++j) {
+            std::vector<Real> expected(LENGTH(strikes));
+            for (Size i=0; i < LENGTH(strikes); ++i) {
+                if (m == 0) {
+                    expected[i] = expectedResults[i][j];
+                } else {
+                    VanillaOption option(
+                        boost::shared_ptr<StrikedTypePayoff>(
+                            new PlainVanillaPayoff(types[j], strikes[i])),
+                        exercise);
+                    option.setPricingEngine(analyticEngines[m]);
+                    expected[i] = option.NPV();
+                }
+            }
+
+            for (Size k=0; k < LENGTH(engines); ++k) {
+                const Array calculated =
+                    engines[k]->values(types[j], strikeSlice, maturityDate);
+
+                // the last strike is also priced as a single option
+                VanillaOption option(
+                    boost::shared_ptr<StrikedTypePayoff>(
+                        new PlainVanillaPayoff(types[j], strikes[4])),
+                    exercise);
+                option.setPricingEngine(engines[k]);
+
+                for (Size i=0; i < LENGTH(strikes); ++i) {
+                    const Real value =
+                        (i == 4) ? option.NPV() : calculated[i];
+                    if (std::fabs(value - expected[i]) > tol[k]) {
+                        BOOST_ERROR("failed to reproduce option prices"
+                                    << "\n    model:       " << m
+                                    << "\n    engine:      " << k
+                                    << "\n    option type: " << types[j]
+                                    << "\n    strike:      " << strikes[i]
+                                    << "\n    calculated:  " << value
+                                    << "\n    expected:    " << expected[i]
+                                    << "\n    tolerance:   " << tol[k]);
+                    }
+                }
+            }
+        }
+    }
+}
+
 test_suite* HestonModelTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("Heston model tests");
 
@@ -1531,6 +1669,7 @@ test_suite* HestonModelTest::suite() {
                     &HestonModelTest::testExpansionOnAlanLewisReference));
     suite->add(QUANTLIB_TEST_CASE(
                     &HestonModelTest::testExpansionOnFordeReference));
+    suite->add(QUANTLIB_TEST_CASE(&HestonModelTest::testFourierEngines));
     return suite;
 }
 
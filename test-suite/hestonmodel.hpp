@@ -43,6 +43,7 @@ class HestonModelTest {
     static void testAnalyticPDFHestonEngine();
     static void testExpansionOnAlanLewisReference();
     static void testExpansionOnFordeReference();
+    static void testFourierEngines();
     static boost::unit_test_framework::test_suite* suite();
     static boost::unit_test_framework::test_suite* experimental();
 };
@@ -34,6 +34,7 @@
 #include <ql/math/integrals/twodimensionalintegral.hpp>
 #include <ql/experimental/math/piecewisefunction.hpp>
 #include <ql/experimental/math/piecewiseintegral.hpp>
+#include <ql/experimental/math/gaussianquadgridintegrator.hpp>
 
 #include <boost/make_shared.hpp>
 #include <boost/lambda/lambda.hpp>
@@ -309,6 +310,84 @@ void IntegralTest::testPiecewiseIntegral() {
     pw_check(*piecewise, 9.0, 10.0, 6.0);
 }
 
+namespace {
+
+    // conditional default probability of a factor model times the
+    // factor density; its integral is the unconditional probability
+    class ConditionalProbability {
+      public:
+        ConditionalProbability(Real invP, Real beta, Size factors)
+        : invP_(invP), beta_(factors, beta/std::sqrt(Real(factors))),
+          sigma_(std::sqrt(1.0-beta*beta)) {}
+        Real operator()(const std::vector<Real>& m) const {
+            Real sum = 0.0, density = 1.0;
+            for (Size i=0; i<m.size(); ++i) {
+                sum += beta_[i]*m[i];
+                density *= phi_(m[i]);
+            }
+            return Phi_((invP_ - sum)/sigma_) * density;
+        }
+        Disposable<std::vector<Real> > values(
+                                       const std::vector<Real>& m) const {
+            std::vector<Real> v(2, (*this)(m));
+            v[1] *= 2.0;
+            return v;
+        }
+      private:
+        Real invP_;
+        std::vector<Real> beta_;
+        Real sigma_;
+        NormalDistribution phi_;
+        CumulativeNormalDistribution Phi_;
+    };
+
+}
+
+void IntegralTest::testGaussianQuadGrids() {
+    BOOST_TEST_MESSAGE("Testing Gauss-Hermite tensor-product and "
+                       "sparse grids...");
+
+    const Real p = 0.05;
+    const Real tol = 1.0e-8;
+    const Size order = 15;
+
+    for (Size d=1; d<=4; ++d) {
+        const ConditionalProbability f(InverseCumulativeNormal()(p),
+                                       std::sqrt(0.4), d);
+        const GaussianQuadGridIntegrator tensor(
+                         d, order, GaussianQuadGridIntegrator::TensorProduct);
+        const GaussianQuadGridIntegrator sparse(
+                         d, order, GaussianQuadGridIntegrator::Sparse);
+
+        if (tensor.nodes() != Size(std::pow(Real(order), Real(d)) + 0.5))
+            BOOST_ERROR("wrong number of tensor-product nodes in "
+                        << d << " dimensions: " << tensor.nodes());
+        if (d > 2 && sparse.nodes() >= tensor.nodes())
+            BOOST_ERROR("sparse grid not smaller than the tensor-product "
+                        "grid in " << d << " dimensions:"
+                        << "\n    sparse nodes: " << sparse.nodes()
+                        << "\n    tensor nodes: " << tensor.nodes());
+
+        const Real calculatedTensor = tensor.integrate(f);
+        const Real calculatedSparse = sparse.integrate(f);
+        if (std::fabs(calculatedTensor - p) > tol
+            || std::fabs(calculatedSparse - p) > tol)
+            BOOST_ERROR("failed to integrate conditional probability in "
+                        << d << " dimensions:" << std::setprecision(12)
+                        << "\n    tensor grid: " << calculatedTensor
+                        << "\n    sparse grid: " << calculatedSparse
+                        << "\n    expected:    " << p);
+
+        const std::vector<Real> calculatedV = sparse.integrateV(
+            boost::bind(&ConditionalProbability::values, &f, _1));
+        if (calculatedV.size() != 2
+            || std::fabs(calculatedV[0] - calculatedSparse) > 1.0e-15
+            || std::fabs(calculatedV[1] - 2.0*calculatedSparse) > 1.0e-15)
+            BOOST_ERROR("vector integration does not match scalar one in "
+                        << d << " dimensions");
+    }
+}
+
 test_suite* IntegralTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("Integration tests");
     suite->add(QUANTLIB_TEST_CASE(&IntegralTest::testSegment));
@@ -322,6 +401,7 @@ test_suite* IntegralTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&IntegralTest::testFolinIntegration));
     suite->add(QUANTLIB_TEST_CASE(&IntegralTest::testDiscreteIntegrals));
     suite->add(QUANTLIB_TEST_CASE(&IntegralTest::testPiecewiseIntegral));
+    suite->add(QUANTLIB_TEST_CASE(&IntegralTest::testGaussianQuadGrids));
     return suite;
 }
 
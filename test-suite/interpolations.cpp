@@ -34,6 +34,8 @@
 #include <ql/math/interpolations/kernelinterpolation.hpp>
 #include <ql/math/interpolations/kernelinterpolation2d.hpp>
 #include <ql/math/interpolations/bicubicsplineinterpolation.hpp>
+#include <ql/math/interpolations/bilinearinterpolation.hpp>
+#include <ql/math/interpolations/loginterpolation.hpp>
 #include <ql/math/integrals/simpsonintegral.hpp>
 #include <ql/math/kernelfunctions.hpp>
 #include <ql/math/functional.hpp>
@@ -1981,6 +1983,129 @@ void InterpolationTest::testTransformations() {
 
 }
 
+namespace {
+
+    void checkBatchValues(const std::string& name,
+                          const Interpolation& f,
+                          const std::vector<Real>& x) {
+        std::vector<Real> y(x.size());
+        f.values(&x[0], &x[0]+x.size(), &y[0], true);
+        // any initial hint is valid
+        Size hint = 1000;
+        for (Size i=0; i<x.size(); ++i) {
+            Real expected = f(x[i], true);
+            if (y[i] != expected)
+                BOOST_ERROR(name << " interpolation: "
+                            << "batch value differs from single value"
+                            << std::setprecision(16)
+                            << "\n    x:          " << x[i]
+                            << "\n    batch:      " << y[i]
+                            << "\n    single:     " << expected);
+            Real hinted = f(x[i], hint, true);
+            if (hinted != expected)
+                BOOST_ERROR(name << " interpolation: "
+                            << "hinted value differs from single value"
+                            << std::setprecision(16)
+                            << "\n    x:          " << x[i]
+                            << "\n    hinted:     " << hinted
+                            << "\n    single:     " << expected);
+        }
+    }
+
+    void checkBatchValues(const std::string& name,
+                          const Interpolation2D& f,
+                          const std::vector<Real>& x,
+                          const std::vector<Real>& y) {
+        std::vector<Real> z(x.size());
+        f.values(&x[0], &x[0]+x.size(), &y[0], &z[0], true);
+        for (Size i=0; i<x.size(); ++i) {
+            Real expected = f(x[i], y[i], true);
+            if (z[i] != expected)
+                BOOST_ERROR(name << " interpolation: "
+                            << "batch value differs from single value"
+                            << std::setprecision(16)
+                            << "\n    x:          " << x[i]
+                            << "\n    y:          " << y[i]
+                            << "\n    batch:      " << z[i]
+                            << "\n    single:     " << expected);
+        }
+    }
+
+}
+
+void InterpolationTest::testBatchValues() {
+
+    BOOST_TEST_MESSAGE("Testing batch and hinted evaluation "
+                       "of interpolations...");
+
+    Real xData[] = { 0.0, 0.5, 1.2, 2.0, 3.5, 5.0, 5.5 };
+    Real yData[] = { 1.0, 1.3, 0.8, 1.1, 1.6, 1.4, 0.9 };
+    const Size n = LENGTH(xData);
+    std::vector<Real> xs(xData, xData+n), ys(yData, yData+n);
+
+    // sorted points, including the nodes and points outside the
+    // range, followed by the same points in scrambled order
+    std::vector<Real> x;
+    for (Size i=0; i<=130; ++i)
+        x.push_back(-0.5 + 0.05*i);
+    x.insert(x.end(), xs.begin(), xs.end());
+    std::sort(x.begin(), x.end());
+    const Size m = x.size();
+    for (Size i=0; i<m; ++i)
+        x.push_back(x[(i*37) % m]);
+
+    checkBatchValues("linear", LinearInterpolation(xs.begin(), xs.end(), ys.begin()), x);
+    checkBatchValues("log-linear", LogLinearInterpolation(xs.begin(), xs.end(), ys.begin()), x);
+    checkBatchValues("cubic", CubicNaturalSpline(xs.begin(), xs.end(), ys.begin()), x);
+    checkBatchValues("monotonic cubic",
+                     MonotonicCubicNaturalSpline(xs.begin(), xs.end(), ys.begin()), x);
+    checkBatchValues("forward-flat",
+                     ForwardFlatInterpolation(xs.begin(), xs.end(), ys.begin()), x);
+    checkBatchValues("backward-flat",
+                     BackwardFlatInterpolation(xs.begin(), xs.end(), ys.begin()), x);
+
+    // the range is checked for each point
+    LinearInterpolation f(xs.begin(), xs.end(), ys.begin());
+    std::vector<Real> y(x.size());
+    bool failed = false;
+    try {
+        f.values(&x[0], &x[0]+x.size(), &y[0]);
+    } catch (Error&) {
+        failed = true;
+    }
+    if (!failed)
+        BOOST_ERROR("batch evaluation out of range did not fail");
+
+    Real rData[] = { 1.0, 2.0, 4.0, 7.0 };
+    std::vector<Real> rs(rData, rData+LENGTH(rData));
+    Matrix z(rs.size(), n);
+    for (Size i=0; i<z.rows(); ++i)
+        for (Size j=0; j<z.columns(); ++j)
+            z[i][j] = std::sin(0.3*rs[i] + 0.7*xs[j]);
+
+    // rows of points with the same x and other points
+    std::vector<Real> px, py;
+    for (Size i=0; i<=24; ++i) {
+        for (Size j=0; j<=16; ++j) {
+            px.push_back(-0.25 + 0.25*i);
+            py.push_back(0.5 + 0.5*j);
+        }
+    }
+    for (Size i=0; i<px.size(); i+=3) {
+        px.push_back(px[(i*41) % px.size()]);
+        py.push_back(py[(i*7) % py.size()]);
+    }
+
+    checkBatchValues("bilinear",
+                     BilinearInterpolation(xs.begin(), xs.end(),
+                                           rs.begin(), rs.end(), z),
+                     px, py);
+    checkBatchValues("bicubic",
+                     BicubicSpline(xs.begin(), xs.end(),
+                                   rs.begin(), rs.end(), z),
+                     px, py);
+}
+
 test_suite* InterpolationTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("Interpolation tests");
 
@@ -2013,5 +2138,6 @@ test_suite* InterpolationTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testNoArbSabrInterpolation));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testSabrSingleCases));
     suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testTransformations));
+    suite->add(QUANTLIB_TEST_CASE(&InterpolationTest::testBatchValues));
     return suite;
 }
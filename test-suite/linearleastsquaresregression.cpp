@@ -23,6 +23,7 @@
 #include <ql/math/functional.hpp>
 #include <ql/math/randomnumbers/rngtraits.hpp>
 #include <ql/math/linearleastsquaresregression.hpp>
+#include <ql/math/incrementallinearleastsquares.hpp>
 #if defined(__GNUC__) && (((__GNUC__ == 4) && (__GNUC_MINOR__ >= 8)) || (__GNUC__ > 4))
 #pragma GCC diagnostic push
 #pragma GCC diagnostic ignored "-Wunused-local-typedefs"
@@ -249,6 +250,60 @@ void LinearLeastSquaresRegressionTest::test1dLinearRegression() {
     }    
 }
 
+void LinearLeastSquaresRegressionTest::testIncrementalRegression() {
+
+    BOOST_TEST_MESSAGE("Testing incremental linear least-squares regression...");
+
+    SavedSettings backup;
+
+    const Real tolerance = 1.0e-10;
+
+    const Size nr=10000;
+    PseudoRandom::rng_type rng(PseudoRandom::urng_type(1234u));
+
+    std::vector<boost::function1<Real, Real> > v;
+    v.push_back(constant<Real, Real>(1.0));
+    v.push_back(identity<Real>());
+    v.push_back(square<Real>());
+    v.push_back(std::ptr_fun<Real, Real>(std::sin));
+
+    // rank-deficient basis
+    std::vector<boost::function1<Real, Real> > w(v);
+    w.push_back(square<Real>());
+
+    std::vector<Real> x(nr), y(nr);
+    for (Size i=0; i<nr; ++i) {
+        x[i] = rng.next().value;
+        y[i] = 0.5 - 0.3*x[i] + 0.2*x[i]*x[i] + std::sin(x[i])
+            + rng.next().value;
+    }
+
+    for (Size k=0; k<2; ++k) {
+        const std::vector<boost::function1<Real, Real> >& basis =
+            (k == 0) ? v : w;
+        const GeneralLinearLeastSquares expected(x, y, basis);
+
+        IncrementalLinearLeastSquares m(basis.size());
+        Array values(basis.size());
+        for (Size i=0; i<nr; ++i) {
+            for (Size j=0; j<basis.size(); ++j)
+                values[j] = basis[j](x[i]);
+            m.add(values.begin(), y[i]);
+        }
+
+        const Array calculated = m.coefficients();
+        for (Size j=0; j<basis.size(); ++j) {
+            if (std::fabs(calculated[j]-expected.coefficients()[j])
+                                                            > tolerance) {
+                BOOST_ERROR("Failed to reproduce regression coefficients"
+                    << "\n    calculated: " << calculated[j]
+                    << "\n    expected:   " << expected.coefficients()[j]
+                    << "\n    tolerance:  " << tolerance);
+            }
+        }
+    }
+}
+
 
 test_suite* LinearLeastSquaresRegressionTest::suite() {
     test_suite* suite =
@@ -259,6 +314,8 @@ test_suite* LinearLeastSquaresRegressionTest::suite() {
         &LinearLeastSquaresRegressionTest::testMultiDimRegression));
     suite->add(QUANTLIB_TEST_CASE(
         &LinearLeastSquaresRegressionTest::test1dLinearRegression));
+    suite->add(QUANTLIB_TEST_CASE(
+        &LinearLeastSquaresRegressionTest::testIncrementalRegression));
     return suite;
 }
 
@@ -30,6 +30,7 @@
 #include <ql/math/randomnumbers/randomizedlds.hpp>
 #include <ql/math/randomnumbers/randomsequencegenerator.hpp>
 #include <ql/math/randomnumbers/sobolrsg.hpp>
+#include <ql/math/randomnumbers/sobolbrownianbridgersg.hpp>
 #include <ql/utilities/dataformatters.hpp>
 #include <boost/progress.hpp>
 #include <ql/math/randomnumbers/latticerules.hpp>
@@ -1093,6 +1094,79 @@ void LowDiscrepancyTest::testSobolSkipping() {
     }
 }
 
+void LowDiscrepancyTest::testSobolBlocks() {
+
+    BOOST_TEST_MESSAGE("Testing Sobol sequences drawn in blocks...");
+
+    unsigned long seed = 42;
+    Size dimensionality[] = { 1, 10, 100, 1000 };
+    unsigned long skip[] = { 0, 42, 100000 };
+    Size blocks[] = { 1, 7, 64, 100 };
+
+    for (Size j=0; j<LENGTH(dimensionality); j++) {
+        for (Size k=0; k<LENGTH(skip); k++) {
+            const Size d = dimensionality[j];
+
+            SobolRsg rsg1(d, seed, SobolRsg::JoeKuoD7);
+            SobolRsg rsg2(d, seed, SobolRsg::JoeKuoD7);
+            rsg1.skipTo(skip[k]);
+            rsg2.skipTo(skip[k]);
+
+            for (Size l=0; l<LENGTH(blocks); l++) {
+                const Size n = blocks[l];
+                std::vector<unsigned long> s2(n*d);
+                std::vector<Real> x2(n*d);
+                rsg2.nextInt32Sequences(n, &s2[0]);
+                for (Size m=0; m<n; m++) {
+                    const std::vector<unsigned long>& s1 =
+                        rsg1.nextInt32Sequence();
+                    for (Size i=0; i<d; i++) {
+                        if (s1[i] != s2[m*d+i])
+                            BOOST_ERROR("Mismatch in block:"
+                                        << "\n  size:     " << d
+                                        << "\n  skipped:  " << skip[k]
+                                        << "\n  point:    " << m
+                                        << "\n  at index: " << i
+                                        << "\n  expected: " << s1[i]
+                                        << "\n  found:    " << s2[m*d+i]);
+                    }
+                }
+                rsg2.nextSequences(n, &x2[0]);
+                for (Size m=0; m<n; m++) {
+                    const std::vector<Real>& x1 = rsg1.nextSequence().value;
+                    for (Size i=0; i<d; i++) {
+                        if (x1[i] != x2[m*d+i])
+                            BOOST_ERROR("Mismatch in block:"
+                                        << "\n  size:     " << d
+                                        << "\n  skipped:  " << skip[k]
+                                        << "\n  point:    " << m
+                                        << "\n  at index: " << i
+                                        << "\n  expected: " << x1[i]
+                                        << "\n  found:    " << x2[m*d+i]);
+                    }
+                }
+            }
+        }
+    }
+
+    Size factors = 5, steps = 12, n = 100;
+    SobolBrownianBridgeRsg bridge1(factors, steps);
+    SobolBrownianBridgeRsg bridge2(factors, steps);
+    std::vector<Real> z2(n*factors*steps);
+    bridge2.nextSequences(n, &z2[0]);
+    for (Size m=0; m<n; m++) {
+        const std::vector<Real>& z1 = bridge1.nextSequence().value;
+        for (Size i=0; i<factors*steps; i++) {
+            if (z1[i] != z2[m*factors*steps+i])
+                BOOST_ERROR("Mismatch in Brownian-bridge block:"
+                            << "\n  path:     " << m
+                            << "\n  at index: " << i
+                            << "\n  expected: " << z1[i]
+                            << "\n  found:    " << z2[m*factors*steps+i]);
+        }
+    }
+}
+
 
 test_suite* LowDiscrepancyTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("Low-discrepancy sequence tests");
@@ -1131,6 +1205,7 @@ test_suite* LowDiscrepancyTest::suite() {
            &LowDiscrepancyTest::testSobolLevitanLemieuxSobolDiscrepancy));
 
     suite->add(QUANTLIB_TEST_CASE(&LowDiscrepancyTest::testSobolSkipping));
+    suite->add(QUANTLIB_TEST_CASE(&LowDiscrepancyTest::testSobolBlocks));
 
     suite->add(QUANTLIB_TEST_CASE(
            &LowDiscrepancyTest::testRandomizedLowDiscrepancySequence));
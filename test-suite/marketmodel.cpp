@@ -42,6 +42,7 @@ FOR A PARTICULAR PURPOSE.  See the license for more details.
 #include <ql/models/marketmodels/evolvers/lognormalfwdrateipc.hpp>
 #include <ql/models/marketmodels/evolvers/lognormalfwdrateballand.hpp>
 #include <ql/models/marketmodels/evolvers/lognormalfwdratepc.hpp>
+#include <ql/models/marketmodels/evolvers/lognormalfwdrateblockpc.hpp>
 #include <ql/models/marketmodels/evolvers/normalfwdratepc.hpp>
 #include <ql/models/marketmodels/discounter.hpp>
 #include <ql/models/marketmodels/models/abcdvol.hpp>
@@ -427,7 +428,7 @@ namespace {
             return result;
     }
 
-    enum EvolverType { Ipc, Balland, Pc, NormalPc};
+    enum EvolverType { Ipc, Balland, Pc, NormalPc, BlockPc };
 
     std::string evolverTypeToString(EvolverType type) {
         switch (type) {
@@ -439,6 +440,8 @@ namespace {
               return "predictor corrector";
           case NormalPc:
               return "predictor corrector for normal case";
+          case BlockPc:
+              return "predictor corrector on blocks of paths";
           default:
               QL_FAIL("unknown MarketModelEvolver type");
         }
@@ -467,6 +470,10 @@ namespace {
               return boost::shared_ptr<MarketModelEvolver>(
                   new NormalFwdRatePc(marketModel, generatorFactory,
                   numeraires, initialStep));
+          case BlockPc:
+              return boost::shared_ptr<MarketModelEvolver>(
+                  new LogNormalFwdRateBlockPc(marketModel, generatorFactory,
+                  numeraires, initialStep));
           default:
               QL_FAIL("unknown MarketModelEvolver type");
             }
@@ -767,7 +774,7 @@ void MarketModelTest::testOneStepForwardsAndOptionlets() {
                     boost::shared_ptr<MarketModel> marketModel =
                         makeMarketModel(logNormal, evolution, factors, marketModels[j]);
 
-                    EvolverType evolvers[] = { Pc,  Balland, Ipc};
+                    EvolverType evolvers[] = { Pc, BlockPc, Balland, Ipc };
                     boost::shared_ptr<MarketModelEvolver> evolver;
                     Size stop =
                         isInTerminalMeasure(evolution, numeraires) ? 0 : 1;
@@ -1425,6 +1432,140 @@ void MarketModelTest::testPeriodAdapter() {
         }
     }
 }
+
+void MarketModelTest::testParallelAccountingEngine() {
+
+    BOOST_TEST_MESSAGE("Testing parallel simulation "
+                       "in the market-model accounting engine...");
+
+    setup();
+
+    std::vector<boost::shared_ptr<Payoff> > payoffs(todaysForwards.size());
+    for (Size i=0; i<todaysForwards.size(); ++i)
+        payoffs[i] = boost::shared_ptr<Payoff>(new
+            PlainVanillaPayoff(Option::Call, todaysForwards[i]));
+    MultiStepOptionlets product(rateTimes, accruals, paymentTimes, payoffs);
+
+    EvolutionDescription evolution = product.evolution();
+    std::vector<Size> numeraires = makeMeasure(product, MoneyMarket);
+    boost::shared_ptr<MarketModel> marketModel =
+        makeMarketModel(true, evolution, 3,
+                        ExponentialCorrelationAbcdVolatility);
+    Real initialNumeraireValue = todaysDiscounts[numeraires.front()];
+
+    MTBrownianGeneratorFactory mtFactory(seed_);
+    SobolBrownianGeneratorFactory sobolFactory(
+                                    SobolBrownianGenerator::Diagonal, seed_);
+    const BrownianGeneratorFactory* factories[] = { &mtFactory,
+                                                    &sobolFactory };
+    std::string names[] = { "MT", "Sobol" };
+
+    // the parallel engine is called twice to check that the
+    // sequence is continued correctly between calls
+    Size paths = 5000, firstPaths = 1999, workers = 3;
+
+    for (Size k=0; k<LENGTH(factories); ++k) {
+        AccountingEngine serialEngine(
+                 makeMarketModelEvolver(marketModel, numeraires,
+                                        *factories[k], Pc),
+                 product, initialNumeraireValue);
+        SequenceStatisticsInc serialStats(product.numberOfProducts());
+        serialEngine.multiplePathValues(serialStats, paths);
+
+        std::vector<boost::shared_ptr<MarketModelEvolver> > evolvers;
+        for (Size w=0; w<workers; ++w)
+            evolvers.push_back(makeMarketModelEvolver(marketModel, numeraires,
+                                                      *factories[k], Pc));
+        AccountingEngine parallelEngine(evolvers, product,
+                                        initialNumeraireValue);
+        SequenceStatisticsInc parallelStats(product.numberOfProducts());
+        parallelEngine.multiplePathValues(parallelStats, firstPaths);
+        parallelEngine.multiplePathValues(parallelStats, paths-firstPaths);
+
+        std::vector<Real> serialMeans = serialStats.mean();
+        std::vector<Real> parallelMeans = parallelStats.mean();
+        std::vector<Real> serialErrors = serialStats.errorEstimate();
+        std::vector<Real> parallelErrors = parallelStats.errorEstimate();
+        for (Size i=0; i<product.numberOfProducts(); ++i) {
+            if (serialMeans[i] != parallelMeans[i]
+                || serialErrors[i] != parallelErrors[i])
+                BOOST_ERROR("parallel and serial simulations differ"
+                            << "\n    generator:      " << names[k]
+                            << "\n    product:        " << i
+                            << std::setprecision(16)
+                            << "\n    serial mean:    " << serialMeans[i]
+                            << "\n    parallel mean:  " << parallelMeans[i]
+                            << "\n    serial error:   " << serialErrors[i]
+                            << "\n    parallel error: " << parallelErrors[i]);
+        }
+    }
+}
+
+void MarketModelTest::testBlockEvolver() {
+
+    BOOST_TEST_MESSAGE("Testing predictor-corrector evolver "
+                       "on blocks of paths...");
+
+    setup();
+
+    std::vector<boost::shared_ptr<Payoff> > payoffs(todaysForwards.size());
+    for (Size i=0; i<todaysForwards.size(); ++i)
+        payoffs[i] = boost::shared_ptr<Payoff>(new
+            PlainVanillaPayoff(Option::Call, todaysForwards[i]));
+    MultiStepOptionlets product(rateTimes, accruals, paymentTimes, payoffs);
+    EvolutionDescription evolution = product.evolution();
+
+    MTBrownianGeneratorFactory generatorFactory(seed_);
+    // not a multiple of the block size
+    Size paths = 1000;
+    Real tolerance = 1.0e-12;
+
+    MeasureType measures[] = { MoneyMarket, Terminal };
+    Size factors[] = { 3, todaysForwards.size() };
+    for (Size k=0; k<LENGTH(measures); ++k) {
+        std::vector<Size> numeraires = makeMeasure(product, measures[k]);
+        Real initialNumeraireValue = todaysDiscounts[numeraires.front()];
+        for (Size m=0; m<LENGTH(factors); ++m) {
+            boost::shared_ptr<MarketModel> marketModel =
+                makeMarketModel(true, evolution, factors[m],
+                                ExponentialCorrelationAbcdVolatility);
+
+            AccountingEngine engine(
+                 makeMarketModelEvolver(marketModel, numeraires,
+                                        generatorFactory, Pc),
+                 product, initialNumeraireValue);
+            SequenceStatisticsInc stats(product.numberOfProducts());
+            engine.multiplePathValues(stats, paths);
+
+            // the block evolvers are also used in parallel, which
+            // exercises skipping paths within and across blocks
+            std::vector<boost::shared_ptr<MarketModelEvolver> > evolvers(2);
+            for (Size w=0; w<evolvers.size(); ++w)
+                evolvers[w] = makeMarketModelEvolver(marketModel, numeraires,
+                                                     generatorFactory,
+                                                     BlockPc);
+            AccountingEngine blockEngine(evolvers, product,
+                                         initialNumeraireValue);
+            SequenceStatisticsInc blockStats(product.numberOfProducts());
+            blockEngine.multiplePathValues(blockStats, paths);
+
+            std::vector<Real> means = stats.mean();
+            std::vector<Real> blockMeans = blockStats.mean();
+            for (Size i=0; i<product.numberOfProducts(); ++i) {
+                if (std::fabs(means[i]-blockMeans[i]) > tolerance*means[i])
+                    BOOST_ERROR("block and path-wise evolvers differ"
+                                << "\n    measure:     "
+                                << measureTypeToString(measures[k])
+                                << "\n    factors:     " << factors[m]
+                                << "\n    product:     " << i
+                                << std::setprecision(16)
+                                << "\n    path-wise:   " << means[i]
+                                << "\n    block:       " << blockMeans[i]);
+            }
+        }
+    }
+}
+
 void MarketModelTest::testCallableSwapNaif() {
 
     BOOST_TEST_MESSAGE("Pricing callable swap with naif exercise strategy in a LIBOR market model...");
@@ -4887,6 +5028,8 @@ test_suite* MarketModelTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testOneStepForwardsAndOptionlets));
     suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testOneStepNormalForwardsAndOptionlets));
 
+    suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testParallelAccountingEngine));
+    suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testBlockEvolver));
     suite->add(QUANTLIB_TEST_CASE(&MarketModelTest::testCallableSwapNaif));
 
     MarketModelType marketModels[] = {
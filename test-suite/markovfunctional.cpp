@@ -1752,6 +1752,134 @@ void MarkovFunctionalTest::testBermudanSwaption() {
     Settings::instance().evaluationDate() = savedEvalDate;
 }
 
+void MarkovFunctionalTest::testDigitalTables() {
+
+    BOOST_TEST_MESSAGE("Testing Markov functional calibration with tabulated "
+                       "market digitals...");
+
+    SavedSettings backup;
+    Date referenceDate(14, November, 2012);
+    Settings::instance().evaluationDate() = referenceDate;
+
+    Handle<YieldTermStructure> md0Yts_ = md0Yts();
+    Handle<SwaptionVolatilityStructure> md0SwaptionVts_ = md0SwaptionVts();
+
+    boost::shared_ptr<SwapIndex> swapIndexBase(
+        new EuriborSwapIsdaFixA(1 * Years));
+
+    std::vector<Date> volStepDates;
+    std::vector<Real> vols;
+    vols.push_back(1.0);
+
+    boost::shared_ptr<MarkovFunctional> mf1(new MarkovFunctional(
+        md0Yts_, 0.01, volStepDates, vols, md0SwaptionVts_,
+        expiriesCalBasket1(), tenorsCalBasket1(), swapIndexBase,
+        MarkovFunctional::ModelSettings()));
+
+    boost::shared_ptr<MarkovFunctional> mf2(new MarkovFunctional(
+        md0Yts_, 0.01, volStepDates, vols, md0SwaptionVts_,
+        expiriesCalBasket1(), tenorsCalBasket1(), swapIndexBase,
+        MarkovFunctional::ModelSettings().addAdjustment(
+            MarkovFunctional::ModelSettings::TabulateDigitals)));
+
+    // the market swap rates are solved to the same accuracy, so the
+    // numeraire tabulations agree up to this accuracy
+
+    const Real tol = 1.0E-6;
+
+    for (Size i = 0; i < expiriesCalBasket1().size(); i++) {
+        Time t = md0Yts_->timeFromReference(expiriesCalBasket1()[i]);
+        for (Real y = -5.0; y <= 5.0; y += 0.5) {
+            Real n1 = mf1->numeraire(t, y);
+            Real n2 = mf2->numeraire(t, y);
+            if (fabs(n1 - n2) > tol * n1)
+                BOOST_ERROR("Numeraire at t=" << t << ", y=" << y
+                                              << " with tabulated digitals ("
+                                              << n2 << ") differs from "
+                                              << "untabulated one (" << n1
+                                              << ")");
+        }
+    }
+}
+
+void MarkovFunctionalTest::testArrayMethods() {
+
+    BOOST_TEST_MESSAGE("Testing Markov functional array methods...");
+
+    SavedSettings backup;
+    Date referenceDate(14, November, 2012);
+    Settings::instance().evaluationDate() = referenceDate;
+
+    Handle<YieldTermStructure> md0Yts_ = md0Yts();
+    Handle<SwaptionVolatilityStructure> md0SwaptionVts_ = md0SwaptionVts();
+
+    boost::shared_ptr<SwapIndex> swapIndexBase(
+        new EuriborSwapIsdaFixA(1 * Years));
+
+    std::vector<Date> volStepDates;
+    std::vector<Real> vols;
+    vols.push_back(1.0);
+
+    boost::shared_ptr<MarkovFunctional> mf(new MarkovFunctional(
+        md0Yts_, 0.01, volStepDates, vols, md0SwaptionVts_,
+        expiriesCalBasket1(), tenorsCalBasket1(), swapIndexBase,
+        MarkovFunctional::ModelSettings()));
+
+    // the array versions of zerobond, numeraire and forward rate are
+    // checked against the scalar ones, with the model curve and with
+    // an external curve
+
+    Handle<YieldTermStructure> yts2(boost::shared_ptr<YieldTermStructure>(
+        new FlatForward(0, TARGET(), 0.02, Actual365Fixed())));
+    boost::shared_ptr<IborIndex> iborIndex(new Euribor(6 * Months, yts2));
+
+    Array y(21);
+    for (Size i = 0; i < y.size(); i++)
+        y[i] = -5.0 + 0.5 * i;
+
+    const Real tol = 1.0E-12;
+
+    for (Size k = 0; k < expiriesCalBasket1().size(); k += 3) {
+        Date expiry = expiriesCalBasket1()[k];
+        Time t = md0Yts_->timeFromReference(expiry);
+        Array nm = mf->numeraire(t, y);
+        Array nm2 = mf->numeraire(t, y, yts2);
+        Array fwd = mf->forwardRate(expiry, expiry, y, iborIndex);
+        for (Time T = t + 0.5; T <= t + 10.0; T += 2.5) {
+            Array zb = mf->zerobond(T, t, y);
+            Array zb2 = mf->zerobond(T, t, y, yts2);
+            for (Size i = 0; i < y.size(); i++) {
+                Real zbVal = mf->zerobond(T, t, y[i]);
+                Real zb2Val = mf->zerobond(T, t, y[i], yts2);
+                if (fabs(zb[i] - zbVal) > tol * zbVal ||
+                    fabs(zb2[i] - zb2Val) > tol * zb2Val)
+                    BOOST_ERROR("Array version of zerobond P("
+                                << t << "," << T << " | y=" << y[i]
+                                << ") = " << zb[i] << " / " << zb2[i]
+                                << " differs from scalar version ("
+                                << zbVal << " / " << zb2Val << ")");
+            }
+        }
+        for (Size i = 0; i < y.size(); i++) {
+            Real nmVal = mf->numeraire(t, y[i]);
+            Real nm2Val = mf->numeraire(t, y[i], yts2);
+            Real fwdVal = mf->forwardRate(expiry, expiry, y[i], iborIndex);
+            if (fabs(nm[i] - nmVal) > tol * nmVal ||
+                fabs(nm2[i] - nm2Val) > tol * nm2Val)
+                BOOST_ERROR("Array version of numeraire N("
+                            << t << " | y=" << y[i] << ") = " << nm[i]
+                            << " / " << nm2[i]
+                            << " differs from scalar version ("
+                            << nmVal << " / " << nm2Val << ")");
+            if (fabs(fwd[i] - fwdVal) > tol)
+                BOOST_ERROR("Array version of forward rate F("
+                            << expiry << " | y=" << y[i] << ") = " << fwd[i]
+                            << " differs from scalar version ("
+                            << fwdVal << ")");
+        }
+    }
+}
+
 test_suite *MarkovFunctionalTest::suite() {
     test_suite *suite = BOOST_TEST_SUITE("Markov functional model tests");
     suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testMfStateProcess));
@@ -1763,5 +1891,7 @@ test_suite *MarkovFunctionalTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(
         &MarkovFunctionalTest::testCalibrationTwoInstrumentSets));
     suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testBermudanSwaption));
+    suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testDigitalTables));
+    suite->add(QUANTLIB_TEST_CASE(&MarkovFunctionalTest::testArrayMethods));
     return suite;
 }
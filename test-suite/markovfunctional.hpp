@@ -33,6 +33,8 @@ class MarkovFunctionalTest {
     static void testCalibrationTwoInstrumentSets();
     static void testVanillaEngines();
     static void testBermudanSwaption();
+    static void testDigitalTables();
+    static void testArrayMethods();
     static boost::unit_test_framework::test_suite *suite();
 };
 
@@ -144,6 +144,68 @@ void MatricesTest::testEigenvectors() {
     }
 }
 
+void MatricesTest::testTridiagonalEigenvectors() {
+
+    BOOST_TEST_MESSAGE("Testing Householder/QR eigenvalue calculation...");
+
+    setup();
+
+    const Size n = 30;
+    Matrix corr(n, n);
+    for (Size i=0; i<n; ++i)
+        for (Size j=0; j<n; ++j)
+            corr[i][j] = std::exp(-0.1*std::fabs(Real(i)-Real(j)));
+
+    Matrix testMatrices[] = { M1, M2, corr };
+
+    for (Size k=0; k<LENGTH(testMatrices); k++) {
+
+        Matrix& M = testMatrices[k];
+        const Size size = M.rows();
+        SymmetricSchurDecomposition jacobi(M);
+        SymmetricSchurDecomposition dec(
+                         M, SymmetricSchurDecomposition::TridiagonalQR);
+        Array eigenValues = dec.eigenvalues();
+        Matrix eigenVectors = dec.eigenvectors();
+
+        for (Size i=0; i<size; i++) {
+            if (std::fabs(eigenValues[i]-jacobi.eigenvalues()[i]) > 1.0e-12)
+                BOOST_FAIL("eigenvalue " << i << " differs from Jacobi one"
+                           << "\n    Householder/QR: " << eigenValues[i]
+                           << "\n    Jacobi:         "
+                           << jacobi.eigenvalues()[i]);
+            Array v(size);
+            for (Size j=0; j<size; j++)
+                v[j] = eigenVectors[j][i];
+            // check definition
+            Array a = M*v;
+            Array b = eigenValues[i]*v;
+            if (norm(a-b) > 1.0e-12)
+                BOOST_FAIL("Eigenvector definition not satisfied");
+        }
+
+        // check normalization
+        Matrix m = eigenVectors * transpose(eigenVectors);
+        Matrix id(size, size, 0.0);
+        for (Size i=0; i<size; i++)
+            id[i][i] = 1.0;
+        if (norm(m-id) > 1.0e-12)
+            BOOST_FAIL("Eigenvector not normalized");
+    }
+
+    // rank-reduced roots give the same covariance
+    Matrix jacobiRoot = rankReducedSqrt(corr, 5, 1.0,
+                                        SalvagingAlgorithm::None);
+    Matrix tqrRoot = rankReducedSqrt(corr, 5, 1.0,
+                                     SalvagingAlgorithm::None,
+                                     SymmetricSchurDecomposition::TridiagonalQR);
+    Matrix diff = jacobiRoot*transpose(jacobiRoot)
+        - tqrRoot*transpose(tqrRoot);
+    if (norm(diff) > 1.0e-10)
+        BOOST_FAIL("rank-reduced square roots differ"
+                   << "\n    difference norm: " << norm(diff));
+}
+
 void MatricesTest::testSqrt() {
 
     BOOST_TEST_MESSAGE("Testing matricial square root...");
@@ -601,11 +663,93 @@ void MatricesTest::testMoorePenroseInverse() {
 
 }
 
+void MatricesTest::testMultiplication() {
+
+    BOOST_TEST_MESSAGE("Testing matrix multiplication...");
+
+    MersenneTwisterUniformRng rng(1234);
+
+    // the sizes exercise all the remainders of the blocked product;
+    // in the last two, the inner dimension is larger than a panel
+    Size sizes[][3] = { { 1, 1, 1 }, { 3, 5, 2 }, { 4, 7, 16 },
+                        { 13, 9, 31 }, { 33, 20, 65 }, { 7, 300, 37 },
+                        { 120, 260, 90 } };
+
+    for (Size s=0; s<LENGTH(sizes); ++s) {
+        const Size m = sizes[s][0], l = sizes[s][1], n = sizes[s][2];
+        Matrix a(m, l), b(l, n);
+        for (Matrix::iterator i=a.begin(); i!=a.end(); ++i)
+            *i = 2.0*rng.next().value - 1.0;
+        for (Matrix::iterator i=b.begin(); i!=b.end(); ++i)
+            *i = 2.0*rng.next().value - 1.0;
+
+        const Matrix c = a*b;
+        Matrix d(m, n);
+        multiply(a, b, d);
+
+        // not exact: under QL_ENABLE_LAPACK, dgemm can sum the terms
+        // in a different order
+        const Real tol = 1.0e-13;
+        for (Size i=0; i<m; ++i) {
+            for (Size j=0; j<n; ++j) {
+                Real expected = 0.0;
+                for (Size k=0; k<l; ++k)
+                    expected += a[i][k]*b[k][j];
+                if (std::fabs(c[i][j]-expected) > tol
+                    || std::fabs(d[i][j]-expected) > tol)
+                    BOOST_FAIL("failed to reproduce product of "
+                               << m << "x" << l << " and "
+                               << l << "x" << n << " matrices"
+                               << std::scientific
+                               << "\n    element:    " << i << ", " << j
+                               << "\n    operator*:  " << c[i][j]
+                               << "\n    multiply:   " << d[i][j]
+                               << "\n    expected:   " << expected
+                               << "\n    tolerance:  " << tol);
+            }
+        }
+    }
+
+    // larger matrices, checked against the properties of the product
+    const Size size = 400;
+    Matrix a(size, size), b(size, size), c(size, size);
+    for (Matrix::iterator i=a.begin(); i!=a.end(); ++i)
+        *i = 2.0*rng.next().value - 1.0;
+    for (Matrix::iterator i=b.begin(); i!=b.end(); ++i)
+        *i = 2.0*rng.next().value - 1.0;
+    for (Matrix::iterator i=c.begin(); i!=c.end(); ++i)
+        *i = 2.0*rng.next().value - 1.0;
+
+    const Real tol = 1.0e-12;
+
+    const Matrix ab = a*b;
+    const Matrix abc = ab*c;
+    Matrix bc(size, size), abc2(size, size);
+    multiply(b, c, bc);
+    multiply(a, bc, abc2);
+    Real error = norm(abc - abc2)/norm(abc);
+    if (error > tol)
+        BOOST_FAIL("matrix product is not associative"
+                   << std::scientific
+                   << "\n    relative error: " << error
+                   << "\n    tolerance:      " << tol);
+
+    error = norm(transpose(ab) - transpose(b)*transpose(a))/norm(ab);
+    if (error > tol)
+        BOOST_FAIL("transpose of matrix product is not the product "
+                   "of transposes"
+                   << std::scientific
+                   << "\n    relative error: " << error
+                   << "\n    tolerance:      " << tol);
+}
+
 test_suite* MatricesTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("Matrix tests");
 
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testOrthogonalProjection));
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testEigenvectors));
+    suite->add(QUANTLIB_TEST_CASE(
+                           &MatricesTest::testTridiagonalEigenvectors));
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testSqrt));
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testSVD));
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testHighamSqrt));
@@ -617,6 +761,7 @@ test_suite* MatricesTest::suite() {
     #endif
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testCholeskyDecomposition));
     suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testMoorePenroseInverse));
+    suite->add(QUANTLIB_TEST_CASE(&MatricesTest::testMultiplication));
     return suite;
 }
 
@@ -30,6 +30,7 @@
 class MatricesTest {
   public:
     static void testEigenvectors();
+    static void testTridiagonalEigenvectors();
     static void testSqrt();
     static void testHighamSqrt();
     static void testSVD();
@@ -40,6 +41,7 @@ class MatricesTest {
     static void testOrthogonalProjection();
     static void testCholeskyDecomposition();
     static void testMoorePenroseInverse();
+    static void testMultiplication();
     static boost::unit_test_framework::test_suite* suite();
 };
 
@@ -315,6 +315,66 @@ void MCLongstaffSchwartzEngineTest::testAmericanMaxOption() {
     }
 }
 
+void MCLongstaffSchwartzEngineTest::testBasisValues() {
+
+    BOOST_TEST_MESSAGE("Testing evaluation of whole LSM basis systems...");
+
+    const LsmBasisSystem::PolynomType polynomTypes[]
+        = { LsmBasisSystem::Monomial, LsmBasisSystem::Laguerre,
+            LsmBasisSystem::Hermite, LsmBasisSystem::Hyperbolic,
+            LsmBasisSystem::Legendre, LsmBasisSystem::Chebyshev,
+            LsmBasisSystem::Chebyshev2nd };
+    const Real tolerance = 1.0e-14;
+
+    for (Size i=0; i<LENGTH(polynomTypes); ++i) {
+        for (Size order=0; order<5; ++order) {
+            const std::vector<boost::function1<Real, Real> > v =
+                LsmBasisSystem::pathBasisSystem(order, polynomTypes[i]);
+            const LsmPathBasis basis(order, polynomTypes[i]);
+            QL_REQUIRE(basis.size() == v.size(), "wrong basis size");
+
+            Array values(basis.size());
+            for (Real x=-0.9; x<1.0; x+=0.3) {
+                basis.values(x, values.begin());
+                for (Size l=0; l<v.size(); ++l) {
+                    const Real expected = v[l](x);
+                    if (std::fabs(values[l]-expected)
+                        > tolerance*std::max(1.0, std::fabs(expected)))
+                        BOOST_ERROR("Failed to reproduce basis function "
+                                    << l << " of order " << order
+                                    << " polynomials of type "
+                                    << polynomTypes[i] << " at " << x
+                                    << "\n    expected:   " << expected
+                                    << "\n    calculated: " << values[l]);
+                }
+            }
+
+            const Size dim = 3;
+            const std::vector<boost::function1<Real, Array> > w =
+                LsmBasisSystem::multiPathBasisSystem(dim, order,
+                                                     polynomTypes[i]);
+            const LsmMultiPathBasis multiBasis(dim, order, polynomTypes[i]);
+            QL_REQUIRE(multiBasis.size() == w.size(), "wrong basis size");
+
+            Array state(dim);
+            state[0] = 0.3; state[1] = -0.5; state[2] = 0.8;
+            Array multiValues(multiBasis.size());
+            multiBasis.values(state, multiValues.begin());
+            for (Size l=0; l<w.size(); ++l) {
+                const Real expected = w[l](state);
+                if (std::fabs(multiValues[l]-expected)
+                    > tolerance*std::max(1.0, std::fabs(expected)))
+                    BOOST_ERROR("Failed to reproduce multi-dimensional "
+                                "basis function " << l << " of order "
+                                << order << " polynomials of type "
+                                << polynomTypes[i]
+                                << "\n    expected:   " << expected
+                                << "\n    calculated: " << multiValues[l]);
+            }
+        }
+    }
+}
+
 test_suite* MCLongstaffSchwartzEngineTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("Longstaff Schwartz MC engine tests");
     // FLOATING_POINT_EXCEPTION
@@ -322,6 +382,8 @@ test_suite* MCLongstaffSchwartzEngineTest::suite() {
          &MCLongstaffSchwartzEngineTest::testAmericanOption));
     suite->add(QUANTLIB_TEST_CASE(
          &MCLongstaffSchwartzEngineTest::testAmericanMaxOption));
+    suite->add(QUANTLIB_TEST_CASE(
+         &MCLongstaffSchwartzEngineTest::testBasisValues));
     return suite;
 }
 
@@ -122,10 +122,52 @@ void NoArbSabrTest::testConsistencyWithHagan() {
 
 }
 
+void NoArbSabrTest::testPriceTable() {
+
+    BOOST_TEST_MESSAGE("Testing no-arbitrage Sabr price table against "
+                       "direct integration...");
+
+    // tau, forward, alpha, beta, nu, rho
+    Real params[][6] = { { 1.0, 0.0488, 0.026, 0.5, 0.4, -0.1 },
+                         { 5.0, 0.03, 0.035, 0.4, 0.3, 0.2 },
+                         { 10.0, 0.02, 0.05, 0.3, 0.6, -0.4 },
+                         { 0.5, 0.04, 0.1, 0.8, 0.2, 0.5 } };
+
+    Real tolerance = 1E-7;
+
+    for (Size i = 0; i < LENGTH(params); ++i) {
+        NoArbSabrModel direct(params[i][0], params[i][1], params[i][2],
+                              params[i][3], params[i][4], params[i][5]);
+        NoArbSabrModel tabulated(params[i][0], params[i][1], params[i][2],
+                                 params[i][3], params[i][4], params[i][5],
+                                 true);
+        if (!tabulated.priceTable() || direct.priceTable())
+            BOOST_ERROR("price table flag not honoured");
+        Real forward = params[i][1];
+        for (Real strike = 0.0; strike < 5.0 * forward;
+             strike += 0.05 * forward) {
+            Real p1 = direct.optionPrice(strike);
+            Real p2 = tabulated.optionPrice(strike);
+            if (std::fabs(p1 - p2) > tolerance)
+                BOOST_ERROR("tabulated price ("
+                            << p2 << ") differs from direct integration ("
+                            << p1 << ") at strike " << strike
+                            << ", parameter set " << i);
+            Real d1 = direct.digitalOptionPrice(strike);
+            Real d2 = tabulated.digitalOptionPrice(strike);
+            if (std::fabs(d1 - d2) > tolerance * 10.0 / forward)
+                BOOST_ERROR("tabulated digital price ("
+                            << d2 << ") differs from direct integration ("
+                            << d1 << ") at strike " << strike
+                            << ", parameter set " << i);
+        }
+    }
+}
 
 test_suite* NoArbSabrTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("NoArbSabrModel tests");
     suite->add(QUANTLIB_TEST_CASE(&NoArbSabrTest::testAbsorptionMatrix));
     suite->add(QUANTLIB_TEST_CASE(&NoArbSabrTest::testConsistencyWithHagan));
+    suite->add(QUANTLIB_TEST_CASE(&NoArbSabrTest::testPriceTable));
     return suite;
 }
@@ -829,6 +829,146 @@ void OptionletStripperTest::testSwitchStrike() {
                    << "\ntolerance:     " << io::rate(vars.tolerance));
 }
 
+void OptionletStripperTest::testIncrementalStripping() {
+    BOOST_TEST_MESSAGE("Testing incremental stripping of a 20x30 cap "
+                       "volatility surface using OptionletStripper1 class...");
+
+    CommonVars vars;
+    Settings::instance().evaluationDate() = Date(28, October, 2013);
+    vars.setTermStructure();
+
+    std::vector<Period> optionTenors(30);
+    for (Size i = 0; i < optionTenors.size(); ++i)
+        optionTenors[i] = Period(i + 1, Years);
+    std::vector<Rate> strikes(20);
+    for (Size j = 0; j < strikes.size(); ++j)
+        strikes[j] = 0.01 + 0.0025 * j;
+
+    std::vector<std::vector<boost::shared_ptr<SimpleQuote> > > quotes(
+        optionTenors.size(),
+        std::vector<boost::shared_ptr<SimpleQuote> >(strikes.size()));
+    std::vector<std::vector<Handle<Quote> > > handles(
+        optionTenors.size(), std::vector<Handle<Quote> >(strikes.size()));
+    for (Size i = 0; i < optionTenors.size(); ++i) {
+        for (Size j = 0; j < strikes.size(); ++j) {
+            // a simple smile flattening out with maturity
+            Real m = strikes[j] - 0.04;
+            quotes[i][j] = boost::shared_ptr<SimpleQuote>(new SimpleQuote(
+                0.15 + 25.0 * m * m / std::sqrt(i + 1.0) + 0.02 / (i + 1.0)));
+            handles[i][j] = Handle<Quote>(quotes[i][j]);
+        }
+    }
+
+    boost::shared_ptr<CapFloorTermVolSurface> surface(
+        new CapFloorTermVolSurface(0, vars.calendar, Following, optionTenors,
+                                   strikes, handles, vars.dayCounter));
+
+    shared_ptr<IborIndex> iborIndex(new Euribor6M(vars.yieldTermStructure));
+
+    boost::shared_ptr<OptionletStripper1> stripper(new OptionletStripper1(
+        surface, iborIndex, Null<Rate>(), vars.accuracy));
+
+    Size n = stripper->optionletMaturities();
+
+    // the solver starts from different guesses in the incremental and
+    // in the fresh stripper, so that they agree only within the accuracy
+    // on the standard deviations, i.e., a few times it on volatilities
+    Real tolerance = 10.0 * vars.accuracy;
+
+    // move a single quote at a time: the last one, an interior tenor,
+    // and an interior tenor and strike.  Bumps are kept small so that
+    // the caplet prices of the following tenors stay positive.
+    Size lastStrike = strikes.size() - 1;
+    Size bumpedTenors[] = { optionTenors.size() - 1, 12, 12 };
+    Size bumpedStrikes[] = { lastStrike, lastStrike, 10 };
+    boost::shared_ptr<OptionletStripper1> freshStripper;
+    for (Size b = 0; b < LENGTH(bumpedTenors); ++b) {
+        Size bumpedTenor = bumpedTenors[b], bumpedStrike = bumpedStrikes[b];
+
+        std::vector<std::vector<Volatility> > before(n);
+        for (Size i = 0; i < n; ++i)
+            before[i] = stripper->optionletVolatilities(i);
+
+        quotes[bumpedTenor][bumpedStrike]->setValue(
+                   quotes[bumpedTenor][bumpedStrike]->value() + 0.001);
+
+        std::vector<std::vector<Volatility> > after(n);
+        for (Size i = 0; i < n; ++i)
+            after[i] = stripper->optionletVolatilities(i);
+
+        freshStripper = boost::shared_ptr<OptionletStripper1>(new
+            OptionletStripper1(surface, iborIndex, Null<Rate>(),
+                               vars.accuracy));
+
+        bool bumpSeen = false;
+        for (Size i = 0; i < n; ++i) {
+            const std::vector<Volatility>& fresh =
+                freshStripper->optionletVolatilities(i);
+            for (Size j = 0; j < strikes.size(); ++j) {
+                // when the last strike is bumped, the spline interpolation
+                // of the surface reproduces the other strike nodes exactly
+                // and only the bumped strike is re-stripped; otherwise,
+                // the other strikes might change by round-off and are
+                // only checked against the full stripping
+                if (bumpedStrike == lastStrike && j != bumpedStrike
+                    && after[i][j] != before[i][j])
+                    BOOST_FAIL("\nunchanged strike re-stripped:"
+                               << "\noptionlet:  " << i
+                               << "\nstrike:     " << io::rate(strikes[j])
+                               << "\nbefore:     "
+                               << io::volatility(before[i][j])
+                               << "\nafter:      "
+                               << io::volatility(after[i][j]));
+                if (j == bumpedStrike && after[i][j] != before[i][j])
+                    bumpSeen = true;
+                Real error = std::fabs(after[i][j] - fresh[j]);
+                if (error > tolerance)
+                    BOOST_FAIL("\nincremental and full stripping differ:"
+                               << "\nbumped tenor:  "
+                               << optionTenors[bumpedTenor]
+                               << "\nbumped strike: "
+                               << io::rate(strikes[bumpedStrike])
+                               << "\noptionlet:     " << i
+                               << "\nstrike:        " << io::rate(strikes[j])
+                               << "\nincremental:   "
+                               << io::volatility(after[i][j])
+                               << "\nfull:          "
+                               << io::volatility(fresh[j])
+                               << "\nerror:         " << error
+                               << "\ntolerance:     " << tolerance);
+            }
+        }
+        if (!bumpSeen)
+            BOOST_FAIL("bumped strike was not re-stripped:"
+                       << "\nbumped tenor:  " << optionTenors[bumpedTenor]
+                       << "\nbumped strike: "
+                       << io::rate(strikes[bumpedStrike]));
+    }
+
+    // a curve change triggers a full re-stripping
+    vars.yieldTermStructure.linkTo(boost::shared_ptr<FlatForward>(
+        new FlatForward(0, vars.calendar, 0.05, vars.dayCounter)));
+    freshStripper = boost::shared_ptr<OptionletStripper1>(new
+        OptionletStripper1(surface, iborIndex, Null<Rate>(), vars.accuracy));
+    for (Size i = 0; i < n; ++i) {
+        const std::vector<Volatility>& incremental =
+            stripper->optionletVolatilities(i);
+        const std::vector<Volatility>& fresh =
+            freshStripper->optionletVolatilities(i);
+        for (Size j = 0; j < strikes.size(); ++j) {
+            Real error = std::fabs(incremental[j] - fresh[j]);
+            if (error > tolerance)
+                BOOST_FAIL("\nstripping after curve change failed:"
+                           << "\noptionlet:   " << i
+                           << "\nstrike:      " << io::rate(strikes[j])
+                           << "\nincremental: " << io::volatility(incremental[j])
+                           << "\nfull:        " << io::volatility(fresh[j])
+                           << "\nerror:       " << error
+                           << "\ntolerance:   " << tolerance);
+        }
+    }
+}
+
 test_suite* OptionletStripperTest::suite() {
     test_suite* suite = BOOST_TEST_SUITE("OptionletStripper Tests");
     suite->add(QUANTLIB_TEST_CASE(
@@ -841,6 +981,8 @@ test_suite* OptionletStripperTest::suite() {
                        &OptionletStripperTest::testTermVolatilityStripping2));
     suite->add(QUANTLIB_TEST_CASE(
                        &OptionletStripperTest::testSwitchStrike));
+    suite->add(QUANTLIB_TEST_CASE(
+                       &OptionletStripperTest::testIncrementalStripping));
     suite->add(QUANTLIB_TEST_CASE(
         &OptionletStripperTest::testTermVolatilityStrippingNormalVol));
     suite->add(
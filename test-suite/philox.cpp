@@ -0,0 +1,217 @@
+/* -*- mode: c++; tab-width: 4; indent-tabs-mode: nil; c-basic-offset: 4 -*- */
+
+/*
+ This file is part of QuantLib, a free-software/open-source library
+ for financial quantitative analysts and developers - http://quantlib.org/
+
+ QuantLib is free software: you can redistribute it and/or modify it
+ under the terms of the QuantLib license.  You should have received a
+ copy of the license along with this program; if not, please email
+ <quantlib-dev@lists.sf.net>. The license is also available online at
+ <http://quantlib.org/license.shtml>.
+
+ This program is distributed in the hope that it will be useful, but WITHOUT
+ ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or FITNESS
+ FOR A PARTICULAR PURPOSE.  See the license for more details.
+*/
+
+#include "philox.hpp"
+#include "utilities.hpp"
+#include <ql/math/randomnumbers/philoxuniformrng.hpp>
+#include <ql/math/randomnumbers/rngtraits.hpp>
+#include <ql/models/marketmodels/browniangenerators/philoxbrowniangenerator.hpp>
+
+using namespace QuantLib;
+using namespace boost::unit_test_framework;
+
+namespace {
+
+    BigNatural make64(unsigned long high, unsigned long low) {
+        // shifted twice, so that the code compiles when BigNatural
+        // has 32 bits
+        return ((BigNatural(high) << 16) << 16) | BigNatural(low);
+    }
+
+}
+
+void PhiloxTest::testValues() {
+
+    BOOST_TEST_MESSAGE("Testing Philox generator against known values...");
+
+    if (sizeof(BigNatural) < 8) {
+        BOOST_TEST_MESSAGE("skipped: 64-bit seeds not available");
+        return;
+    }
+
+    // known-answer tests of the Random123 library; the key is the
+    // seed, the upper half of the counter is the substream and the
+    // lower half is the block index
+    struct KnownValues {
+        unsigned long seed[2], substream[2], index[2];
+        unsigned long values[4];
+    };
+    static const KnownValues tests[] = {
+        { { 0xffffffffUL, 0xffffffffUL },
+          { 0xffffffffUL, 0xffffffffUL },
+          { 0xffffffffUL, 0xffffffffUL },
+          { 0x408f276dUL, 0x41c83b0eUL, 0xa20bc7c6UL, 0x6d5451fdUL } },
+        { { 0x299f31d0UL, 0xa4093822UL },
+          { 0x03707344UL, 0x13198a2eUL },
+          { 0x85a308d3UL, 0x243f6a88UL },
+          { 0xd16cfe09UL, 0x94fdccebUL, 0x5001e420UL, 0x24126ea1UL } }
+    };
+
+    for (Size i=0; i<LENGTH(tests); ++i) {
+        PhiloxUniformRng rng(make64(tests[i].seed[0], tests[i].seed[1]),
+                             make64(tests[i].substream[0],
+                                    tests[i].substream[1]));
+        // four numbers per block
+        const BigNatural index =
+            make64(tests[i].index[0], tests[i].index[1]);
+        for (Size j=0; j<4; ++j)
+            rng.discard(index);
+        for (Size j=0; j<4; ++j) {
+            unsigned long x = rng.nextInt32();
+            if (x != tests[i].values[j])
+                BOOST_ERROR("value " << j << " of test " << i
+                            << " is incorrect:"
+                            << std::hex
+                            << "\n    calculated: " << x
+                            << "\n    expected:   " << tests[i].values[j]);
+        }
+    }
+}
+
+
+void PhiloxTest::testSkipping() {
+
+    BOOST_TEST_MESSAGE("Testing Philox generator skipping and blocks...");
+
+    const BigNatural seed = 42;
+    PhiloxUniformRng reference(seed);
+    std::vector<Real> expected(1000);
+    for (Size i=0; i<expected.size(); ++i)
+        expected[i] = reference.nextReal();
+
+    // blocks of uneven sizes, starting in the middle of a block
+    const Size sizes[] = { 1, 3, 7, 64, 1, 100, 33, 2, 250 };
+    PhiloxUniformRng rng(seed);
+    std::vector<Real> block(expected.size());
+    Size k = 0;
+    for (Size i=0; i<LENGTH(sizes); ++i) {
+        rng.nextReals(sizes[i], &block[k]);
+        k += sizes[i];
+    }
+    for (Size i=0; i<k; ++i) {
+        if (block[i] != expected[i])
+            BOOST_FAIL("block generation differs from single draws"
+                       << "\n    index:      " << i
+                       << "\n    calculated: " << block[i]
+                       << "\n    expected:   " << expected[i]);
+    }
+
+    for (Size i=0; i<LENGTH(sizes); ++i) {
+        PhiloxUniformRng skipped(seed);
+        skipped.nextReal();
+        skipped.discard(sizes[i]);
+        skipped.discard(2*sizes[i]);
+        const Size j = 1 + 3*sizes[i];
+        Real x = skipped.nextReal();
+        if (x != expected[j])
+            BOOST_ERROR("skipping differs from single draws"
+                        << "\n    index:      " << j
+                        << "\n    calculated: " << x
+                        << "\n    expected:   " << expected[j]);
+    }
+
+    // different substreams give different sequences
+    PhiloxUniformRng other(seed, 1);
+    Size equal = 0;
+    for (Size i=0; i<expected.size(); ++i) {
+        if (other.nextReal() == expected[i])
+            ++equal;
+    }
+    if (equal > 1)
+        BOOST_ERROR(equal << " numbers of the first substream "
+                    "repeated in the second one");
+
+    // the traits class draws the same numbers
+    PhiloxPseudoRandom::rsg_type rsg =
+        PhiloxPseudoRandom::make_sequence_generator(10, seed);
+    const std::vector<Real>& sample = rsg.nextSequence().value;
+    InverseCumulativeNormal inverse;
+    for (Size i=0; i<sample.size(); ++i) {
+        if (std::fabs(sample[i] - inverse(expected[i])) > 1.0e-15)
+            BOOST_ERROR("sequence generator differs from single draws"
+                        << "\n    index:      " << i
+                        << "\n    calculated: " << sample[i]
+                        << "\n    expected:   " << inverse(expected[i]));
+    }
+}
+
+
+void PhiloxTest::testBrownianGenerator() {
+
+    BOOST_TEST_MESSAGE("Testing Philox Brownian generator...");
+
+    const Size factors = 3, steps = 5, paths = 7;
+    const BigNatural seed = 1234;
+
+    PhiloxBrownianGenerator generator(factors, steps, seed);
+    std::vector<Real> variates(factors);
+    std::vector<std::vector<Real> > expected(paths);
+    for (Size i=0; i<paths; ++i) {
+        generator.nextPath();
+        for (Size j=0; j<steps; ++j) {
+            generator.nextStep(variates);
+            expected[i].insert(expected[i].end(),
+                               variates.begin(), variates.end());
+        }
+    }
+
+    // draws agree with the underlying generator
+    PhiloxUniformRng rng(seed);
+    InverseCumulativeNormal inverse;
+    for (Size i=0; i<paths; ++i) {
+        for (Size j=0; j<factors*steps; ++j) {
+            Real x = inverse(rng.nextReal());
+            if (std::fabs(x - expected[i][j]) > 1.0e-15)
+                BOOST_FAIL("Brownian generator differs from uniform draws"
+                           << "\n    path:       " << i
+                           << "\n    variate:    " << j
+                           << "\n    calculated: " << expected[i][j]
+                           << "\n    expected:   " << x);
+        }
+    }
+
+    // skipping paths
+    for (Size n=0; n<paths; ++n) {
+        boost::shared_ptr<BrownianGenerator> skipped =
+            PhiloxBrownianGeneratorFactory(seed).create(factors, steps);
+        skipped->skipPaths(n);
+        skipped->nextPath();
+        for (Size j=0; j<steps; ++j) {
+            skipped->nextStep(variates);
+            for (Size k=0; k<factors; ++k) {
+                if (variates[k] != expected[n][j*factors+k])
+                    BOOST_ERROR("skipped generator differs from "
+                                "drawn paths"
+                                << "\n    skipped:    " << n
+                                << "\n    step:       " << j
+                                << "\n    factor:     " << k
+                                << "\n    calculated: " << variates[k]
+                                << "\n    expected:   "
+                                << expected[n][j*factors+k]);
+            }
+        }
+    }
+}
+
+
+test_suite* PhiloxTest::suite() {
+    test_suite* suite = BOOST_TEST_SUITE("Philox tests");
+    suite->add(QUANTLIB_TEST_CASE(&PhiloxTest::testValues));
+    suite->add(QUANTLIB_TEST_CASE(&PhiloxTest::testSkipping));
+    suite->add(QUANTLIB_TEST_CASE(&PhiloxTest::testBrownianGenerator));
+    return suite;
+}
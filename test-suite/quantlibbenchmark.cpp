@@ -123,6 +123,7 @@
 #include "marketmodel_smm.hpp"
 #include "marketmodel_cms.hpp"
 #include "lowdiscrepancysequences.hpp"
+#include "matrices.hpp"
 #include "quantooption.hpp"
 #include "riskstats.hpp"
 #include "shortratemodels.hpp"
@@ -275,6 +276,13 @@ test_suite* init_unit_test_suite(int, char*[]) {
     bm.push_back(Benchmark("MarketModelSmmTest::testMultiSmmSwaptions",
         &MarketModelSmmTest::testMultiStepCoterminalSwapsAndSwaptions,
         11244.95));
+    // operation count rather than a measurement: five 400x400 products at
+    // 2*400^3 flops each (640M) plus 2*m*l*n summed over the small
+    // odd-sized products, each done by operator*, multiply and the
+    // reference loop (about 17.6M); the harness divides it by the
+    // elapsed time.
+    bm.push_back(Benchmark("Matrices::Multiplication",
+        &MatricesTest::testMultiplication, 657.60));
     bm.push_back(Benchmark("QuantoOption::ForwardGreeks",
         &QuantoOptionTest::testForwardGreeks, 90.98));
     bm.push_back(Benchmark("RandomNumber::MersenneTwisterDescrepancy",
@@ -163,6 +163,7 @@
 #include "partialtimebarrieroption.hpp"
 #include "pathgenerator.hpp"
 #include "period.hpp"
+#include "philox.hpp"
 #include "piecewiseyieldcurve.hpp"
 #include "piecewisezerospreadedtermstructure.hpp"
 #include "quantooption.hpp"
@@ -402,6 +403,7 @@ test_suite* init_unit_test_suite(int, char* []) {
     test->add(OvernightIndexedSwapTest::suite());
     test->add(PathGeneratorTest::suite());
     test->add(PeriodTest::suite());
+    test->add(PhiloxTest::suite());
     test->add(PiecewiseYieldCurveTest::suite());
     test->add(PiecewiseZeroSpreadedTermStructureTest::suite());
     test->add(QuantoOptionTest::suite());
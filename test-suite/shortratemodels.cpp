@@ -24,6 +24,7 @@
 #include "shortratemodels.hpp"
 #include "utilities.hpp"
 #include <ql/models/shortrate/onefactormodels/hullwhite.hpp>
+#include <ql/discretizedasset.hpp>
 #include <ql/models/shortrate/calibrationhelpers/swaptionhelper.hpp>
 #include <ql/pricingengines/swaption/jamshidianswaptionengine.hpp>
 #include <ql/pricingengines/swap/treeswapengine.hpp>
@@ -398,6 +399,55 @@ void ShortRateModelTest::testSwaps() {
     }
 }
 
+void ShortRateModelTest::testTreeRollback() {
+    BOOST_TEST_MESSAGE("Testing rollback of several assets on a short-rate tree...");
+
+    SavedSettings backup;
+
+    Date today = Settings::instance().evaluationDate();
+    Handle<YieldTermStructure> termStructure(
+                                  flatRate(today, 0.04, Actual360()));
+    boost::shared_ptr<HullWhite> model(
+                                  new HullWhite(termStructure, 0.1, 0.01));
+
+    Time maturity = 10.0;
+    boost::shared_ptr<OneFactorModel::ShortRateTree> tree =
+        boost::dynamic_pointer_cast<OneFactorModel::ShortRateTree>(
+                                     model->tree(TimeGrid(maturity, 100)));
+
+    DiscretizedDiscountBond bond1, bond2, bond3;
+    bond1.initialize(tree, maturity);
+    bond2.initialize(tree, maturity);
+    bond3.initialize(tree, maturity);
+
+    std::vector<DiscretizedAsset*> assets;
+    assets.push_back(&bond1);
+    assets.push_back(&bond2);
+    tree->rollback(assets, 0.0);
+    bond3.rollback(0.0);
+
+    Real value1 = bond1.presentValue(), value2 = bond2.presentValue(),
+         value3 = bond3.presentValue();
+    if (value1 != value3 || value2 != value3)
+        BOOST_ERROR("joint and single rollback differ:"
+                    << std::setprecision(12)
+                    << "\n    joint:  " << value1 << ", " << value2
+                    << "\n    single: " << value3);
+
+    DiscretizedDiscountBond bond4;
+    bond4.initialize(tree, maturity);
+    Real statePricesValue = tree->presentValue(bond4);
+    Real expected = termStructure->discount(maturity);
+    Real tolerance = 1.0e-6;
+    if (std::fabs(value1-expected) > tolerance
+        || std::fabs(statePricesValue-expected) > tolerance)
+        BOOST_ERROR("failed to reproduce discount factor:"
+                    << std::setprecision(12)
+                    << "\n    rollback:     " << value1
+                    << "\n    state prices: " << statePricesValue
+                    << "\n    expected:     " << expected);
+}
+
 void ShortRateModelTest::testFuturesConvexityBias() {
     BOOST_TEST_MESSAGE("Testing Hull-White futures convexity bias...");
 
@@ -433,6 +483,7 @@ test_suite* ShortRateModelTest::suite() {
     suite->add(QUANTLIB_TEST_CASE(&ShortRateModelTest::testCachedHullWhiteFixedReversion));
     suite->add(QUANTLIB_TEST_CASE(&ShortRateModelTest::testCachedHullWhite2));
     suite->add(QUANTLIB_TEST_CASE(&ShortRateModelTest::testSwaps));
+    suite->add(QUANTLIB_TEST_CASE(&ShortRateModelTest::testTreeRollback));
     suite->add(QUANTLIB_TEST_CASE(&ShortRateModelTest::testFuturesConvexityBias));
     return suite;
 }
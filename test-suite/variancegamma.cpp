@@ -23,6 +23,8 @@ FOR A PARTICULAR PURPOSE.  See the license for more details.
 #include <ql/instruments/europeanoption.hpp>
 #include <ql/experimental/variancegamma/analyticvariancegammaengine.hpp>
 #include <ql/experimental/variancegamma/fftvariancegammaengine.hpp>
+#include <ql/experimental/variancegamma/variancegammamodel.hpp>
+#include <ql/pricingengines/vanilla/fourierengine.hpp>
 #include <ql/termstructures/yield/flatforward.hpp>
 #include <ql/termstructures/volatility/equityfx/blackconstantvol.hpp>
 #include <ql/utilities/dataformatters.hpp>
@@ -202,6 +204,36 @@ void VarianceGammaTest::testVarianceGamma() {
                     error, tol);
             }
         }
+
+        // Test generic Fourier engines on the model
+        boost::shared_ptr<VarianceGammaModel> model(
+                                     new VarianceGammaModel(stochProcess));
+        boost::shared_ptr<PricingEngine> fourierEngines[] = {
+            boost::shared_ptr<PricingEngine>(new COSEngine(model)),
+            boost::shared_ptr<PricingEngine>(new CarrMadanFFTEngine(model))
+        };
+        for (Size k=0; k<LENGTH(fourierEngines); k++) {
+            for (Size j=0; j<LENGTH(options); j++) {
+                boost::shared_ptr<VanillaOption> option =
+                    boost::static_pointer_cast<VanillaOption>(optionList[j]);
+                option->setPricingEngine(fourierEngines[k]);
+
+                Real calculated = option->NPV();
+                Real expected = results[i][j];
+                Real error = std::fabs(calculated-expected);
+                if (error>tol) {
+                    boost::shared_ptr<StrikedTypePayoff> payoff =
+                        boost::dynamic_pointer_cast<StrikedTypePayoff>(
+                                                          option->payoff());
+                    REPORT_FAILURE((k == 0 ? "COS value" : "Carr-Madan value"),
+                        payoff, option->exercise(),
+                        processes[i].s, processes[i].q, processes[i].r,
+                        today, processes[i].sigma, processes[i].nu,
+                        processes[i].theta, expected, calculated,
+                        error, tol);
+                }
+            }
+        }
     }
 }
 